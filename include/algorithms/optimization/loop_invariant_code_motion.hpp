@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <memory>
+
+namespace syrec {
+    struct LoopInvariantCodeMotionSettings {
+        // invariant expressions evaluated fewer times by the unrolled loop are not moved, since a moved expression is evaluated twice (computation and uncomputation)
+        std::size_t minEvaluations = 3U;
+        // whether the main module is synthesized with the cost-aware synthesis before and after the code motion to report the savings in the statistics
+        bool measureSavings = false;
+        // settings of the synthesis measuring the savings
+        Properties::ptr synthesisSettings = std::make_shared<Properties>();
+    };
+
+    /**
+     * Move the loop-invariant expressions out of the for statements of a program.
+     *
+     * A for statement is unrolled by the synthesis, thus an expression of its body is synthesized in every iteration. A binary or shift expression of the right-hand side
+     * of an assignment or of the (fi) condition of an if statement in the body of a for statement with constant bounds is invariant if it references neither the loop variable
+     * nor a loop variable of a nested for statement and reads no variable written in the body (determined conservatively, \see VariableAccesses).
+     * The maximal invariant expressions evaluated at least settings.minEvaluations times by the unrolled loop are computed once into a new wire of the module
+     * (i.e. a register of the bitwidth of the expression synthesized on zero-initialized ancillary qubits, whose name 'licm<i>' is unique in the program) by an XOR assignment in front of the for statement,
+     * replaced by the wire in the body and uncomputed by the same assignment behind the for statement. Identical expressions share a wire. The for statements are processed from the outermost one,
+     * thus an expression can be moved out of several nested for statements. Statements shared with other parents are not modified but replaced by modified copies.
+     *
+     * @param program The program whose modules are modified.
+     * @param settings The settings of the code motion.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">invariant_expressions</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of expressions moved out of a for statement.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">removed_evaluations</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of evaluations of the moved expressions saved in the unrolled loops.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">wire_qubits</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of bits of the wires added for the moved expressions.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_gates, gates</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of gates synthesized for the program before and after the code motion (only if settings.measureSavings is set).</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_quantum_cost, quantum_cost</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Quantum cost of the circuit synthesized for the program before and after the code motion (only if settings.measureSavings is set).</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_qubits, qubits</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of qubits synthesized for the program before and after the code motion (only if settings.measureSavings is set).</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_ancillary_qubits, ancillary_qubits</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of ancillary qubits (including the ones of the wires) synthesized for the program before and after the code motion (only if settings.measureSavings is set).</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm (without the synthesis measuring the savings) in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return The number of moved expressions.
+     */
+    std::size_t hoistLoopInvariantExpressions(Program& program, const LoopInvariantCodeMotionSettings& settings = LoopInvariantCodeMotionSettings{}, const Properties::ptr& statistics = Properties::ptr());
+} // namespace syrec
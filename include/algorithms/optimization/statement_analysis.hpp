@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <unordered_set>
+
+namespace syrec {
+    /**
+     * Whether the expressions are structurally identical, i.e. they consist of the same operations applied to the same accesses of the same variables and the same numbers.
+     */
+    bool isSameExpression(const Expression::ptr& lhs, const Expression::ptr& rhs);
+
+    /**
+     * Whether the statements are structurally identical (\see isSameExpression), statements calling the same module with the same arguments are identical.
+     */
+    bool isSameStatement(const Statement::ptr& lhs, const Statement::ptr& rhs);
+
+    /**
+     * The variables read and written by statements.
+     *
+     * The accesses are determined conservatively, i.e. every access of a variable accesses all of its bits and the arguments of an (un)call statement are written.
+     */
+    struct VariableAccesses {
+        std::unordered_set<const Variable*> read;
+        std::unordered_set<const Variable*> written;
+
+        [[nodiscard]] bool writesAnyOf(const std::unordered_set<const Variable*>& variables) const {
+            for (const auto* variable: written) {
+                if (variables.count(variable) != 0U) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        // Whether the order of the statements with these and the other accesses can be swapped
+        [[nodiscard]] bool commutesWith(const VariableAccesses& other) const {
+            return !writesAnyOf(other.read) && !writesAnyOf(other.written) && !other.writesAnyOf(read);
+        }
+    };
+
+    /**
+     * Add the variables accessed by the statements of the module to the accesses.
+     */
+    void addAccesses(const Statement::vec& statements, const Module& module, VariableAccesses& accesses);
+
+    /**
+     * The variables accessed by the statement of the module.
+     */
+    VariableAccesses accessesOf(const Statement::ptr& statement, const Module& module);
+
+    /**
+     * The variables read by the expression, including the ones read by the indices of its variable accesses.
+     */
+    std::unordered_set<const Variable*> readVariablesOf(const Expression::ptr& expression);
+} // namespace syrec
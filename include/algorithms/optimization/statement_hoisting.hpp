@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    /**
+     * Hoist the statements executed by both branches of the if statements of a program out of the if statements.
+     *
+     * Every statement of a branch is synthesized with the helper line of the condition as additional control, thus a statement occurring in both branches
+     * is synthesized twice with an additional control. A statement of the then branch is moved in front of the if statement if the else branch contains an identical
+     * statement, both statements can be moved to the beginning of their branch (i.e. they access no variable written by the preceding statements of the branch and
+     * write no variable accessed by them) and they do not write a variable of the condition. Likewise, statements are moved behind the if statement if they can be moved
+     * to the end of their branches and do not write a variable of the fi condition. If statements whose branches are both empty afterwards are removed.
+     *
+     * The variables accessed by a statement are determined conservatively, i.e. every access of a variable accesses all of its bits and the arguments of an (un)call
+     * statement are written. Statements shared with other parents are not modified but replaced by modified copies.
+     *
+     * @param program The program whose modules are modified.
+     * @return The number of hoisted statements.
+     */
+    std::size_t hoistBranchCommonStatements(Program& program);
+} // namespace syrec
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace syrec {
+    struct StochasticRewritingSettings {
+        // number of independent annealing chains
+        std::size_t nChains = 8U;
+        // number of threads processing the chains (0 to use one thread per hardware thread)
+        std::size_t nThreads = 0U;
+        // number of rewrites proposed per chain
+        std::size_t stepsPerChain = 20000U;
+        // number of steps after which a chain publishes its best circuit and continues from the best circuit of all chains if its current one is worse
+        std::size_t syncInterval = 1000U;
+        // the temperature decreases geometrically from the initial to the final temperature (in units of the quantum cost)
+        double initialTemperature = 2.;
+        double finalTemperature   = 0.05;
+        // seed of the first chain, chain i uses seed + i
+        std::uint64_t seed = 0U;
+        // rewrites touching at most this many qubits are verified for all assignments, larger ones for randomSimulationBlocks * 64 random assignments
+        // (the final check of a whole circuit with more qubits compares the DDs of the functionality of the circuits instead)
+        std::size_t maxExhaustiveQubits    = 16U;
+        std::size_t randomSimulationBlocks = 64U;
+    };
+
+    /**
+     * Optimize the quantum cost (\see AnnotatableQuantumComputation#getQuantumCostForSynthesis) of a circuit consisting of (multi-controlled) X and SWAP gates
+     * by simulated annealing over functionality preserving rewrites.
+     *
+     * The rewrites are moves of a gate across a commuting gate, merges and splits of gates which only differ in a single control (including the cancellation of identical gates),
+     * flips of the polarity of a control by surrounding the gate with X gates, moves of a gate across a CNOT-like gate controlled by a subset of its controls
+     * (which flips the polarity of the corresponding control as in the Peres gate) as well as the decomposition of Fredkin gates into three Toffoli gates and vice versa.
+     * The cost of a chain is updated incrementally by the cost of the replaced gates and every accepted rewrite is verified by bit-parallel simulation of the affected qubits.
+     * Before the circuit is replaced, the optimized circuit is verified against the original one by simulating all assignments (if it has at most maxExhaustiveQubits qubits)
+     * or by comparing the DDs of their functionality, i.e. the optimized circuit is always exactly equivalent.
+     *
+     * The chains are distributed dynamically among the threads and share the best circuit found so far. The circuit is only replaced if a cheaper circuit has been found,
+     * its qubits (including the ancillary and garbage qubits) are kept.
+     *
+     * @param quantumComputation The circuit to optimize.
+     * @param settings The settings of the annealing.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_quantum_cost</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Quantum cost of the circuit before the optimization.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">quantum_cost</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Quantum cost of the optimized circuit.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">accepted_rewrites</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of rewrites accepted by all chains.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">discarded_rewrites</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of rewrites discarded since they would have changed the functionality of the circuit.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return Whether the circuit could be optimized, i.e. consists of supported gates only.
+     */
+    bool stochasticRewriting(qc::QuantumComputation& quantumComputation, const StochasticRewritingSettings& settings = StochasticRewritingSettings{}, const Properties::ptr& statistics = Properties::ptr());
+} // namespace syrec
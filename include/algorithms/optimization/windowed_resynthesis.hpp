@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+
+namespace syrec {
+    struct WindowedResynthesisSettings {
+        // maximum number of qubits touched by the gates of a window (at most 8)
+        std::size_t maxQubits = 6U;
+        // windows with fewer gates are not resynthesized
+        std::size_t minGates = 2U;
+        // number of threads resynthesizing the windows (0 to use one thread per hardware thread)
+        std::size_t nThreads = 0U;
+        // the windows are chosen anew and resynthesized until a pass does not improve the circuit or this many passes have been performed
+        std::size_t maxPasses = 3U;
+    };
+
+    /**
+     * Optimize the quantum cost (\see AnnotatableQuantumComputation#getQuantumCostForSynthesis) of a circuit consisting of (multi-controlled) X and SWAP gates
+     * by resynthesizing small windows of the circuit with \see DDSynthesizer#synthesizeOnePass.
+     *
+     * The circuit is partitioned into maximal sequences of consecutive gates touching at most settings.maxQubits qubits. The permutation realized by a window
+     * is determined by bit-parallel simulation of all assignments of its qubits, resynthesized and the window is replaced if the resynthesized gates are cheaper.
+     * Every replacement is verified by simulating the resynthesized gates. The windows of a pass are independent and thus resynthesized in parallel.
+     * Since the same permutations occur frequently (e.g. in the expansion of repeated statements), the resynthesized gates are cached by the permutation of the window.
+     *
+     * The qubits of the circuit (including the ancillary and garbage qubits) are kept.
+     *
+     * @param quantumComputation The circuit to optimize.
+     * @param settings The settings of the resynthesis.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">initial_quantum_cost</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Quantum cost of the circuit before the optimization.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">quantum_cost</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Quantum cost of the optimized circuit.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">windows</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of windows considered in all passes.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">replaced_windows</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of windows replaced by cheaper gates.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">cache_hits</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of windows whose permutation has already been resynthesized.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return Whether the circuit could be optimized, i.e. consists of supported gates only and settings.maxQubits is valid.
+     */
+    bool windowedResynthesis(qc::QuantumComputation& quantumComputation, const WindowedResynthesisSettings& settings = WindowedResynthesisSettings{}, const Properties::ptr& statistics = Properties::ptr());
+} // namespace syrec
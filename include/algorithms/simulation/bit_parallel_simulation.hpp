@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/waveform_trace.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A (multi-controlled) X or SWAP gate which is simulated for 64 assignments at once.
+     *
+     * The state of a qubit is stored in a 64-bit word whose k-th bit is the value of the qubit for the k-th assignment.
+     */
+    struct BitParallelGate {
+        bool      swap = false;
+        qc::Qubit target1{};
+        qc::Qubit target2{};
+        // control qubits ordered by their index together with their polarity (true for positive controls)
+        std::vector<std::pair<qc::Qubit, bool>> controls;
+
+        void apply(std::vector<std::uint64_t>& state) const {
+            std::uint64_t mask = ~0ULL;
+            for (const auto& [qubit, positive]: controls) {
+                mask &= positive ? state[qubit] : ~state[qubit];
+            }
+            if (swap) {
+                const auto diff = (state[target1] ^ state[target2]) & mask;
+                state[target1] ^= diff;
+                state[target2] ^= diff;
+            } else {
+                state[target1] ^= mask;
+            }
+        }
+
+        bool operator==(const BitParallelGate& other) const {
+            return swap == other.swap && target1 == other.target1 && (!swap || target2 == other.target2) && controls == other.controls;
+        }
+
+        bool operator!=(const BitParallelGate& other) const {
+            return !(*this == other);
+        }
+    };
+
+    /**
+     * Convert the quantum operations of a circuit to gates which can be simulated bit-parallel.
+     * @return The gates of the circuit, std::nullopt if the circuit contains other operations than (multi-controlled) X and SWAP gates.
+     */
+    [[nodiscard]] std::optional<std::vector<BitParallelGate>> compileBitParallel(const qc::QuantumComputation& quantumComputation);
+
+    /**
+     * Replace the quantum operations of a circuit by the given gates (the inverse of \see compileBitParallel). The qubits of the circuit are kept.
+     */
+    void replaceByBitParallelGates(qc::QuantumComputation& quantumComputation, const std::vector<BitParallelGate>& gates);
+
+    /**
+     * Assign the values of the assignments base, ..., base + 63 to the given qubits, i.e. bit k of the state of the j-th qubit is bit j of base + k.
+     * The qubits not given are not modified. base has to be a multiple of 64.
+     */
+    void assignBitParallelBlock(std::vector<std::uint64_t>& state, const std::vector<qc::Qubit>& qubits, std::uint64_t base);
+
+    void simulateBitParallel(const std::vector<BitParallelGate>& gates, std::vector<std::uint64_t>& state);
+
+    /**
+     * Gates (\see compileBitParallel) packed for the repeated simulation of a single assignment.
+     *
+     * The state is stored in 64-bit words, i.e. the value of qubit q is bit q % 64 of word q / 64. For every word containing
+     * controls of a gate, the gate stores the mask of these controls and their required values (set for positive and cleared
+     * for negative controls). Thus, the controls of a gate are evaluated without branches by comparing the masked words.
+     */
+    class WordPackedGates {
+    public:
+        WordPackedGates(const std::vector<BitParallelGate>& bitParallelGates, std::size_t nQubits);
+
+        /**
+         * Compile the operations of a quantum computation via \see compileBitParallel and pack them.
+         * @return The packed gates, std::nullopt if the quantum computation contains other operations than (multi-controlled) X and SWAP gates.
+         */
+        [[nodiscard]] static std::optional<WordPackedGates> compile(const qc::QuantumComputation& quantumComputation);
+
+        [[nodiscard]] std::size_t getNqubits() const {
+            return nQubits;
+        }
+
+        // number of 64-bit words of a state
+        [[nodiscard]] std::size_t getNwords() const {
+            return (nQubits + 63U) / 64U;
+        }
+
+        // Simulate the gates for the state given as getNwords() 64-bit words
+        void simulate(std::vector<std::uint64_t>& state) const;
+
+        // Simulate the gates for the state given as getNwords() 64-bit words while recording the qubits changed by every gate in the trace
+        void simulate(std::vector<std::uint64_t>& state, WaveformTrace& trace) const;
+
+        /**
+         * Simulate the gates for an input pattern with one value per qubit.
+         * @return Whether the size of the input pattern matches the number of qubits.
+         */
+        bool simulate(NBitValuesContainer& output, const NBitValuesContainer& input) const;
+
+    private:
+        struct ControlWord {
+            std::size_t   word     = 0U;
+            std::uint64_t mask     = 0U;
+            std::uint64_t expected = 0U;
+        };
+
+        struct Gate {
+            // the control words of the gate are controlWords[firstControlWord], ..., controlWords[endControlWord - 1]
+            std::size_t firstControlWord = 0U;
+            std::size_t endControlWord   = 0U;
+            bool        swap             = false;
+            qc::Qubit   target1{};
+            qc::Qubit   target2{};
+        };
+
+        std::size_t              nQubits = 0U;
+        std::vector<ControlWord> controlWords;
+        std::vector<Gate>        gates;
+
+        template<bool Traced>
+        void simulateGates(std::vector<std::uint64_t>& state, WaveformTrace* trace) const;
+    };
+} // namespace syrec
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "core/properties.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <variant>
+#include <vector>
+
+namespace syrec {
+    /**
+     * A circuit of (multi-controlled) X and SWAP gates in which repeated gate sequences are shared.
+     *
+     * A subroutine is a gate sequence acting on the formal qubits 0, ..., nQubits - 1. A call applies a subroutine to the qubits of the circuit given by its remap table,
+     * i.e. formal qubit j of the subroutine is mapped to qubit remap[j] of the circuit.
+     */
+    struct CompressedCircuit {
+        struct Subroutine {
+            std::size_t                  nQubits = 0U;
+            std::vector<BitParallelGate> gates;
+        };
+
+        struct Call {
+            std::size_t            subroutine = 0U;
+            std::vector<qc::Qubit> remap;
+        };
+
+        std::size_t                                      nQubits = 0U;
+        std::vector<Subroutine>                          subroutines;
+        std::vector<std::variant<BitParallelGate, Call>> body;
+
+        // number of gates of the uncompressed circuit
+        [[nodiscard]] std::size_t expandedSize() const;
+        // number of gates and calls in the body and the subroutines
+        [[nodiscard]] std::size_t compressedSize() const;
+        // the gates of the uncompressed circuit
+        [[nodiscard]] std::vector<BitParallelGate> expand() const;
+    };
+
+    struct CircuitCompressionSettings {
+        // length of the longest and the shortest repeated gate sequences which are shared (the lengths in between are the halvings of maxSequenceLength)
+        std::size_t maxSequenceLength = 256U;
+        std::size_t minSequenceLength = 4U;
+    };
+
+    /**
+     * Find repeated gate sequences in a circuit and share them as subroutines.
+     *
+     * Every gate is encoded relative to the smallest qubit it acts on together with the distance of this qubit to the smallest qubit of the preceding gate.
+     * Sequences with the same encoding are identical up to a shift of all qubits and are found by comparing rolling hashes of the encodings of all sequences
+     * of a length, starting with the longest sequences. Candidates with the same hash are compared gate by gate before they are shared.
+     *
+     * @param quantumComputation The circuit to compress.
+     * @param settings The settings of the compression.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">subroutines</td>
+     *     <td class="indexvalue">std::size_t</td>
+     *     <td class="indexvalue">Number of shared gate sequences.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">calls</td>
+     *     <td class="indexvalue">std::size_t</td>
+     *     <td class="indexvalue">Number of occurrences of the shared gate sequences.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">compression_ratio</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Number of gates of the circuit divided by the number of gates and calls of the compressed circuit.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return The compressed circuit, std::nullopt if the circuit contains other operations than (multi-controlled) X and SWAP gates.
+     */
+    [[nodiscard]] std::optional<CompressedCircuit> compressCircuit(const qc::QuantumComputation& quantumComputation, const CircuitCompressionSettings& settings = CircuitCompressionSettings{},
+                                                                   const Properties::ptr& statistics = Properties::ptr());
+
+    /**
+     * Simulate a compressed circuit bit-parallel (\see simulateBitParallel). The gates of a subroutine are applied to the states of its formal qubits which are
+     * gathered from and scattered back to the state of the circuit for every call, thus a subroutine is not expanded.
+     */
+    void simulateBitParallel(const CompressedCircuit& circuit, std::vector<std::uint64_t>& state);
+
+    /**
+     * Write a compressed circuit in a line-based text format.
+     * @return Whether the circuit could be written.
+     */
+    bool writeCompressedCircuit(const CompressedCircuit& circuit, std::ostream& os);
+
+    /**
+     * Read a compressed circuit written by \see writeCompressedCircuit.
+     * @return An empty string on success, a description of the error otherwise.
+     */
+    std::string readCompressedCircuit(CompressedCircuit& circuit, std::istream& is);
+} // namespace syrec
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "core/syrec/module.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Values driven onto a signal of the main module at the beginning of the cycles of a sequential simulation.
+     */
+    struct SequentialStimulus {
+        // name of an in or inout parameter or of a state variable of the main module
+        std::string signal;
+        // value of the signal in cycle c of stream s at index c * nStreams + s, a stimulus with values for fewer cycles only drives the first cycles
+        std::vector<std::uint64_t> values;
+    };
+
+    struct SequentialSimulationSettings {
+        std::size_t nCycles  = 1U;
+        std::size_t nStreams = 64U;
+        // signals (names of parameters or state variables of the main module) whose values are recorded at the end of every cycle
+        std::vector<std::string> recordedSignals;
+        // number of threads simulating the blocks of 64 streams (0 to use one thread per hardware thread)
+        std::size_t nThreads = 0U;
+    };
+
+    struct SequentialSimulationTrace {
+        std::size_t nCycles  = 0U;
+        std::size_t nStreams = 0U;
+        // recorded signals in the order of the settings
+        std::vector<std::string> signals;
+        // value of the k-th recorded signal at the end of cycle c of stream s at index c * nStreams + s
+        std::vector<std::vector<std::uint64_t>> values;
+
+        [[nodiscard]] std::uint64_t value(const std::size_t signal, const std::size_t cycle, const std::size_t stream) const {
+            return values[signal][(cycle * nStreams) + stream];
+        }
+    };
+
+    /**
+     * Simulate the circuit synthesized for a main module with state variables as a state machine iterated for several cycles.
+     *
+     * Every cycle is a simulation of the circuit, whose qubits are initialized to zero except for the ones of the state variables, which keep the values
+     * computed by the preceding cycle (zero before the first cycle), and the ones of the signals driven by a stimulus in the cycle. Thus, the outputs of the
+     * state variables are fed back to their inputs while the ancillary, wire and out qubits are reset and the garbage outputs are discarded. Every synthesized
+     * (un)call of a module is an instance with variables of its own (\see SyrecSynthesis#nextInstanceLabelPrefix), i.e. the state variables of a called module
+     * keep their values between the cycles per instance but are not shared by the instances. The qubits of a
+     * signal are determined by the labels of the qubits (\see SyrecSynthesis#addVariable), the value of a signal consists of the values of its array elements
+     * ordered by their index (i.e. at most 64 bits). The streams are independent and simulated bit-parallel, i.e. 64 streams at once (\see BitParallelGate),
+     * and the blocks of 64 streams are simulated in parallel. Only the requested signals are recorded.
+     *
+     * @param quantumComputation The circuit synthesized for the main module.
+     * @param mainModule The main module of the synthesized program.
+     * @param stimuli The values of the inputs of the cycles, an input which is not driven by a stimulus is zero.
+     * @param settings The settings of the simulation.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return The recorded values, std::nullopt if the circuit contains other operations than (multi-controlled) X and SWAP gates, a signal is unknown or
+     * wider than 64 bits, a stimulus drives a signal other than an in or inout parameter or a state variable or has too few values for its cycles.
+     */
+    [[nodiscard]] std::optional<SequentialSimulationTrace> sequentialSimulation(const qc::QuantumComputation& quantumComputation, const Module& mainModule, const std::vector<SequentialStimulus>& stimuli,
+                                                                                const SequentialSimulationSettings& settings = SequentialSimulationSettings{}, const Properties::ptr& statistics = Properties::ptr());
+} // namespace syrec
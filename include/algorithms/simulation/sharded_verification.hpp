@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Settings of the exhaustive verification of a circuit against a reference circuit.
+     *
+     * The primary inputs of a circuit are its non-ancillary qubits (ancillary qubits are initialized to zero), its primary outputs are its non-garbage qubits.
+     * The k-th primary input (output) of the circuit corresponds to the k-th primary input (output) of the reference, ordered by the qubit index.
+     * The assignments of the primary inputs are enumerated by an integer whose k-th bit is the value of the k-th primary input and are split into
+     * shards of consecutive assignments. Each shard is verified by a worker which stores its progress in a checkpoint file in the given directory.
+     */
+    struct ShardedVerificationSettings {
+        std::string directory = ".";
+        std::size_t nShards   = 1U;
+        // number of workers running at the same time
+        std::size_t nWorkers = 1U;
+        // whether every worker is a forked process instead of a thread of the calling process, thus a crashing worker does not affect the
+        // other shards (ignored on platforms without fork())
+        bool isolateWorkers = false;
+        // number of counterexamples recorded per shard
+        std::size_t maxCounterexamples = 10U;
+        // number of assignments checked between two checkpoints
+        std::uint64_t checkpointInterval = 1ULL << 24U;
+        // number of assignments checked by a single run of a worker before it stops (0 for no limit), the shard is resumed by the next run
+        std::uint64_t maxAssignmentsPerRun = 0U;
+    };
+
+    struct Counterexample {
+        // assignment of the primary inputs
+        std::uint64_t input = 0U;
+        // values of the primary outputs of the circuit and the reference (the character at position k is the value of the k-th primary output)
+        std::string output;
+        std::string expected;
+    };
+
+    struct VerificationReport {
+        std::uint64_t               totalAssignments   = 0U;
+        std::uint64_t               checkedAssignments = 0U;
+        std::uint64_t               mismatches         = 0U;
+        std::vector<std::size_t>    incompleteShards;
+        std::vector<Counterexample> counterexamples;
+
+        [[nodiscard]] double coverage() const {
+            return totalAssignments == 0U ? 1. : static_cast<double>(checkedAssignments) / static_cast<double>(totalAssignments);
+        }
+
+        [[nodiscard]] bool equivalent() const {
+            return incompleteShards.empty() && mismatches == 0U;
+        }
+    };
+
+    // file in which the progress and the counterexamples of a shard are stored
+    [[nodiscard]] std::string shardCheckpointFilename(const ShardedVerificationSettings& settings, std::size_t shard);
+
+    /**
+     * Verify (the remaining assignments of) a shard by simulating 64 assignments at once.
+     *
+     * The verification resumes from the checkpoint of the shard if it exists and belongs to the same circuits and settings.
+     * Only circuits consisting of (multi-controlled) X and SWAP gates can be verified.
+     * @return Whether the shard could be processed (independent of the circuits being equivalent).
+     */
+    bool verifyShard(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, std::size_t shard, const ShardedVerificationSettings& settings);
+
+    /**
+     * Merge the checkpoints of all shards into a coverage report including the first counterexamples (ordered by the assignment of the primary inputs).
+     * Shards without a (matching) checkpoint are reported as incomplete.
+     */
+    [[nodiscard]] VerificationReport mergeShardCheckpoints(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const ShardedVerificationSettings& settings);
+
+    /**
+     * Verify all shards which are not completed yet by independent workers and merge their checkpoints.
+     *
+     * A crashed or stopped worker does not lose the progress stored in its last checkpoint, i.e. calling the function again resumes the verification.
+     * The shard of a worker which failed (or whose process did not exit successfully) is reported as incomplete.
+     */
+    [[nodiscard]] VerificationReport verifyExhaustively(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const ShardedVerificationSettings& settings = ShardedVerificationSettings{});
+} // namespace syrec
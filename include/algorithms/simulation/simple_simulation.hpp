@@ -20,7 +20,8 @@ namespace syrec {
     * @brief Simulation for a single gate \p g
     *
     * This operator performs simulation for a single gate and is called by
-    * \ref syrec::simple_simulation "simple_simulation".
+    * \ref syrec::simple_simulation "simple_simulation". Positive controls have
+    * to be set and negative controls have to be cleared for the gate to be applied.
     *
     * \b Important: The operator should modify \p input directly.
     *
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Trace of the simulation of a circuit of (multi-controlled) X and SWAP gates recording the qubits changed by every gate (\see WordPackedGates#simulate).
+     *
+     * Since a gate toggles the qubits it changes, a change is stored as the number of gates since the preceding change and the changed qubit only.
+     * Both are encoded as variable-length integers (7 bits per byte) in a byte buffer, thus a change usually takes two to four bytes and gates which do
+     * not change any qubit (e.g. due to an unsatisfied control) take no space.
+     */
+    class WaveformTrace {
+    public:
+        /**
+         * Start the trace of a simulation, discarding the recorded changes.
+         * @param initialState The state before the first gate given as 64-bit words (the value of qubit q is bit q % 64 of word q / 64).
+         * @param nQubits The number of qubits of the simulated circuit.
+         */
+        void begin(const std::vector<std::uint64_t>& initialState, std::size_t nQubits);
+
+        // Record the change of the qubit by the gate, the gates of the changes have to be non-decreasing
+        void recordChange(const std::size_t gate, const qc::Qubit qubit) {
+            appendVarint(gate - lastGate);
+            appendVarint(qubit);
+            lastGate = gate;
+            ++nChanges;
+        }
+
+        // Finish the trace of a simulation of nGates gates
+        void end(const std::size_t nGates) {
+            this->nGates = nGates;
+        }
+
+        [[nodiscard]] std::size_t getNqubits() const {
+            return nQubits;
+        }
+
+        [[nodiscard]] std::size_t getNgates() const {
+            return nGates;
+        }
+
+        [[nodiscard]] std::size_t getNchanges() const {
+            return nChanges;
+        }
+
+        // number of bytes of the encoded changes
+        [[nodiscard]] std::size_t getBufferSize() const {
+            return buffer.size();
+        }
+
+        [[nodiscard]] const std::vector<std::uint64_t>& getInitialState() const {
+            return initialState;
+        }
+
+        // Call onChange(gate, qubit) for the recorded changes in the order of their gates
+        void forEachChange(const std::function<void(std::size_t, qc::Qubit)>& onChange) const;
+
+        // Determine the state after the first nGates gates by replaying the recorded changes
+        [[nodiscard]] std::vector<std::uint64_t> stateAfter(std::size_t nGates) const;
+
+    private:
+        std::size_t                nQubits  = 0U;
+        std::size_t                nGates   = 0U;
+        std::size_t                nChanges = 0U;
+        std::size_t                lastGate = 0U;
+        std::vector<std::uint64_t> initialState;
+        std::vector<std::uint8_t>  buffer;
+
+        void appendVarint(std::uint64_t value) {
+            while (value >= 0x80U) {
+                buffer.emplace_back(static_cast<std::uint8_t>(value | 0x80U));
+                value >>= 7U;
+            }
+            buffer.emplace_back(static_cast<std::uint8_t>(value));
+        }
+    };
+
+    struct VcdSettings {
+        // whether a time step of the dump covers a group of consecutive gates synthesized for the same statement or a single gate
+        bool groupByStatement = true;
+        std::string timescale = "1ns";
+        std::string scope     = "circuit";
+        // key of the gate annotation holding the line number of the statement of a gate (\see SyrecSynthesis#GATE_ANNOTATION_KEY_ASSOCIATED_STATEMENT_LINE_NUMBER)
+        std::string lineNumberAnnotationKey = "lno";
+    };
+
+    /**
+     * Write a trace as value change dump (VCD) to be viewed in a waveform viewer.
+     *
+     * The qubits are grouped into one signal per variable by their labels (\see SyrecSynthesis#addVariable), i.e. the bits of a signal are the qubits whose labels
+     * start with the name of the variable followed by an array index or a bit, ordered by their index. Every other qubit (e.g. an ancillary qubit) is a signal of
+     * its own. Time step 0 is the initial state and time step k the state after the k-th gate or group of gates. The additional integer signal lno is the line
+     * number of the statement of the gates of a time step (0 if unknown), only the time steps changing a signal or the line number are dumped.
+     *
+     * @param os The stream the dump is written to.
+     * @param trace The trace of the simulation of the circuit.
+     * @param quantumComputation The simulated circuit, whose qubit labels are the names of the signals.
+     * @param lineNumberOfGate The line number of the statement of every gate of the circuit.
+     * @param settings The settings of the dump.
+     * @throws std::invalid_argument if the number of qubits or gates of the trace does not match the circuit or the line numbers.
+     */
+    void writeVcd(std::ostream& os, const WaveformTrace& trace, const qc::QuantumComputation& quantumComputation, const std::vector<std::size_t>& lineNumberOfGate, const VcdSettings& settings = VcdSettings{});
+
+    /**
+     * Write a trace as value change dump with the line numbers of the statements taken from the annotations of the gates (\see VcdSettings#lineNumberAnnotationKey).
+     */
+    void writeVcd(std::ostream& os, const WaveformTrace& trace, const AnnotatableQuantumComputation& annotatableQuantumComputation, const VcdSettings& settings = VcdSettings{});
+} // namespace syrec
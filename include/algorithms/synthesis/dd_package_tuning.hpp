@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Package.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace syrec {
+
+    /**
+     * Tuning of the dd::Package used by the DD-based synthesis.
+     *
+     * The settings can also be given as Properties:
+     * | Key                                   | Type     | Default |
+     * |---------------------------------------|----------|---------|
+     * | dd_adaptive_sizing                    | bool     | true    |
+     * | dd_adaptive_garbage_collection        | bool     | false   |
+     * | dd_min_garbage_collection_interval    | unsigned | 1       |
+     * | dd_max_garbage_collection_interval    | unsigned | 64      |
+     * | dd_min_freed_share                    | double   | 0.25    |
+     */
+    struct DDPackageTuning {
+        // whether the tables of the package are sized from the size of the problem (otherwise the defaults of dd::DDPackageConfig are used)
+        bool adaptiveSizing = true;
+        // whether the number of operations between two garbage collections adapts to the share of nodes freed by the collections
+        // (otherwise the package is asked to collect its garbage after every operation, as without tuning)
+        bool adaptiveGarbageCollection = false;
+        // bounds of the number of operations between two garbage collections
+        std::size_t minGarbageCollectionInterval = 1U;
+        std::size_t maxGarbageCollectionInterval = 64U;
+        // a collection freeing less than this share of the nodes doubles the interval, one freeing more than twice this share halves it
+        double minFreedShare = 0.25;
+
+        [[nodiscard]] static auto fromProperties(const Properties::ptr& settings) -> DDPackageTuning;
+    };
+
+    // configuration of a package synthesizing a function on the given number of lines whose DD is expected to have about sizeHint nodes per line
+    // (e.g. the number of cubes of its truth table), the buckets of the matrix unique table keep their default since they determine the synthesized circuit
+    [[nodiscard]] auto synthesisPackageConfig(std::size_t nLines, std::size_t sizeHint) -> dd::DDPackageConfig;
+
+    // configuration of a package simulating the basis states of a circuit with the given number of qubits and operations
+    [[nodiscard]] auto simulationPackageConfig(std::size_t nQubits, std::size_t nOperations) -> dd::DDPackageConfig;
+
+    /**
+     * Schedules the garbage collections of a package and monitors its number of matrix nodes and the hit ratio of its compute tables.
+     */
+    class DDPackageMonitor {
+    public:
+        explicit DDPackageMonitor(const DDPackageTuning& tuning = DDPackageTuning{}):
+            tuning(tuning), interval(tuning.minGarbageCollectionInterval) {}
+
+        // to be called after every operation on the package instead of dd::Package::garbageCollect
+        auto afterOperation(dd::Package& dd) -> void;
+
+        auto reset() -> void {
+            *this = DDPackageMonitor(tuning);
+        }
+
+        [[nodiscard]] auto getTuning() const -> const DDPackageTuning& {
+            return tuning;
+        }
+
+        [[nodiscard]] auto getOperations() const -> std::uint64_t {
+            return operations;
+        }
+
+        [[nodiscard]] auto getGarbageCollections() const -> std::uint64_t {
+            return garbageCollections;
+        }
+
+        [[nodiscard]] auto getGarbageCollectionInterval() const -> std::size_t {
+            return interval;
+        }
+
+        [[nodiscard]] auto getPeakNodes() const -> std::uint64_t {
+            return peakNodes;
+        }
+
+        /**
+         * Writes the following statistics of the package:
+         * | Key                                   | Type          | Description                                                             |
+         * |---------------------------------------|---------------|-------------------------------------------------------------------------|
+         * | dd_operations                         | std::uint64_t | Number of operations reported by afterOperation                         |
+         * | dd_garbage_collections                | std::uint64_t | Number of garbage collections performed by the package                  |
+         * | dd_garbage_collection_interval        | std::uint64_t | Number of operations between two garbage collections at the end         |
+         * | dd_nodes                              | std::uint64_t | Number of matrix nodes in the unique table                              |
+         * | dd_peak_nodes                         | std::uint64_t | Maximal number of matrix nodes observed before a garbage collection     |
+         * | dd_multiplication_lookups             | std::uint64_t | Number of lookups in the matrix multiplication compute table            |
+         * | dd_multiplication_hit_ratio           | double        | Share of the lookups in the matrix multiplication compute table found   |
+         * | dd_addition_hit_ratio                 | double        | Share of the lookups in the matrix addition compute table found         |
+         */
+        auto writeStatistics(dd::Package& dd, const Properties::ptr& statistics) const -> void;
+
+    private:
+        DDPackageTuning tuning;
+        std::size_t     interval;
+        std::size_t     operationsSinceCollection = 0U;
+        std::uint64_t   operations                = 0U;
+        std::uint64_t   garbageCollections        = 0U;
+        std::uint64_t   peakNodes                 = 0U;
+    };
+
+} // namespace syrec
@@ -10,6 +10,10 @@
 
 #pragma once
 
+#include "algorithms/synthesis/dd_package_tuning.hpp"
+#include "core/memory_report.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/bdd_truth_table.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/Node.hpp"
 #include "dd/Package.hpp"
@@ -19,11 +23,56 @@
 
 #include <cstddef>
 #include <memory>
+#include <queue>
+#include <string>
+#include <unordered_set>
+#include <variant>
+#include <vector>
 
 namespace syrec {
 
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
 
+    // builds the same DD as for the extended TruthTable directly from the BDDs of the outputs, the restrictions of the BDDs are built in the package of the truth table
+    auto buildDD(BddTruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge;
+
+    // memory used by the (distinct) nodes reachable from the given DD
+    auto memoryReportOfDD(const dd::mEdge& src) -> MemoryReport;
+
+    struct DDBatchSettings {
+        // synthesize with the coding techniques (instead of the one-pass synthesis)
+        bool codingTechniques   = false;
+        bool withAdditionalLine = true;
+        // number of truth tables synthesized with a package before its garbage is collected (0 disables the periodic collection)
+        std::size_t garbageCollectionInterval = 32U;
+        // number of threads, each of which uses its own package
+        std::size_t nThreads = 1U;
+        // sizing and garbage collection of the packages (a package is sized for the largest truth table of the batch)
+        DDPackageTuning tuning;
+    };
+
+    struct DDBatchResult {
+        std::shared_ptr<qc::QuantumComputation> qc;
+        // run-time of the synthesis of the truth table (in the same unit as DDSynthesizer::getExecutionTime)
+        double runtime = 0.;
+        // number of matrix nodes in the unique table of the package after the synthesis of the truth table (and the garbage collection, if one was due)
+        std::size_t nodes = 0U;
+    };
+
+    /**
+     * Periodic checkpointing of the synthesis of a DD.
+     *
+     * A checkpoint stores the gates emitted so far, the DD still to be synthesized (as a table of its nodes), the queue and the visited nodes
+     * of the breadth-first traversal as well as the counters of the synthesizer. It is written to a temporary file which then replaces the
+     * checkpoint, thus a crashed or preempted synthesis always leaves a consistent checkpoint behind.
+     */
+    struct DDCheckpointSettings {
+        // file the checkpoints are written to (checkpointing is disabled if empty)
+        std::string filename;
+        // number of nodes processed between two checkpoints
+        std::size_t interval = 1000U;
+    };
+
     class DDSynthesizer {
     public:
         static auto synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine = true) -> std::shared_ptr<qc::QuantumComputation> {
@@ -36,6 +85,63 @@ namespace syrec {
             return synthesizer.synthesizeOnePassTT(tt);
         }
 
+        // the BDDs built during the synthesis are added to the (possibly shared) package of the truth table
+        static auto synthesizeOnePass(BddTruthTable& tt) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer{};
+            return synthesizer.synthesizeOnePassTT(tt);
+        }
+
+        // the coding techniques need the output patterns of all cubes to assign the codewords, which a BddTruthTable does not enumerate
+        static auto synthesizeCodingTechniques(const BddTruthTable& tt, bool withAdditionalLine = true) -> std::shared_ptr<qc::QuantumComputation> = delete;
+
+        static auto synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine, const DDCheckpointSettings& checkpoint) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer{};
+            synthesizer.checkpointSettings = checkpoint;
+            return synthesizer.synthesizeCodingTechniquesTT(tt, withAdditionalLine);
+        }
+
+        static auto synthesizeOnePass(const TruthTable& tt, const DDCheckpointSettings& checkpoint) -> std::shared_ptr<qc::QuantumComputation> {
+            DDSynthesizer synthesizer{};
+            synthesizer.checkpointSettings = checkpoint;
+            return synthesizer.synthesizeOnePassTT(tt);
+        }
+
+        /**
+         * Synthesizes the truth table with a package tuned by the settings (\see DDPackageTuning::fromProperties).
+         *
+         * Besides the statistics of the package (\see DDPackageMonitor::writeStatistics), the number of gates (gates, std::uint64_t) and the
+         * run-time in milliseconds (runtime, double) are written to the statistics.
+         */
+        static auto synthesizeOnePass(const TruthTable& tt, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation>;
+
+        static auto synthesizeCodingTechniques(const TruthTable& tt, bool withAdditionalLine, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation>;
+
+        /**
+         * Resumes a synthesis from the checkpoint stored in checkpoint.filename and returns the complete circuit.
+         *
+         * The DD is rebuilt in a new package and the synthesis continues exactly where the checkpoint was written (including the decoder of the
+         * coding techniques), thus the result is the same circuit as the one of an uninterrupted synthesis. Further checkpoints are written according
+         * to the given settings. Throws std::invalid_argument if the checkpoint cannot be read.
+         */
+        static auto resume(const DDCheckpointSettings& checkpoint) -> std::shared_ptr<qc::QuantumComputation> {
+            return resume(checkpoint, nullptr, nullptr);
+        }
+
+        /**
+         * Resumes a synthesis like \see resume with a package tuned by the settings (\see DDPackageTuning::fromProperties), as for an uninterrupted synthesis.
+         *
+         * The statistics are the ones of \see synthesizeOnePass, they cover the resumed part of the synthesis only (except for the number of gates).
+         */
+        static auto resume(const DDCheckpointSettings& checkpoint, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation>;
+
+        /**
+         * Synthesizes many (related) truth tables reusing the packages (and thus the warm unique and compute tables) across the truth tables.
+         *
+         * A package is enlarged whenever a truth table requires more qubits than synthesized so far.
+         * The truth tables are distributed dynamically among the threads; the results are returned in the order of the truth tables.
+         */
+        static auto synthesizeBatch(const std::vector<TruthTable>& tts, const DDBatchSettings& settings = DDBatchSettings{}) -> std::vector<DDBatchResult>;
+
         auto synthesize(dd::mEdge src, std::unique_ptr<dd::Package>& dd) -> std::shared_ptr<qc::QuantumComputation>;
 
         [[nodiscard]] auto numGate() const -> std::size_t {
@@ -50,6 +156,9 @@ namespace syrec {
             totalNoBits = 0U;
             r           = 0U;
             garbageFlag = false;
+
+            pendingCodewords = {};
+            packageMonitor.reset();
         }
 
         [[nodiscard]] auto getExecutionTime() const -> double {
@@ -73,6 +182,20 @@ namespace syrec {
         std::size_t r           = 0U;
         bool        garbageFlag = false;
 
+        DDCheckpointSettings checkpointSettings;
+
+        // schedules the garbage collections of ddSynth, its tuning also determines how ddSynth is sized
+        DDPackageMonitor packageMonitor;
+        // lower bound of the size hint ddSynth is sized for (\see synthesisPackageConfig), used to size a package for a whole batch
+        std::size_t packageSizeHint = 0U;
+
+        // codewords of the decoder which still has to be synthesized once the DD has been synthesized (coding techniques only)
+        std::variant<std::monostate, TruthTable::CubeMap, TruthTable::CubeMultiMap> pendingCodewords;
+
+        // breadth-first synthesis of `src` starting from the given state of the traversal
+        auto processQueue(dd::mEdge src, std::queue<dd::mEdge>& queue, std::unordered_set<dd::mEdge>& visited, std::unique_ptr<dd::Package>& dd) -> void;
+        auto writeCheckpoint(const dd::mEdge& src, const std::queue<dd::mEdge>& queue, const std::unordered_set<dd::mEdge>& visited, double elapsed) const -> bool;
+
         static auto pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void;
         static auto pathFromSrcDst(dd::mEdge const& src, size_t level, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec, TruthTable::Cube& cube) -> void;
 
@@ -101,11 +224,16 @@ namespace syrec {
         template<class T>
         auto decoder(T const& codewords) -> void;
 
-        auto initializeSynthesizer(TruthTable const& tt) -> void;
+        template<class T>
+        auto initializeSynthesizer(T const& tt) -> void;
+
+        auto writeStatistics(const Properties::ptr& statistics, double runtimeInMilliseconds) -> void;
 
-        auto buildAndSynthesize(TruthTable const& tt) -> void;
+        template<class T>
+        auto buildAndSynthesize(T& tt) -> void;
 
-        auto synthesizeOnePassTT(TruthTable tt) -> std::shared_ptr<qc::QuantumComputation>;
+        template<class T>
+        auto synthesizeOnePassTT(T tt) -> std::shared_ptr<qc::QuantumComputation>;
 
         auto synthesizeCodingTechniquesTT(TruthTable tt, bool withAdditionalLine) -> std::shared_ptr<qc::QuantumComputation>;
     };
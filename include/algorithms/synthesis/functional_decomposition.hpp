@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace syrec {
+
+    struct FunctionalDecompositionSettings {
+        // functions with at most this many inputs are synthesized without trying a Curtis decomposition
+        std::size_t maxLeafInputs = 8U;
+        // maximal number of inputs of the bound set of a Curtis decomposition
+        std::size_t maxBoundSetSize = 4U;
+        // maximal number of bound sets evaluated per function
+        std::size_t maxBoundSetCandidates = 4096U;
+        // maximal number of output values evaluated by the bound sets of a function, a bound set of a function with k inputs and m outputs evaluates m * 2^k values
+        std::uint64_t maxBoundSetEvaluations = 1ULL << 28U;
+        // number of threads synthesizing the sub-tables (\see DDBatchSettings)
+        std::size_t nThreads = 1U;
+        // whether the composed circuit is simulated for all inputs and compared to the truth table
+        bool verify = true;
+    };
+
+    struct DecomposedCircuit {
+        std::shared_ptr<qc::QuantumComputation> qc;
+        // qubit of the i-th input of the truth table (all other qubits are ancillary qubits initialized to zero)
+        std::vector<qc::Qubit> inputQubits;
+        // qubit holding the i-th output of the truth table after the circuit (all other qubits are garbage)
+        std::vector<qc::Qubit> outputQubits;
+    };
+
+    /**
+     * Synthesize a multi-output function by decomposing it into smaller functions whose truth tables are synthesized independently (\see DDSynthesizer).
+     *
+     * The truth table is treated as completely specified, i.e. missing inputs have the zero output and don't care outputs are set to zero. A function is
+     * decomposed recursively by
+     * - removing the inputs none of its outputs depends on,
+     * - realizing the constant outputs, the outputs equal to an input (or its negation) and the outputs equal to another output by copying onto new ancillary lines,
+     * - splitting the outputs into groups of disjoint support, and
+     * - a Curtis decomposition f(A, B) = F(g(A), B) with a bound set A of at most maxBoundSetSize inputs whose column multiplicity (the number of distinct
+     *   functions of B obtained by fixing A, for all outputs at once) requires fewer than |A| bits, which are computed by g on new ancillary lines and shared by all outputs.
+     * Identical sub-functions are synthesized once and all sub-tables are synthesized in parallel. The synthesized circuit of a sub-table operates on the lines of its
+     * inputs (which are not needed afterwards) and new ancillary lines, the layout of its inputs and outputs is determined by simulating it.
+     *
+     * The function as well as the specified outputs are stored as dense truth vectors of 2^n bits per output, the composed circuit is verified by simulating all
+     * 2^n inputs and every sub-table is synthesized from the 2^k rows of its inputs. The outputs of a truth table with more than 20 inputs are first split into
+     * the groups of disjoint support on the BDDs of its outputs, thus every group of outputs has to depend on at most 20 inputs (and is compared for all of its
+     * inputs as the completely specified function) and the function has to decompose into sub-tables of at most 16 inputs.
+     *
+     * @param tt The truth table of the function whose groups of outputs of disjoint support depend on at most 20 inputs each.
+     * @param settings The settings of the decomposition.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">components</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of splits into outputs of disjoint support.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">curtis_decompositions</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of Curtis decompositions.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">copied_outputs</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of outputs realized by copying a constant, an input or another output.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">sub_tables</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of distinct synthesized sub-tables.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">max_sub_table_inputs</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Maximal number of inputs of a synthesized sub-table.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     * @return The composed circuit, std::nullopt if a group of outputs depends on more than 20 inputs, it does not decompose into sub-tables of at most 16 inputs, a sub-table
+     * could not be synthesized or the composed circuit does not realize the truth table.
+     */
+    [[nodiscard]] std::optional<DecomposedCircuit> synthesizeDecomposed(const TruthTable& tt, const FunctionalDecompositionSettings& settings = FunctionalDecompositionSettings{}, const Properties::ptr& statistics = Properties::ptr());
+
+} // namespace syrec
@@ -11,6 +11,7 @@
 #pragma once
 
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/memory_report.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/module.hpp"
@@ -20,6 +21,8 @@
 #include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <optional>
 #include <stack>
@@ -42,12 +45,60 @@ namespace syrec {
 
         using VarLinesMap = std::map<Variable::ptr, qc::Qubit>;
 
+        /**
+         * Circuit structure used to synthesize the relational operations (<, >, <=, >=).
+         *
+         * SubtractAndRestore: subtracts the operands in place with a carry into the result line and restores them by an addition (default).
+         * CarryChain: only computes the carry chain of the addition ~a + b (whose carry out is set iff a < b), requiring one additional ancillary qubit but about half of the Toffoli gates.
+         * LogDepthTree: combines the per-bit (less than, equal) pairs in a balanced tree, requiring O(n) ancillary qubits but only O(log n) Toffoli levels.
+         */
+        enum class ComparatorImplementation {
+            SubtractAndRestore,
+            CarryChain,
+            LogDepthTree
+        };
+
+        /**
+         * Circuit structure used to synthesize the unary statements ++= and --= (the latter being the inverse of the former) of an n-bit variable.
+         *
+         * Cascade: flips every bit controlled by all less significant bits, i.e. requires MCT gates with up to n - 1 controls.
+         * CarryChain: computes the conjunctions of the less significant bits in n - 2 clean ancillary qubits, requiring O(n) Toffoli gates.
+         * BorrowedQubits: subtracts the value of n idle qubits of arbitrary state and its negation from the variable with O(n) Toffoli gates, the idle qubits are restored.
+         * CostBased: picks the implementation with the lowest quantum cost among the ones not requiring additional qubits (default).
+         */
+        enum class IncrementerImplementation {
+            Cascade,
+            CarryChain,
+            BorrowedQubits,
+            CostBased
+        };
+
         explicit SyrecSynthesis(AnnotatableQuantumComputation& annotatableQuantumComputation);
         virtual ~SyrecSynthesis() = default;
 
-        [[nodiscard]] bool addVariables(const Variable::vec& variables);
+        // Adds the lines of the variables, whose qubits are labelled by the name of the variable preceded by the prefix (\see addVariable)
+        [[nodiscard]] bool addVariables(const Variable::vec& variables, const std::string& labelPrefix = std::string());
         void               setMainModule(const Module::ptr& mainModule);
 
+        /**
+         * Synthesizes the given program using the given synthesizer.
+         *
+         * Settings:
+         * | Key                                  | Type        | Default                | Description                                                                                                  |
+         * |--------------------------------------|-------------|------------------------|--------------------------------------------------------------------------------------------------------------|
+         * | main_module                          | std::string | ""                     | Module to synthesize, defaults to Program::mainModule (set by the lazy loading), 'main' or the first module  |
+         * | comparator_implementation            | std::string | "subtract_and_restore" | One of "subtract_and_restore", "carry_chain" or "log_depth_tree" (see ComparatorImplementation)              |
+         * | equality_with_constant_using_mct     | bool        | false                  | Synthesize (in-)equality checks against a constant as a single MCT gate without allocating constant lines   |
+         * | incrementer_implementation           | std::string | "cost_based"           | One of "cascade", "carry_chain", "borrowed_qubits" or "cost_based" (see IncrementerImplementation)          |
+         * | memory_report                        | bool        | false                  | Account the memory of the IR, the synthesis and the quantum computation and store it in the statistics      |
+         * | memory_report_sampling_interval      | unsigned    | 1024                   | Number of gates after which the memory is sampled during the phase "statements" (0 samples only at its end) |
+         *
+         * Statistics:
+         * | Key                                  | Type         | Description                                                                                                             |
+         * |--------------------------------------|--------------|-------------------------------------------------------------------------------------------------------------------------|
+         * | runtime                              | double       | Run-time of the synthesis in milliseconds                                                                               |
+         * | memory_report                        | MemoryReport | Memory per category after the synthesis with the sampled peaks of the phases "variables" and "statements" (if requested) |
+         */
         [[maybe_unused]] static bool synthesize(SyrecSynthesis* synthesizer, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics);
 
     protected:
@@ -100,11 +151,14 @@ namespace syrec {
         static bool  disjunction(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, qc::Qubit src1, qc::Qubit src2);                                                          // ||
         static bool  division(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2); // /
         static bool  equals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                       // =
-        static bool  greaterEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& srcTwo, const std::vector<qc::Qubit>& srcOne);            // >
-        static bool  greaterThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                  // >// +=
         static bool  increaseWithCarry(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src, qc::Qubit carry);
-        static bool  lessEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1);                         // <=
         static bool  lessThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                           // <
+        bool         lessThanUsingSelectedComparator(qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);
+        bool         lessThanUsingCarryChain(qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);
+        bool         lessThanUsingComparatorTree(qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);
+        bool         equalsConstant(qc::Qubit dest, const std::vector<qc::Qubit>& src, unsigned value);
+        bool         incrementUsingSelectedIncrementer(const std::vector<qc::Qubit>& dest, bool inverse);
+        bool         incrementUsingCarryChain(const std::vector<qc::Qubit>& dest, bool inverse);
         static bool  modulo(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);         // %
         static bool  multiplication(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2); // *
         static bool  notEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2);                          // !=
@@ -118,11 +172,32 @@ namespace syrec {
         static bool leftShift(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, qc::Qubit src2);  // <<
         static bool rightShift(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, qc::Qubit src2); // >>
 
-        [[nodiscard]] static bool addVariable(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<unsigned>& dimensions, const Variable::ptr& var, const std::string& arraystr);
+        // The qubits of a variable are labelled '<labelPrefix><name><arraystr>.<bit>', the variables of the main module have no prefix and the ones of a called module
+        // the prefix '<module>#<instance>/' of its (un)call (\see nextInstanceLabelPrefix)
+        [[nodiscard]] static bool addVariable(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<unsigned>& dimensions, const Variable::ptr& var, const std::string& arraystr, const std::string& labelPrefix = std::string());
+        // Returns the label prefix of the variables of the next (un)call of the module, whose instances are numbered in the order of their synthesis
+        [[nodiscard]] std::string nextInstanceLabelPrefix(const Module& module);
         void                      getVariables(const VariableAccess::ptr& var, std::vector<qc::Qubit>& lines);
+        static void               getAccessedLinesOfElement(const VariableAccess::ptr& var, qc::Qubit elementOffset, const Number::loop_variable_mapping& loopVariableMapping, std::vector<qc::Qubit>& lines);
+
+        // dynamic array indexing (i.e. accesses a[i] whose index is only known at run time)
+        struct EvaluatedArrayIndex {
+            std::optional<qc::Qubit> value; // set for indexes known at compile time
+            std::vector<qc::Qubit>   lines; // qubits storing the value of an index only known at run time
+        };
+
+        [[nodiscard]] static bool isDynamicallyIndexed(const VariableAccess::ptr& var);
+        bool                      evaluateArrayIndexes(const VariableAccess::ptr& var, std::vector<EvaluatedArrayIndex>& indexes);
+        bool                      forEachSelectableArrayElement(const VariableAccess::ptr& var, const std::vector<EvaluatedArrayIndex>& indexes, std::size_t dimension, qc::Qubit elementOffset, const std::function<bool(const std::vector<qc::Qubit>&)>& onElement);
+        bool                      unaryIteration(const std::vector<qc::Qubit>& selectorLines, std::size_t nUndecodedSelectorLines, std::optional<qc::Qubit> selectLine, std::size_t firstCase, std::size_t nCases, const std::function<bool(std::size_t)>& onCase);
+        bool                      onDynamicallyIndexedVariableRead(const VariableAccess::ptr& var, std::vector<qc::Qubit>& lines);
+        bool                      onDynamicallyIndexedVariableUpdate(const VariableAccess::ptr& var, const std::function<bool(const std::vector<qc::Qubit>&)>& update);
+        bool                      onAssignment(const AssignStatement& statement, std::vector<qc::Qubit> lhs);
 
         [[nodiscard]] std::optional<qc::Qubit> getConstantLine(bool value);
         [[nodiscard]] bool                     getConstantLines(unsigned bitwidth, unsigned value, std::vector<qc::Qubit>& lines);
+        // Returns an ancillary qubit that was restored to the given value to the pool used by getConstantLine
+        void releaseConstantLine(qc::Qubit line, bool value);
 
         std::stack<Statement::ptr>    stmts;
         Number::loop_variable_mapping loopMap;
@@ -130,9 +205,22 @@ namespace syrec {
 
         AnnotatableQuantumComputation& annotatableQuantumComputation; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
 
+        ComparatorImplementation  comparatorImplementation      = ComparatorImplementation::SubtractAndRestore;
+        bool                      useMctForEqualityWithConstant = false;
+        IncrementerImplementation incrementerImplementation     = IncrementerImplementation::CostBased;
+
+        // Called after the synthesis of a statement whenever at least memorySamplingInterval gates were added since the last call (if set)
+        std::function<void()> sampleMemory;
+        std::size_t           memorySamplingInterval        = 0U;
+        std::size_t           nOperationsAtLastMemorySample = 0U;
+
+        // Memory of the bookkeeping of the synthesis, i.e. the qubits of the variables, the values of the loop variables, the free constant lines and the statements and modules being synthesized
+        [[nodiscard]] MemoryReport memoryReport() const;
+
     private:
         VarLinesMap                            varLines;
         std::map<bool, std::vector<qc::Qubit>> freeConstLinesMap;
+        std::map<std::string, std::size_t>     nInstancesOfModule;
     };
 
 } // namespace syrec
@@ -10,9 +10,11 @@
 
 #pragma once
 
+#include "core/memory_report.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
 #include "ir/operations/Operation.hpp"
 
 #include <cstddef>
@@ -77,6 +79,45 @@ namespace syrec {
         [[nodiscard]] SynthesisCostMetricValue          getQuantumCostForSynthesis() const;
         [[nodiscard]] SynthesisCostMetricValue          getTransistorCostForSynthesis() const;
 
+        /**
+         * Determine the quantum cost of a single quantum operation as accounted for by \see AnnotatableQuantumComputation#getQuantumCostForSynthesis.
+         *
+         * @remarks The cost only depends on the number of control qubits, the type of the operation and the number of qubits of the quantum computation,
+         * thus the cost of a modified quantum computation can be updated incrementally.
+         * @param numControlQubits The number of control qubits of the quantum operation.
+         * @param operationType The type of the quantum operation.
+         * @param numQubits The number of qubits of the quantum computation.
+         * @return The quantum cost of the quantum operation.
+         */
+        [[nodiscard]] static SynthesisCostMetricValue getQuantumCostOfOperationForSynthesis(std::size_t numControlQubits, qc::OpType operationType, std::size_t numQubits);
+
+        /**
+         * Determine the memory used by the quantum computation.
+         *
+         * @remarks The report distinguishes between the quantum operations (including their control and target qubits), the qubit labels and registers,
+         * the annotations of the quantum operations (including the global ones) and the data used for the propagation of control qubits.
+         * @return The memory report with one category per kind of data.
+         */
+        [[nodiscard]] MemoryReport memoryReport() const;
+
+        /**
+         * The state of the incremental accounting of the memory used by the quantum computation, \see AnnotatableQuantumComputation#sampleMemoryBytes.
+         */
+        struct MemorySampler {
+            std::size_t nAccountedQuantumOperations       = 0U;
+            std::size_t bytesOfAccountedQuantumOperations = 0U;
+        };
+
+        /**
+         * Determine the number of bytes used by the quantum computation, i.e. the total bytes of \see AnnotatableQuantumComputation#memoryReport, without walking all quantum operations.
+         *
+         * @remarks Only the quantum operations (and their annotations) added since the last call with the same sampler are walked, thus an update of the annotations of an already accounted quantum operation is not considered.
+         * The bytes of the qubit registers are accounted when the qubits are added while the data used for the propagation of control qubits and the global annotations are walked on every call.
+         * @param sampler The state of the accounting which is updated by the call.
+         * @return The number of bytes in use.
+         */
+        [[nodiscard]] std::size_t sampleMemoryBytes(MemorySampler& sampler) const;
+
         /**
          * Activate a new control qubit propagation scope.
          *
@@ -119,6 +160,12 @@ namespace syrec {
          */
         [[maybe_unused]] bool registerControlQubitForPropagationInCurrentAndNestedScopes(qc::Qubit controlQubit);
 
+        /**
+         * Return the aggregate of the control qubits registered in all active control qubit propagation scopes, i.e. the control qubits added to any quantum operation created by any of the addOperationsImplementingXGate functions.
+         * @return The currently propagated control qubits.
+         */
+        [[nodiscard]] const std::unordered_set<qc::Qubit>& getPropagatedControlQubits() const { return aggregateOfPropagatedControlQubits; }
+
         /**
          * Register or update a global quantum operation annotation. Global quantum operation annotations are added to all quantum operations added to the internally used qc::QuantumComputation.
          * Already existing quantum computations in the qc::QuantumComputation are not modified.
@@ -148,6 +195,10 @@ namespace syrec {
         [[maybe_unused]] bool annotateAllQuantumOperationsAtPositions(std::size_t fromQuantumOperationIndex, std::size_t toQuantumOperationIndex, const QuantumOperationAnnotationsLookup& userProvidedAnnotationsPerQuantumOperation);
         [[nodiscard]] bool    isQubitWithinRange(qc::Qubit qubit) const noexcept;
 
+        [[nodiscard]] static std::size_t bytesOfQuantumOperation(const qc::Operation& quantumOperation);
+        [[nodiscard]] static std::size_t bytesOfAnnotation(const QuantumOperationAnnotationsLookup::value_type& annotation);
+        [[nodiscard]] std::size_t        bytesOfQubitRegister(const std::string& qubitLabel) const;
+
         std::unordered_set<qc::Qubit>                    aggregateOfPropagatedControlQubits;
         std::vector<std::unordered_map<qc::Qubit, bool>> controlQubitPropgationScopes;
         bool                                             canQubitsBeAddedToQuantumComputation = true;
@@ -161,5 +212,7 @@ namespace syrec {
         // as the search key in the container storing the annotations per quantum operation.
         std::vector<QuantumOperationAnnotationsLookup> annotationsPerQuantumOperation;
         std::unordered_set<qc::Qubit>                  addedAncillaryQubitIndices;
+        // The bytes of the registers of the qubits added via addNonAncillaryQubit and addPreliminaryAncillaryQubit, \see AnnotatableQuantumComputation#sampleMemoryBytes
+        std::size_t bytesOfQubitRegisters = 0U;
     };
 } // namespace syrec
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Layout of the gates of a circuit in columns which can be queried at different levels of detail (e.g. to draw circuits with millions of gates).
+     *
+     * The gates are placed as soon as possible, i.e. every gate is placed in the first column after the last gate overlapping it. A gate occupies all
+     * lines between its first and its last qubit (since the vertical line of a gate crosses them), thus gates in the same column can be drawn without overlaps.
+     * The layout is computed once on construction, afterwards tiles of the layout can be queried in time linear in the number of gates in their column range.
+     */
+    class CircuitLayout {
+    public:
+        // sentinel of the representative of a cell not covered by any gate
+        static constexpr std::int64_t NO_GATE = -1;
+
+        /**
+         * Aggregated view of the columns [columnBegin, columnBegin + nColumnBuckets * columnResolution) and lines [lineBegin, lineBegin + nLineBuckets * lineResolution)
+         * in which every cell aggregates columnResolution columns and lineResolution lines. The cells are stored row-major, i.e. the cell of line bucket l and
+         * column bucket c is stored at index l * nColumnBuckets + c.
+         */
+        struct Tile {
+            std::size_t columnBegin      = 0U;
+            std::size_t columnResolution = 1U;
+            std::size_t nColumnBuckets   = 0U;
+            std::size_t lineBegin        = 0U;
+            std::size_t lineResolution   = 1U;
+            std::size_t nLineBuckets     = 0U;
+            // number of gates covering a line of the cell
+            std::vector<std::uint32_t> counts;
+            // index of the first gate (in the order of the circuit) covering a line of the cell, NO_GATE for empty cells
+            std::vector<std::int64_t> representatives;
+        };
+
+        explicit CircuitLayout(const qc::QuantumComputation& quantumComputation);
+
+        [[nodiscard]] std::size_t getNcolumns() const {
+            return columnOffsets.size() - 1U;
+        }
+
+        [[nodiscard]] std::size_t getNqubits() const {
+            return nQubits;
+        }
+
+        [[nodiscard]] std::size_t getNgates() const {
+            return columns.size();
+        }
+
+        // column of every gate in the order of the circuit
+        [[nodiscard]] const std::vector<std::size_t>& getColumns() const {
+            return columns;
+        }
+
+        // first and last line occupied by every gate in the order of the circuit (the first line of a gate without qubits is greater than its last line, it is placed in column 0)
+        [[nodiscard]] const std::vector<qc::Qubit>& getFirstLines() const {
+            return firstLines;
+        }
+
+        [[nodiscard]] const std::vector<qc::Qubit>& getLastLines() const {
+            return lastLines;
+        }
+
+        // indices of the gates placed in the given column in the order of the circuit
+        [[nodiscard]] std::vector<std::size_t> gatesInColumn(std::size_t column) const;
+
+        /**
+         * Aggregate the columns [columnBegin, columnEnd) and lines [lineBegin, lineEnd) of the layout. The ranges are clipped to the layout, the last bucket of each
+         * dimension may be partially covered by the range.
+         * @throws std::invalid_argument if a resolution is zero or a range is empty or reversed.
+         */
+        [[nodiscard]] Tile tile(std::size_t columnBegin, std::size_t columnEnd, std::size_t columnResolution = 1U, std::size_t lineBegin = 0U,
+                                std::size_t lineEnd = static_cast<std::size_t>(-1), std::size_t lineResolution = 1U) const;
+
+    private:
+        std::size_t              nQubits = 0U;
+        std::vector<std::size_t> columns;
+        std::vector<qc::Qubit>   firstLines;
+        std::vector<qc::Qubit>   lastLines;
+        // the gates of column c are gatesByColumn[columnOffsets[c]], ..., gatesByColumn[columnOffsets[c + 1] - 1]
+        std::vector<std::size_t> columnOffsets{0U};
+        std::vector<std::size_t> gatesByColumn;
+    };
+} // namespace syrec
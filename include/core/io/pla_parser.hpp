@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "core/truthTable/bdd_truth_table.hpp"
 #include "core/truthTable/truth_table.hpp"
 
 #include <stdexcept>
@@ -23,8 +24,13 @@ namespace syrec {
 
     void parsePla(TruthTable& tt, std::istream& in);
 
+    void parsePla(BddTruthTable& tt, std::istream& in);
+
     auto extend(TruthTable& tt) -> void;
 
     bool readPla(TruthTable& tt, const std::string& filename);
 
+    // reads the pla into BDDs, i.e., the truth table is never extended
+    bool readPla(BddTruthTable& tt, const std::string& filename);
+
 } // namespace syrec
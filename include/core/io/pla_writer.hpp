@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+namespace syrec {
+
+    struct PlaWriterSettings {
+        // whether the input cubes with the same output are merged into larger cubes
+        bool mergeCubes = true;
+        // whether the cubes with an all-zero output are left out, which readPla restores when extending the truth table
+        bool omitZeroOutputs = false;
+        // number of threads merging the cubes of the different outputs (0 to use one thread per hardware thread)
+        std::size_t nThreads = 0U;
+        // number of bytes the output is buffered in before it is written to the stream
+        std::size_t chunkSize = 1U << 20U;
+    };
+
+    /**
+     * Write the truth table in PLA format (\see parsePla).
+     *
+     * The input cubes are grouped by their output. Two cubes of a group that differ only in the value of one input are merged into a cube with a
+     * don't care at the input, which is repeated for all inputs until no more cubes can be merged. Since a cube is merged with at most one other cube
+     * per input, the merged cubes of a group cover the same inputs as the original ones and stay disjoint, i.e. reading and extending the written truth
+     * table (\see readPla) yields the extended original one. The groups are merged in parallel, the rows are buffered in chunks of the given size.
+     *
+     * @param tt The truth table.
+     * @param os The stream the PLA is written to.
+     * @param settings The settings of the writer.
+     * @param statistics <table border="0" width="100%">
+     *   <tr>
+     *     <td class="indexkey">Information</td>
+     *     <td class="indexkey">Type</td>
+     *     <td class="indexkey">Description</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">input_cubes</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of cubes of the truth table.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">cubes</td>
+     *     <td class="indexvalue">std::uint64_t</td>
+     *     <td class="indexvalue">Number of cubes written.</td>
+     *   </tr>
+     *   <tr>
+     *     <td class="indexvalue">runtime</td>
+     *     <td class="indexvalue">double</td>
+     *     <td class="indexvalue">Run-time consumed by the algorithm in milliseconds.</td>
+     *   </tr>
+     * </table>
+     */
+    void writePla(const TruthTable& tt, std::ostream& os, const PlaWriterSettings& settings = PlaWriterSettings{}, const Properties::ptr& statistics = Properties::ptr());
+
+    bool writePla(const TruthTable& tt, const std::string& filename, const PlaWriterSettings& settings = PlaWriterSettings{}, const Properties::ptr& statistics = Properties::ptr());
+
+} // namespace syrec
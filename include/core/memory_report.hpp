@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Memory footprint of a data structure split into categories (e.g. "ir.statements" or "qc.operations").
+     *
+     * The bytes of a category are accounted by walking the data structure and summing up the sizes of its objects and of the heap buffers owned by them,
+     * thus the report is independent of the used allocator and does not incur any overhead as long as no report is requested.
+     * The overhead of the nodes of standard library containers is estimated.
+     */
+    class MemoryReport {
+    public:
+        struct Usage {
+            std::size_t bytes   = 0U;
+            std::size_t objects = 0U;
+        };
+
+        /**
+         * Account objects in a category.
+         * @param category The name of the category, subsystems are separated from the category name by a dot.
+         * @param bytes The number of bytes used by the objects.
+         * @param objects The number of accounted objects.
+         */
+        void add(const std::string& category, std::size_t bytes, std::size_t objects = 1U);
+
+        /**
+         * Add the categories and phases of another report to this one.
+         */
+        void merge(const MemoryReport& other);
+
+        /**
+         * Record the memory used during a phase. Only the peak of all records of a phase is kept.
+         * @param phase The name of the phase. Phases are reported in the order of their first record.
+         * @param bytes The number of bytes in use.
+         */
+        void recordPhase(const std::string& phase, std::size_t bytes);
+
+        [[nodiscard]] const std::map<std::string, Usage>& getCategories() const {
+            return categories;
+        }
+
+        [[nodiscard]] const std::vector<std::pair<std::string, std::size_t>>& getPeakBytesPerPhase() const {
+            return peakBytesPerPhase;
+        }
+
+        [[nodiscard]] std::size_t totalBytes() const;
+        [[nodiscard]] std::size_t totalObjects() const;
+        [[nodiscard]] std::string toString() const;
+
+        // Heap memory owned by a std::string (zero if the small string optimization applies)
+        [[nodiscard]] static std::size_t dynamicBytes(const std::string& str);
+
+        // Estimated overhead of a node of a std::map/std::set and of a std::unordered_map/std::unordered_set, respectively
+        static constexpr std::size_t ORDERED_CONTAINER_NODE_OVERHEAD   = 4U * sizeof(void*);
+        static constexpr std::size_t UNORDERED_CONTAINER_NODE_OVERHEAD = 2U * sizeof(void*);
+        // Estimated size of the control block of a std::shared_ptr
+        static constexpr std::size_t SHARED_POINTER_CONTROL_BLOCK_SIZE = 2U * sizeof(void*);
+
+    private:
+        std::map<std::string, Usage>                     categories;
+        std::vector<std::pair<std::string, std::size_t>> peakBytesPerPhase;
+    };
+} // namespace syrec
@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace syrec {
+    /**
+     * Number of threads used by parallelFor for the items, i.e. nThreads (0 for one thread per hardware thread) but at least one and at most one per item.
+     */
+    [[nodiscard]] std::size_t parallelForThreads(std::size_t nItems, std::size_t nThreads);
+
+    /**
+     * Calls fn(item, thread) for every item < nItems on parallelForThreads(nItems, nThreads) threads, the calling thread being thread 0.
+     *
+     * Every thread repeatedly takes the next item not taken yet, thus the items are taken in increasing order. The index of the thread allows fn to reuse a state
+     * of the thread (e.g. buffers or a DD package) for all its items. An exception thrown by fn stops the threads from taking further items, the first one is
+     * rethrown once all threads have finished.
+     */
+    void parallelForPerThread(std::size_t nItems, std::size_t nThreads, const std::function<void(std::size_t, std::size_t)>& fn);
+
+    /**
+     * Calls fn(item) for every item < nItems on parallelForThreads(nItems, nThreads) threads (\see parallelForPerThread).
+     */
+    void parallelFor(std::size_t nItems, std::size_t nThreads, const std::function<void(std::size_t)>& fn);
+} // namespace syrec
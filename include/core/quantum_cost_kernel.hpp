@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace syrec {
+    /**
+     * Evaluation of the quantum cost (\see AnnotatableQuantumComputation#getQuantumCostForSynthesis) of arbitrary ranges and groups of the gates of a circuit.
+     *
+     * The cost of a gate only depends on its number of effective controls (the controls of a gate plus one for SWAP gates, limited by the number of qubits),
+     * since the number of free lines follows from the number of qubits of the circuit. The number of effective controls of all gates is packed into an array
+     * on construction, thus the cost of a range of gates is obtained without accessing the operations by counting the gates per number of effective controls
+     * and weighting these counts with a table of the cost per number of effective controls. For up to 16 different numbers of effective controls, the gates are counted
+     * by comparing eight numbers at once (using SSE2 where available), otherwise by incrementing interleaved partial histograms.
+     */
+    class QuantumCostKernel {
+    public:
+        using Cost = AnnotatableQuantumComputation::SynthesisCostMetricValue;
+
+        // the number of effective controls of a gate is stored in 16 bits
+        static constexpr std::size_t MAX_QUBITS = 65536U;
+
+        /**
+         * @throws std::invalid_argument if the circuit has more than MAX_QUBITS qubits.
+         */
+        explicit QuantumCostKernel(const qc::QuantumComputation& quantumComputation);
+
+        [[nodiscard]] std::size_t getNgates() const {
+            return effectiveControls.size();
+        }
+
+        // cost of a gate per number of effective controls, up to the largest number of effective controls of a gate
+        [[nodiscard]] const std::vector<Cost>& getCostTable() const {
+            return costTable;
+        }
+
+        /**
+         * Count the gates [begin, end) per number of effective controls.
+         * @throws std::invalid_argument if the range is invalid.
+         */
+        [[nodiscard]] std::vector<std::uint64_t> histogram(std::size_t begin, std::size_t end) const;
+
+        /**
+         * Determine the quantum cost of the gates [begin, end).
+         * @throws std::invalid_argument if the range is invalid.
+         */
+        [[nodiscard]] Cost cost(std::size_t begin, std::size_t end) const;
+
+        [[nodiscard]] Cost cost() const {
+            return cost(0U, getNgates());
+        }
+
+        /**
+         * Determine the quantum cost per group of gates.
+         * @param groupOfGate The group of every gate, each group has to be smaller than nGroups.
+         * @throws std::invalid_argument if the number of groups does not match the number of gates or a group is invalid.
+         */
+        [[nodiscard]] std::vector<Cost> costPerGroup(const std::vector<std::uint32_t>& groupOfGate, std::size_t nGroups) const;
+
+        /**
+         * Determine the quantum cost of the gates grouped by the value of an annotation (e.g. the line number of the statement the gates were synthesized for).
+         * The gates without the annotation are accounted for the empty value.
+         * @throws std::invalid_argument if the circuit does not have as many gates as the circuit the kernel was built for.
+         */
+        [[nodiscard]] std::map<std::string, Cost> costPerAnnotation(const AnnotatableQuantumComputation& quantumComputation, std::string_view annotationKey) const;
+
+    private:
+        std::vector<std::uint16_t> effectiveControls;
+        std::vector<Cost>          costTable;
+
+        void checkRange(std::size_t begin, std::size_t end) const;
+    };
+} // namespace syrec
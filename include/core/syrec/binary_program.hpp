@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/syrec/program.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+
+namespace syrec {
+
+    /**
+     * Precompiled binary representation of the IR of a SyReC program.
+     *
+     * The file starts with a header (magic number, format version and the hash of the source the IR was parsed from) followed by a table of all interned names
+     * and the IR nodes (modules, numbers, variables, variable accesses, expressions and statements) in post-order.
+     * A node references its children by their index in the node list and the names by their index in the string table, all integers are stored as LEB128 varints.
+     * IR nodes shared by multiple parents (e.g. the variables of a module or the statements of a reversed module) are stored once, thus the loader
+     * reconstructs the IR including the sharing of nodes and the line numbers of the statements in a single linear pass.
+     */
+
+    // hash of the source of a program, the settings influencing the parsing are part of the hash
+    [[nodiscard]] std::uint64_t sourceHash(const std::string& content, const ReadProgramSettings& settings = ReadProgramSettings{});
+
+    /**
+     * Write the IR of a program in the binary format.
+     *
+     * @param program The program to serialize
+     * @param hash The hash of the source of the program (see sourceHash) which is stored in the header
+     * @param os The output stream (should be opened in binary mode)
+     * @return true if the program could be written, otherwise false
+     */
+    bool writeBinaryProgram(const Program& program, std::uint64_t hash, std::ostream& os);
+
+    bool writeBinaryProgram(const Program& program, std::uint64_t hash, const std::string& filename);
+
+    /**
+     * Read the IR of a program from the binary format.
+     *
+     * The modules are only added to the program if the whole IR could be read.
+     * @param program The program to which the modules are added
+     * @param is The input stream (should be opened in binary mode)
+     * @param expectedHash If set, the binary is rejected if it was not created from a source with this hash
+     * @return The error message, empty if the IR was read successfully
+     */
+    std::string readBinaryProgram(Program& program, std::istream& is, std::optional<std::uint64_t> expectedHash = std::nullopt);
+
+    std::string readBinaryProgram(Program& program, const std::string& filename, std::optional<std::uint64_t> expectedHash = std::nullopt);
+
+    /**
+     * Read a program from its source using a precompiled binary as cache.
+     *
+     * If the binary exists and was created from the current source (and settings), the IR is loaded from it without parsing the source.
+     * Otherwise, the source is parsed and the binary is (re)written. Failing to write the binary does not cause the reading to fail.
+     * @return The error message of the parser, empty if the program was read successfully
+     */
+    std::string readProgramWithCache(Program& program, const std::string& sourceFilename, const std::string& cacheFilename, ReadProgramSettings settings = ReadProgramSettings{});
+
+} // namespace syrec
@@ -195,7 +195,7 @@ namespace syrec {
             using qi::uint_;
 
             // Helpers
-            identifier %= lexeme[+(alnum | '_')];
+            identifier %= lexeme[+(alnum | char_('_'))];
 
             programRule %= +moduleRule;
 
@@ -72,10 +72,24 @@ namespace syrec {
                     return var;
                 }
             }
+            for (Variable::ptr var: variables) {
+                if (var->name == n) {
+                    return var;
+                }
+            }
 
             return {};
         }
 
+        /**
+       * @brief Adds a local (state or wire) variable to the module
+       *
+       * @param variable Variable
+       */
+        void addVariable(const Variable::ptr& variable) {
+            variables.emplace_back(variable);
+        }
+
         /**
        * @brief Adds a statement to the module
        *
@@ -18,7 +18,9 @@
 #include "core/syrec/statement.hpp"
 #include "core/syrec/variable.hpp"
 
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace syrec {
 
@@ -32,6 +34,10 @@ namespace syrec {
         const ReadProgramSettings& settings;
         std::string                errorMessage;
         std::vector<std::string>   loopVariables;
+        // number of lines preceding begin in the parsed source
+        unsigned lineNumberOffset{0U};
+        // resolves the module of a (un)call statement, the modules of the program being parsed are searched if not set
+        std::function<Module::ptr(const std::string&)> findModule;
     };
 
     bool parseModule(Module& proc, const ast_module& astProc, const Program& prog, ParserContext& context);
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "core/memory_report.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/grammar.hpp"
 #include "core/syrec/module.hpp"
@@ -18,6 +19,7 @@
 #include "core/syrec/variable.hpp"
 
 #include <fstream>
+#include <string>
 #include <vector>
 
 namespace syrec {
@@ -26,6 +28,16 @@ namespace syrec {
         explicit ReadProgramSettings(unsigned bitwidth = 32U):
             defaultBitwidth(bitwidth) {};
         unsigned defaultBitwidth;
+        // Split the source at the top-level module keywords, parse the modules concurrently and link the called modules afterwards.
+        // The resulting program and the error messages are the same as the ones of the sequential parser.
+        bool parallelParsing = false;
+        // Number of threads used by the parallel parsing, 0 uses the number of hardware threads
+        unsigned nThreads = 0U;
+        // Only parse the modules reachable from the main module via (un)call statements, the other modules are merely located by a scan of the source and not checked for errors.
+        // The modules of the resulting program keep the order of the source. Takes precedence over the parallel parsing, which then only parses the reachable modules concurrently.
+        bool lazyLoading = false;
+        // Main module of the lazy loading, defaults to the module 'main' or the first module like the main_module setting of the synthesis
+        std::string mainModule;
     };
 
     class Program {
@@ -50,10 +62,35 @@ namespace syrec {
             return {};
         }
 
+        // Main module the program was loaded for by the lazy loading, empty if it defaults to the module 'main' or the first module
+        [[nodiscard]] const std::string& mainModule() const {
+            return mainModuleName;
+        }
+
+        void setMainModule(const std::string& name) {
+            mainModuleName = name;
+        }
+
         std::string read(const std::string& filename, ReadProgramSettings settings = ReadProgramSettings{});
 
+        /**
+         * Read the program from the SyReC source in the string like \see read.
+         *
+         * @return The error message, empty if the program was read successfully.
+         */
+        std::string readFromString(const std::string& content, const ReadProgramSettings& settings = ReadProgramSettings{});
+
+        /**
+         * Determine the memory used by the IR of the program (modules, variables, statements, expressions, variable accesses and numbers).
+         *
+         * IR nodes shared by multiple parents (i.e. the statements of a reversed module) are only accounted once.
+         * @return The memory report with one category per kind of IR node.
+         */
+        [[nodiscard]] MemoryReport memoryReport() const;
+
     private:
         Module::vec modulesVec;
+        std::string mainModuleName;
 
         /**
         * @brief Parser for a SyReC program
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/memory_report.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace syrec {
+
+    /**
+     * A minimal package for reduced ordered binary decision diagrams (BDDs).
+     *
+     * Nodes are identified by their index in the package and are never freed, thus a package should be shared between all BDDs of a function (or a batch of related functions).
+     * The variable with the smallest index is located closest to the root of a BDD.
+     */
+    class BddPackage {
+    public:
+        using Node = std::uint32_t;
+
+        static constexpr Node        ZERO              = 0U;
+        static constexpr Node        ONE               = 1U;
+        static constexpr std::size_t TERMINAL_VARIABLE = std::numeric_limits<std::size_t>::max();
+
+        BddPackage();
+
+        [[nodiscard]] static auto isTerminal(const Node f) -> bool {
+            return f == ZERO || f == ONE;
+        }
+
+        [[nodiscard]] auto variable(const Node f) const -> std::size_t {
+            return nodes[f].variable;
+        }
+
+        [[nodiscard]] auto low(const Node f) const -> Node {
+            return nodes[f].low;
+        }
+
+        [[nodiscard]] auto high(const Node f) const -> Node {
+            return nodes[f].high;
+        }
+
+        // Number of nodes (including the two terminals) stored in the package
+        [[nodiscard]] auto size() const -> std::size_t {
+            return nodes.size();
+        }
+
+        auto makeNode(std::size_t variable, Node low, Node high) -> Node;
+
+        auto makeVariable(const std::size_t variable) -> Node {
+            return makeNode(variable, ZERO, ONE);
+        }
+
+        auto ite(Node f, Node g, Node h) -> Node;
+
+        auto negate(const Node f) -> Node {
+            return ite(f, ZERO, ONE);
+        }
+
+        auto conjunction(const Node f, const Node g) -> Node {
+            return ite(f, g, ZERO);
+        }
+
+        auto disjunction(const Node f, const Node g) -> Node {
+            return ite(f, ONE, g);
+        }
+
+        auto exclusiveOr(const Node f, const Node g) -> Node {
+            return ite(f, negate(g), g);
+        }
+
+        // Restricts the given variable of f to the given value
+        auto cofactor(Node f, std::size_t variable, bool value) -> Node;
+
+        // Conjunction of the literals of a cube (ordered from the variable firstVariable onwards), don't care values are skipped
+        auto fromCube(const TruthTable::Cube& cube, std::size_t firstVariable = 0U) -> Node;
+
+        // Renames every variable v of f to v + offset
+        auto shiftVariables(Node f, std::size_t offset) -> Node;
+
+        // Copies the BDD f of another package into this package
+        auto import(const BddPackage& other, Node f) -> Node;
+
+        auto clearComputeTable() -> void {
+            iteComputeTable.clear();
+        }
+
+        // memory used by the nodes, the unique table and the compute table of the package
+        [[nodiscard]] auto memoryReport() const -> MemoryReport;
+
+    private:
+        struct BddNode {
+            std::size_t variable;
+            Node        low;
+            Node        high;
+        };
+
+        using Key = std::array<std::size_t, 3>;
+        struct KeyHash {
+            auto operator()(const Key& key) const noexcept -> std::size_t {
+                std::size_t seed = 0U;
+                for (const auto value: key) {
+                    seed ^= std::hash<std::size_t>{}(value) + 0x9e3779b97f4a7c15ULL + (seed << 6U) + (seed >> 2U);
+                }
+                return seed;
+            }
+        };
+
+        std::vector<BddNode>                   nodes;
+        std::unordered_map<Key, Node, KeyHash> uniqueTable;
+        std::unordered_map<Key, Node, KeyHash> iteComputeTable;
+
+        [[nodiscard]] auto topCofactor(Node f, std::size_t topVariable, bool value) const -> Node;
+    };
+
+} // namespace syrec
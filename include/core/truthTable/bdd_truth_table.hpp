@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "core/memory_report.hpp"
+#include "core/truthTable/bdd_package.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+
+    /**
+     * Truth table storing each output as a pair of BDDs (on-set and don't care set) over the inputs instead of enumerating its cubes.
+     *
+     * The input at position i of a cube corresponds to the BDD variable i (i.e. the most significant input is located at the root).
+     * Inputs not covered by any cube map to the all-zero output (as for an extended TruthTable), the domain BDD restricts the inputs
+     * to the ones whose constant lines are set to zero.
+     * The outputs of overlapping cubes are ORed (as by extend for a TruthTable), i.e. an output is one for an input if any cube covering the input
+     * sets it and a don't care if any covering cube leaves it unspecified but none sets it.
+     */
+    class BddTruthTable {
+    public:
+        explicit BddTruthTable(std::shared_ptr<BddPackage> package = std::make_shared<BddPackage>()):
+            package(std::move(package)) {}
+
+        // initializes an empty table with all outputs being zero for every input
+        auto resize(std::size_t nInputs, std::size_t nOutputs) -> void;
+
+        // adds the inputs of the cube to the on-sets and don't care sets of the outputs
+        auto try_emplace(const TruthTable::Cube& input, const TruthTable::Cube& output) -> void; // NOLINT(readability-identifier-naming) keeping same Interface as TruthTable
+
+        [[nodiscard]] auto nInputs() const -> std::size_t {
+            return inputs;
+        }
+
+        [[nodiscard]] auto nOutputs() const -> std::size_t {
+            return onSets.size();
+        }
+
+        [[nodiscard]] auto nPrimaryInputs() const -> std::size_t {
+            return static_cast<std::size_t>(std::count(constants.begin(), constants.end(), false));
+        }
+
+        [[nodiscard]] auto nPrimaryOutputs() const -> std::size_t {
+            return static_cast<std::size_t>(std::count(garbage.begin(), garbage.end(), false));
+        }
+
+        [[nodiscard]] auto empty() const -> bool {
+            return inputs == 0U && onSets.empty();
+        }
+
+        [[nodiscard]] auto getPackage() const -> const std::shared_ptr<BddPackage>& {
+            return package;
+        }
+
+        [[nodiscard]] auto domain() const -> BddPackage::Node {
+            return inputDomain;
+        }
+
+        [[nodiscard]] auto onSet(const std::size_t output) const -> BddPackage::Node {
+            return onSets[output];
+        }
+
+        [[nodiscard]] auto dontCareSet(const std::size_t output) const -> BddPackage::Node {
+            return dontCareSets[output];
+        }
+
+        // inputs for which the value of the output is specified (the result is built in the package of the table)
+        [[nodiscard]] auto careSet(std::size_t output) -> BddPackage::Node;
+
+        [[nodiscard]] auto getConstants() const -> const std::vector<bool>& {
+            return constants;
+        }
+
+        [[nodiscard]] auto getGarbage() const -> const std::vector<bool>& {
+            return garbage;
+        }
+
+        [[nodiscard]] auto getConstants() -> std::vector<bool>& {
+            return constants;
+        }
+
+        [[nodiscard]] auto getGarbage() -> std::vector<bool>& {
+            return garbage;
+        }
+
+        // inserts (at the most significant position) or appends (at the least significant position) constant zero inputs
+        auto addConstantInputs(std::size_t n, bool append) -> void;
+
+        // inserts (at the most significant position) or appends (at the least significant position) constant zero outputs
+        auto addConstantOutputs(std::size_t n, bool append) -> void;
+
+        // number of inputs mapped to each output pattern (a don't care output is part of the pattern), throws if a number does not fit into 64 bits
+        [[nodiscard]] auto outputPatternFrequencies() const -> std::map<TruthTable::Cube, std::uint64_t>;
+
+        // unlike for an extended TruthTable, this is not limited to functions with less than 64 inputs
+        [[nodiscard]] auto minimumAdditionalLinesRequired() const -> std::size_t;
+
+        // memory used by the truth table including its (possibly shared) BDD package
+        [[nodiscard]] auto memoryReport() const -> MemoryReport;
+
+        // garbage outputs of either truth table are ignored, the packages of the truth tables are not modified
+        static auto equal(BddTruthTable const& tt1, BddTruthTable const& tt2, bool equalityUpToDontCare = true) -> bool;
+
+    private:
+        std::shared_ptr<BddPackage>   package;
+        std::size_t                   inputs      = 0U;
+        BddPackage::Node              inputDomain = BddPackage::ONE;
+        std::vector<BddPackage::Node> onSets;
+        std::vector<BddPackage::Node> dontCareSets;
+        std::vector<bool>             constants;
+        std::vector<bool>             garbage;
+    };
+
+    // BddTruthTable counterpart of the augmentWithConstants function used by the DDSynthesizer
+    auto augmentWithConstants(BddTruthTable& tt, std::size_t const& nBits, bool appendZero = false) -> void;
+
+} // namespace syrec
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "core/memory_report.hpp"
 #include "dd/Package.hpp"
 
 #include <algorithm>
@@ -406,6 +407,9 @@ namespace syrec {
 
         [[nodiscard]] auto minimumAdditionalLinesRequired() const -> std::size_t;
 
+        // memory used by the cubes (and the constant and garbage flags) of the truth table
+        [[nodiscard]] auto memoryReport() const -> MemoryReport;
+
         auto clear() -> void {
             cubeMap.clear();
         }
@@ -0,0 +1,409 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/loop_invariant_code_motion.hpp"
+
+#include "algorithms/optimization/statement_analysis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // Adds the names of the loop variables referenced by the number, the variable access or the expression
+    void addLoopVariables(const Number::ptr& number, std::unordered_set<std::string>& loopVariables) {
+        if (number && number->isLoopVariable()) {
+            loopVariables.emplace(number->variableName());
+        }
+    }
+
+    void addLoopVariables(const Expression::ptr& expression, std::unordered_set<std::string>& loopVariables);
+
+    void addLoopVariables(const VariableAccess::ptr& access, std::unordered_set<std::string>& loopVariables) {
+        if (access->range.has_value()) {
+            addLoopVariables(access->range->first, loopVariables);
+            addLoopVariables(access->range->second, loopVariables);
+        }
+        for (const auto& index: access->indexes) {
+            addLoopVariables(index, loopVariables);
+        }
+    }
+
+    void addLoopVariables(const Expression::ptr& expression, std::unordered_set<std::string>& loopVariables) {
+        if (const auto* numeric = dynamic_cast<const NumericExpression*>(expression.get()); numeric != nullptr) {
+            addLoopVariables(numeric->value, loopVariables);
+        } else if (const auto* variable = dynamic_cast<const VariableExpression*>(expression.get()); variable != nullptr) {
+            addLoopVariables(variable->var, loopVariables);
+        } else if (const auto* binary = dynamic_cast<const BinaryExpression*>(expression.get()); binary != nullptr) {
+            addLoopVariables(binary->lhs, loopVariables);
+            addLoopVariables(binary->rhs, loopVariables);
+        } else if (const auto* shift = dynamic_cast<const ShiftExpression*>(expression.get()); shift != nullptr) {
+            addLoopVariables(shift->lhs, loopVariables);
+            addLoopVariables(shift->rhs, loopVariables);
+        }
+    }
+
+    // Adds the loop variables of the for statements nested in the statements
+    void addNestedLoopVariables(const Statement::vec& statements, std::unordered_set<std::string>& loopVariables) {
+        for (const auto& statement: statements) {
+            if (const auto* forStat = dynamic_cast<const ForStatement*>(statement.get()); forStat != nullptr) {
+                if (!forStat->loopVariable.empty()) {
+                    loopVariables.emplace(forStat->loopVariable);
+                }
+                addNestedLoopVariables(forStat->statements, loopVariables);
+            } else if (const auto* ifStat = dynamic_cast<const IfStatement*>(statement.get()); ifStat != nullptr) {
+                addNestedLoopVariables(ifStat->thenStatements, loopVariables);
+                addNestedLoopVariables(ifStat->elseStatements, loopVariables);
+            }
+        }
+    }
+
+    // The number of iterations of the unrolled for statement (with the defaults of the synthesis), std::nullopt if a bound is no constant
+    std::optional<std::size_t> numberOfIterations(const ForStatement& statement) {
+        const auto& [nFrom, nTo] = statement.range;
+        if ((nFrom && !nFrom->isConstant()) || !nTo || !nTo->isConstant() || (statement.step && !statement.step->isConstant())) {
+            return std::nullopt;
+        }
+        const std::size_t from = nFrom ? nFrom->evaluate({}) : 1U;
+        const std::size_t to   = nTo->evaluate({});
+        const std::size_t step = statement.step ? statement.step->evaluate({}) : 1U;
+        if (step == 0U) {
+            return std::nullopt;
+        }
+        return (from <= to ? to - from : from - to) / step + 1U;
+    }
+
+    /*
+     * Calls replace for the binary and shift (sub)expressions of the expression from the outermost one, whose subexpressions are only visited if replace returns nullptr.
+     * Returns the expression replacing the expression, nullptr if it is not modified.
+     */
+    using ExpressionReplacement = std::function<Expression::ptr(const Expression::ptr&)>;
+
+    Expression::ptr replaceSubexpressions(const Expression::ptr& expression, const ExpressionReplacement& replace) {
+        const auto* binary = dynamic_cast<const BinaryExpression*>(expression.get());
+        const auto* shift  = dynamic_cast<const ShiftExpression*>(expression.get());
+        if (binary == nullptr && shift == nullptr) {
+            return nullptr;
+        }
+        if (auto replacement = replace(expression); replacement) {
+            return replacement == expression ? nullptr : replacement;
+        }
+
+        if (binary != nullptr) {
+            auto lhs = replaceSubexpressions(binary->lhs, replace);
+            auto rhs = replaceSubexpressions(binary->rhs, replace);
+            if (!lhs && !rhs) {
+                return nullptr;
+            }
+            return std::make_shared<BinaryExpression>(lhs ? lhs : binary->lhs, binary->op, rhs ? rhs : binary->rhs);
+        }
+        auto lhs = replaceSubexpressions(shift->lhs, replace);
+        return lhs ? std::make_shared<ShiftExpression>(lhs, shift->op, shift->rhs) : nullptr;
+    }
+
+    // Replaces the expressions of the right-hand sides of the assignments and of the (fi) conditions of the if statements, returns std::nullopt if the statements are not modified
+    std::optional<Statement::vec> replaceSubexpressions(const Statement::vec& statements, const ExpressionReplacement& replace);
+
+    Statement::ptr replaceSubexpressions(const Statement::ptr& statement, const ExpressionReplacement& replace) {
+        if (const auto* assignStat = dynamic_cast<const AssignStatement*>(statement.get()); assignStat != nullptr) {
+            auto rhs = replaceSubexpressions(assignStat->rhs, replace);
+            if (!rhs) {
+                return nullptr;
+            }
+            auto modified = std::make_shared<AssignStatement>(*assignStat);
+            modified->rhs = std::move(rhs);
+            return modified;
+        }
+        if (const auto* ifStat = dynamic_cast<const IfStatement*>(statement.get()); ifStat != nullptr) {
+            auto condition      = replaceSubexpressions(ifStat->condition, replace);
+            auto thenStatements = replaceSubexpressions(ifStat->thenStatements, replace);
+            auto elseStatements = replaceSubexpressions(ifStat->elseStatements, replace);
+            auto fiCondition    = replaceSubexpressions(ifStat->fiCondition, replace);
+            if (!condition && !thenStatements.has_value() && !elseStatements.has_value() && !fiCondition) {
+                return nullptr;
+            }
+            auto modified = std::make_shared<IfStatement>(*ifStat);
+            if (condition) {
+                modified->condition = std::move(condition);
+            }
+            if (thenStatements.has_value()) {
+                modified->thenStatements = std::move(*thenStatements);
+            }
+            if (elseStatements.has_value()) {
+                modified->elseStatements = std::move(*elseStatements);
+            }
+            if (fiCondition) {
+                modified->fiCondition = std::move(fiCondition);
+            }
+            return modified;
+        }
+        if (const auto* forStat = dynamic_cast<const ForStatement*>(statement.get()); forStat != nullptr) {
+            auto statements = replaceSubexpressions(forStat->statements, replace);
+            if (!statements.has_value()) {
+                return nullptr;
+            }
+            auto modified        = std::make_shared<ForStatement>(*forStat);
+            modified->statements = std::move(*statements);
+            return modified;
+        }
+        return nullptr;
+    }
+
+    std::optional<Statement::vec> replaceSubexpressions(const Statement::vec& statements, const ExpressionReplacement& replace) {
+        std::optional<Statement::vec> modified;
+        for (std::size_t i = 0U; i < statements.size(); ++i) {
+            auto replacement = replaceSubexpressions(statements[i], replace);
+            if (replacement && !modified.has_value()) {
+                modified = Statement::vec(statements.cbegin(), statements.cbegin() + static_cast<std::ptrdiff_t>(i));
+            }
+            if (modified.has_value()) {
+                modified->emplace_back(replacement ? replacement : statements[i]);
+            }
+        }
+        return modified;
+    }
+
+    struct LoopInvariantCodeMotion {
+        Module&                                module;
+        const LoopInvariantCodeMotionSettings& settings;
+        // names of the parameters and variables of all modules of the program
+        std::unordered_set<std::string>& usedNames;
+        std::size_t                      nMoved              = 0U;
+        std::size_t                      nRemovedEvaluations = 0U;
+        std::size_t                      nWireQubits         = 0U;
+
+        // Returns a new wire of the module with the bitwidth, whose name is not used by any module of the program yet.
+        // The synthesis labels the qubits of the wires of a called module by their names, thus the names are unique in the program
+        Variable::ptr addWire(const unsigned bitwidth) {
+            std::string name;
+            for (std::size_t i = 0U;; ++i) {
+                name = "licm" + std::to_string(i);
+                if (usedNames.emplace(name).second) {
+                    break;
+                }
+            }
+            auto wire = std::make_shared<Variable>(Variable::Wire, name, std::vector<unsigned>{}, bitwidth);
+            module.addVariable(wire);
+            return wire;
+        }
+
+        static Statement::ptr computeIntoWire(const Variable::ptr& wire, const Expression::ptr& expression, const unsigned lineNumber) {
+            auto access = std::make_shared<VariableAccess>();
+            access->setVar(wire);
+            auto assignStat        = std::make_shared<AssignStatement>(access, AssignStatement::Exor, expression);
+            assignStat->lineNumber = lineNumber;
+            return assignStat;
+        }
+
+        // Returns the statements replacing the for statement, std::nullopt if neither an invariant expression of its body is moved nor its body is modified
+        std::optional<Statement::vec> moveOutOfLoop(const ForStatement& statement) {
+            std::vector<std::pair<Expression::ptr, Variable::ptr>> wires;
+            Statement::vec                                         body = statement.statements;
+            if (const auto nIterations = numberOfIterations(statement); nIterations.has_value()) {
+                VariableAccesses written;
+                addAccesses(statement.statements, module, written);
+                std::unordered_set<std::string> boundLoopVariables;
+                if (!statement.loopVariable.empty()) {
+                    boundLoopVariables.emplace(statement.loopVariable);
+                }
+                addNestedLoopVariables(statement.statements, boundLoopVariables);
+
+                const auto isInvariant = [&](const Expression::ptr& expression) {
+                    std::unordered_set<std::string> loopVariables;
+                    addLoopVariables(expression, loopVariables);
+                    return std::none_of(loopVariables.cbegin(), loopVariables.cend(), [&](const auto& loopVariable) { return boundLoopVariables.count(loopVariable) != 0U; }) && !written.writesAnyOf(readVariablesOf(expression));
+                };
+
+                // the maximal invariant expressions of the body with their number of occurrences
+                std::vector<std::pair<Expression::ptr, std::size_t>> invariants;
+                replaceSubexpressions(statement.statements, [&](const Expression::ptr& expression) -> Expression::ptr {
+                    if (!isInvariant(expression)) {
+                        return nullptr;
+                    }
+                    const auto it = std::find_if(invariants.begin(), invariants.end(), [&](const auto& invariant) { return isSameExpression(invariant.first, expression); });
+                    if (it != invariants.end()) {
+                        ++it->second;
+                    } else {
+                        invariants.emplace_back(expression, 1U);
+                    }
+                    return expression;
+                });
+
+                for (const auto& [expression, nOccurrences]: invariants) {
+                    // moving an expression evaluated at most twice saves no evaluation
+                    const auto nEvaluations = nOccurrences * *nIterations;
+                    if (nEvaluations < std::max<std::size_t>(settings.minEvaluations, 3U)) {
+                        continue;
+                    }
+                    wires.emplace_back(expression, addWire(expression->bitwidth()));
+                    ++nMoved;
+                    nRemovedEvaluations += nEvaluations - 2U;
+                    nWireQubits += wires.back().second->bitwidth;
+                }
+                if (!wires.empty()) {
+                    body = *replaceSubexpressions(statement.statements, [&](const Expression::ptr& expression) -> Expression::ptr {
+                        const auto it = std::find_if(wires.cbegin(), wires.cend(), [&](const auto& wire) { return isSameExpression(wire.first, expression); });
+                        if (it == wires.cend()) {
+                            return nullptr;
+                        }
+                        auto access = std::make_shared<VariableAccess>();
+                        access->setVar(it->second);
+                        return std::make_shared<VariableExpression>(access);
+                    });
+                }
+            }
+
+            // the for statements nested in the body are processed afterwards, thus the expressions left in them can still be moved out of them
+            auto nestedBody = moveInStatements(body);
+            if (wires.empty() && !nestedBody.has_value()) {
+                return std::nullopt;
+            }
+            auto modified        = std::make_shared<ForStatement>(statement);
+            modified->statements = nestedBody.has_value() ? std::move(*nestedBody) : std::move(body);
+
+            // the wires are uncomputed in reverse order of their computation
+            Statement::vec replacement;
+            for (const auto& [expression, wire]: wires) {
+                replacement.emplace_back(computeIntoWire(wire, expression, statement.lineNumber));
+            }
+            replacement.emplace_back(modified);
+            for (auto it = wires.crbegin(); it != wires.crend(); ++it) {
+                replacement.emplace_back(computeIntoWire(it->second, it->first, statement.lineNumber));
+            }
+            return replacement;
+        }
+
+        // Returns the statements replacing the statement, std::nullopt if it is not modified
+        std::optional<Statement::vec> moveInStatement(const Statement::ptr& statement) {
+            if (const auto* forStat = dynamic_cast<const ForStatement*>(statement.get()); forStat != nullptr) {
+                return moveOutOfLoop(*forStat);
+            }
+
+            const auto* ifStat = dynamic_cast<const IfStatement*>(statement.get());
+            if (ifStat == nullptr) {
+                return std::nullopt;
+            }
+            auto thenStatements = moveInStatements(ifStat->thenStatements);
+            auto elseStatements = moveInStatements(ifStat->elseStatements);
+            if (!thenStatements.has_value() && !elseStatements.has_value()) {
+                return std::nullopt;
+            }
+            auto modified = std::make_shared<IfStatement>(*ifStat);
+            if (thenStatements.has_value()) {
+                modified->thenStatements = std::move(*thenStatements);
+            }
+            if (elseStatements.has_value()) {
+                modified->elseStatements = std::move(*elseStatements);
+            }
+            return Statement::vec{modified};
+        }
+
+        std::optional<Statement::vec> moveInStatements(const Statement::vec& statements) {
+            std::optional<Statement::vec> modified;
+            for (std::size_t i = 0U; i < statements.size(); ++i) {
+                auto replacement = moveInStatement(statements[i]);
+                if (replacement.has_value() && !modified.has_value()) {
+                    modified = Statement::vec(statements.cbegin(), statements.cbegin() + static_cast<std::ptrdiff_t>(i));
+                }
+                if (modified.has_value()) {
+                    if (replacement.has_value()) {
+                        modified->insert(modified->end(), replacement->cbegin(), replacement->cend());
+                    } else {
+                        modified->emplace_back(statements[i]);
+                    }
+                }
+            }
+            return modified;
+        }
+    };
+
+    // The cost of the circuit synthesized for the program, std::nullopt if the synthesis fails
+    struct SynthesizedCost {
+        std::uint64_t gates;
+        std::uint64_t quantumCost;
+        std::uint64_t qubits;
+        std::uint64_t ancillaryQubits;
+    };
+
+    std::optional<SynthesizedCost> synthesizedCost(const Program& program, const Properties::ptr& synthesisSettings) {
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+        if (!CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, synthesisSettings)) {
+            return std::nullopt;
+        }
+        return SynthesizedCost{annotatableQuantumComputation.getNops(), annotatableQuantumComputation.getQuantumCostForSynthesis(), annotatableQuantumComputation.getNqubits(), annotatableQuantumComputation.getAddedPreliminaryAncillaryQubitIndices().size()};
+    }
+} // namespace
+
+std::size_t syrec::hoistLoopInvariantExpressions(Program& program, const LoopInvariantCodeMotionSettings& settings, const Properties::ptr& statistics) {
+    std::optional<SynthesizedCost> initialCost;
+    if (settings.measureSavings && statistics) {
+        initialCost = synthesizedCost(program, settings.synthesisSettings);
+    }
+
+    const auto  start               = std::chrono::steady_clock::now();
+    std::size_t nMoved              = 0U;
+    std::size_t nRemovedEvaluations = 0U;
+    std::size_t nWireQubits         = 0U;
+    std::unordered_set<std::string> usedNames;
+    for (const auto& module: program.modules()) {
+        for (const auto* variables: {&module->parameters, &module->variables}) {
+            for (const auto& variable: *variables) {
+                usedNames.emplace(variable->name);
+            }
+        }
+    }
+    for (const auto& module: program.modules()) {
+        LoopInvariantCodeMotion codeMotion{*module, settings, usedNames};
+        if (auto statements = codeMotion.moveInStatements(module->statements); statements.has_value()) {
+            module->statements = std::move(*statements);
+        }
+        nMoved += codeMotion.nMoved;
+        nRemovedEvaluations += codeMotion.nRemovedEvaluations;
+        nWireQubits += codeMotion.nWireQubits;
+    }
+    const auto runtime = static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+
+    if (statistics) {
+        statistics->set("invariant_expressions", static_cast<std::uint64_t>(nMoved));
+        statistics->set("removed_evaluations", static_cast<std::uint64_t>(nRemovedEvaluations));
+        statistics->set("wire_qubits", static_cast<std::uint64_t>(nWireQubits));
+        statistics->set("runtime", runtime);
+        if (const auto cost = settings.measureSavings ? synthesizedCost(program, settings.synthesisSettings) : std::nullopt; initialCost.has_value() && cost.has_value()) {
+            statistics->set("initial_gates", initialCost->gates);
+            statistics->set("gates", cost->gates);
+            statistics->set("initial_quantum_cost", initialCost->quantumCost);
+            statistics->set("quantum_cost", cost->quantumCost);
+            statistics->set("initial_qubits", initialCost->qubits);
+            statistics->set("qubits", cost->qubits);
+            statistics->set("initial_ancillary_qubits", initialCost->ancillaryQubits);
+            statistics->set("ancillary_qubits", cost->ancillaryQubits);
+        }
+    }
+    return nMoved;
+}
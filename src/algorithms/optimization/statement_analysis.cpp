@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/statement_analysis.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <string>
+#include <typeinfo>
+#include <unordered_set>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    bool isSameNumber(const Number::ptr& lhs, const Number::ptr& rhs) {
+        if (!lhs || !rhs) {
+            return !lhs && !rhs;
+        }
+        if (lhs->isConstant() != rhs->isConstant()) {
+            return false;
+        }
+        return lhs->isConstant() ? lhs->evaluate({}) == rhs->evaluate({}) : lhs->variableName() == rhs->variableName();
+    }
+
+    bool isSameVariableAccess(const VariableAccess::ptr& lhs, const VariableAccess::ptr& rhs) {
+        if (lhs->var != rhs->var || lhs->range.has_value() != rhs->range.has_value() || lhs->indexes.size() != rhs->indexes.size()) {
+            return false;
+        }
+        if (lhs->range.has_value() && (!isSameNumber(lhs->range->first, rhs->range->first) || !isSameNumber(lhs->range->second, rhs->range->second))) {
+            return false;
+        }
+        for (std::size_t i = 0U; i < lhs->indexes.size(); ++i) {
+            if (!isSameExpression(lhs->indexes[i], rhs->indexes[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool isSameStatements(const Statement::vec& lhs, const Statement::vec& rhs) {
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (std::size_t i = 0U; i < lhs.size(); ++i) {
+            if (!isSameStatement(lhs[i], rhs[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void addReadVariables(const Expression::ptr& expression, std::unordered_set<const Variable*>& read);
+
+    void addReadVariables(const VariableAccess::ptr& access, std::unordered_set<const Variable*>& read) {
+        for (const auto& index: access->indexes) {
+            addReadVariables(index, read);
+        }
+    }
+
+    void addReadVariables(const Expression::ptr& expression, std::unordered_set<const Variable*>& read) {
+        if (const auto* variable = dynamic_cast<const VariableExpression*>(expression.get()); variable != nullptr) {
+            read.emplace(variable->var->var.get());
+            addReadVariables(variable->var, read);
+        } else if (const auto* binary = dynamic_cast<const BinaryExpression*>(expression.get()); binary != nullptr) {
+            addReadVariables(binary->lhs, read);
+            addReadVariables(binary->rhs, read);
+        } else if (const auto* shift = dynamic_cast<const ShiftExpression*>(expression.get()); shift != nullptr) {
+            addReadVariables(shift->lhs, read);
+        }
+    }
+
+    void addWrittenVariable(const VariableAccess::ptr& access, VariableAccesses& accesses) {
+        accesses.written.emplace(access->var.get());
+        addReadVariables(access, accesses.read);
+    }
+
+    void addCallAccesses(const std::vector<std::string>& parameters, const Module& module, VariableAccesses& accesses) {
+        for (const auto& parameter: parameters) {
+            accesses.written.emplace(module.findParameterOrVariable(parameter).get());
+        }
+    }
+
+    void addAccessesOfStatement(const Statement::ptr& statement, const Module& module, VariableAccesses& accesses) {
+        if (const auto* swapStat = dynamic_cast<const SwapStatement*>(statement.get()); swapStat != nullptr) {
+            addWrittenVariable(swapStat->lhs, accesses);
+            addWrittenVariable(swapStat->rhs, accesses);
+        } else if (const auto* unaryStat = dynamic_cast<const UnaryStatement*>(statement.get()); unaryStat != nullptr) {
+            addWrittenVariable(unaryStat->var, accesses);
+        } else if (const auto* assignStat = dynamic_cast<const AssignStatement*>(statement.get()); assignStat != nullptr) {
+            addWrittenVariable(assignStat->lhs, accesses);
+            addReadVariables(assignStat->rhs, accesses.read);
+        } else if (const auto* ifStat = dynamic_cast<const IfStatement*>(statement.get()); ifStat != nullptr) {
+            addReadVariables(ifStat->condition, accesses.read);
+            addReadVariables(ifStat->fiCondition, accesses.read);
+            addAccesses(ifStat->thenStatements, module, accesses);
+            addAccesses(ifStat->elseStatements, module, accesses);
+        } else if (const auto* forStat = dynamic_cast<const ForStatement*>(statement.get()); forStat != nullptr) {
+            addAccesses(forStat->statements, module, accesses);
+        } else if (const auto* callStat = dynamic_cast<const CallStatement*>(statement.get()); callStat != nullptr) {
+            addCallAccesses(callStat->parameters, module, accesses);
+        } else if (const auto* uncallStat = dynamic_cast<const UncallStatement*>(statement.get()); uncallStat != nullptr) {
+            addCallAccesses(uncallStat->parameters, module, accesses);
+        }
+    }
+} // namespace
+
+bool syrec::isSameExpression(const Expression::ptr& lhs, const Expression::ptr& rhs) {
+    if (!lhs || !rhs) {
+        return !lhs && !rhs;
+    }
+    if (typeid(*lhs) != typeid(*rhs)) {
+        return false;
+    }
+    if (const auto* numeric = dynamic_cast<const NumericExpression*>(lhs.get()); numeric != nullptr) {
+        const auto& other = dynamic_cast<const NumericExpression&>(*rhs);
+        return numeric->bwidth == other.bwidth && isSameNumber(numeric->value, other.value);
+    }
+    if (const auto* variable = dynamic_cast<const VariableExpression*>(lhs.get()); variable != nullptr) {
+        return isSameVariableAccess(variable->var, dynamic_cast<const VariableExpression&>(*rhs).var);
+    }
+    if (const auto* binary = dynamic_cast<const BinaryExpression*>(lhs.get()); binary != nullptr) {
+        const auto& other = dynamic_cast<const BinaryExpression&>(*rhs);
+        return binary->op == other.op && isSameExpression(binary->lhs, other.lhs) && isSameExpression(binary->rhs, other.rhs);
+    }
+    if (const auto* shift = dynamic_cast<const ShiftExpression*>(lhs.get()); shift != nullptr) {
+        const auto& other = dynamic_cast<const ShiftExpression&>(*rhs);
+        return shift->op == other.op && isSameExpression(shift->lhs, other.lhs) && isSameNumber(shift->rhs, other.rhs);
+    }
+    return false;
+}
+
+bool syrec::isSameStatement(const Statement::ptr& lhs, const Statement::ptr& rhs) {
+    if (lhs == rhs) {
+        return true;
+    }
+    if (typeid(*lhs) != typeid(*rhs)) {
+        return false;
+    }
+    if (const auto* swapStat = dynamic_cast<const SwapStatement*>(lhs.get()); swapStat != nullptr) {
+        const auto& other = dynamic_cast<const SwapStatement&>(*rhs);
+        return isSameVariableAccess(swapStat->lhs, other.lhs) && isSameVariableAccess(swapStat->rhs, other.rhs);
+    }
+    if (const auto* unaryStat = dynamic_cast<const UnaryStatement*>(lhs.get()); unaryStat != nullptr) {
+        const auto& other = dynamic_cast<const UnaryStatement&>(*rhs);
+        return unaryStat->op == other.op && isSameVariableAccess(unaryStat->var, other.var);
+    }
+    if (const auto* assignStat = dynamic_cast<const AssignStatement*>(lhs.get()); assignStat != nullptr) {
+        const auto& other = dynamic_cast<const AssignStatement&>(*rhs);
+        return assignStat->op == other.op && isSameVariableAccess(assignStat->lhs, other.lhs) && isSameExpression(assignStat->rhs, other.rhs);
+    }
+    if (const auto* ifStat = dynamic_cast<const IfStatement*>(lhs.get()); ifStat != nullptr) {
+        const auto& other = dynamic_cast<const IfStatement&>(*rhs);
+        return isSameExpression(ifStat->condition, other.condition) && isSameExpression(ifStat->fiCondition, other.fiCondition) && isSameStatements(ifStat->thenStatements, other.thenStatements) && isSameStatements(ifStat->elseStatements, other.elseStatements);
+    }
+    if (const auto* forStat = dynamic_cast<const ForStatement*>(lhs.get()); forStat != nullptr) {
+        const auto& other = dynamic_cast<const ForStatement&>(*rhs);
+        return forStat->loopVariable == other.loopVariable && isSameNumber(forStat->range.first, other.range.first) && isSameNumber(forStat->range.second, other.range.second) && isSameNumber(forStat->step, other.step) && isSameStatements(forStat->statements, other.statements);
+    }
+    if (const auto* callStat = dynamic_cast<const CallStatement*>(lhs.get()); callStat != nullptr) {
+        const auto& other = dynamic_cast<const CallStatement&>(*rhs);
+        return callStat->target == other.target && callStat->parameters == other.parameters;
+    }
+    if (const auto* uncallStat = dynamic_cast<const UncallStatement*>(lhs.get()); uncallStat != nullptr) {
+        const auto& other = dynamic_cast<const UncallStatement&>(*rhs);
+        return uncallStat->target == other.target && uncallStat->parameters == other.parameters;
+    }
+    // skip statements
+    return true;
+}
+
+void syrec::addAccesses(const Statement::vec& statements, const Module& module, VariableAccesses& accesses) {
+    for (const auto& statement: statements) {
+        addAccessesOfStatement(statement, module, accesses);
+    }
+}
+
+VariableAccesses syrec::accessesOf(const Statement::ptr& statement, const Module& module) {
+    VariableAccesses accesses;
+    addAccessesOfStatement(statement, module, accesses);
+    return accesses;
+}
+
+std::unordered_set<const Variable*> syrec::readVariablesOf(const Expression::ptr& expression) {
+    std::unordered_set<const Variable*> read;
+    addReadVariables(expression, read);
+    return read;
+}
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/statement_hoisting.hpp"
+
+#include "algorithms/optimization/statement_analysis.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // Whether the statement at the position can be moved in front of all preceding statements (or behind all succeeding statements if toEnd is set)
+    bool canBeMovedToBoundary(const Statement::vec& statements, const std::vector<VariableAccesses>& accesses, const std::size_t position, const bool toEnd) {
+        const std::size_t begin = toEnd ? position + 1U : 0U;
+        const std::size_t end   = toEnd ? statements.size() : position;
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!accesses[position].commutesWith(accesses[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*
+     * Moves the statements of the then branch, for which the else branch contains an identical statement, to the beginning (or end) of both branches and removes them from the branches.
+     * The hoisted statements are returned in the order of the then branch. The condition variables must not be written by the hoisted statements.
+     */
+    Statement::vec hoistCommonStatements(Statement::vec& thenStatements, Statement::vec& elseStatements, const std::unordered_set<const Variable*>& conditionVariables, const Module& module, const bool toEnd) {
+        Statement::vec hoisted;
+        bool           isHoisted = true;
+        while (isHoisted && !thenStatements.empty() && !elseStatements.empty()) {
+            isHoisted = false;
+
+            std::vector<VariableAccesses> thenAccesses;
+            std::vector<VariableAccesses> elseAccesses;
+            for (const auto& statement: thenStatements) {
+                thenAccesses.emplace_back(accessesOf(statement, module));
+            }
+            for (const auto& statement: elseStatements) {
+                elseAccesses.emplace_back(accessesOf(statement, module));
+            }
+
+            // the statements closest to the boundary are hoisted first, thus the order of the hoisted statements is kept
+            for (std::size_t k = 0U; k < thenStatements.size() && !isHoisted; ++k) {
+                const auto i = toEnd ? thenStatements.size() - 1U - k : k;
+                if (thenAccesses[i].writesAnyOf(conditionVariables) || !canBeMovedToBoundary(thenStatements, thenAccesses, i, toEnd)) {
+                    continue;
+                }
+                for (std::size_t l = 0U; l < elseStatements.size(); ++l) {
+                    const auto j = toEnd ? elseStatements.size() - 1U - l : l;
+                    if (isSameStatement(thenStatements[i], elseStatements[j]) && canBeMovedToBoundary(elseStatements, elseAccesses, j, toEnd)) {
+                        hoisted.emplace_back(thenStatements[i]);
+                        thenStatements.erase(thenStatements.begin() + static_cast<std::ptrdiff_t>(i));
+                        elseStatements.erase(elseStatements.begin() + static_cast<std::ptrdiff_t>(j));
+                        isHoisted = true;
+                        break;
+                    }
+                }
+            }
+        }
+        if (toEnd) {
+            std::reverse(hoisted.begin(), hoisted.end());
+        }
+        return hoisted;
+    }
+
+    // Returns the statements replacing the statements, std::nullopt if they are not modified
+    std::optional<Statement::vec> hoistInStatements(const Statement::vec& statements, const Module& module, std::size_t& nHoisted);
+
+    // Returns the statements replacing the statement, std::nullopt if it is not modified
+    std::optional<Statement::vec> hoistInStatement(const Statement::ptr& statement, const Module& module, std::size_t& nHoisted) {
+        if (const auto* forStat = dynamic_cast<const ForStatement*>(statement.get()); forStat != nullptr) {
+            auto statements = hoistInStatements(forStat->statements, module, nHoisted);
+            if (!statements.has_value()) {
+                return std::nullopt;
+            }
+            auto modified        = std::make_shared<ForStatement>(*forStat);
+            modified->statements = std::move(*statements);
+            return Statement::vec{modified};
+        }
+
+        const auto* ifStat = dynamic_cast<const IfStatement*>(statement.get());
+        if (ifStat == nullptr) {
+            return std::nullopt;
+        }
+
+        auto thenStatements = hoistInStatements(ifStat->thenStatements, module, nHoisted);
+        auto elseStatements = hoistInStatements(ifStat->elseStatements, module, nHoisted);
+        bool isModified     = thenStatements.has_value() || elseStatements.has_value();
+        auto modified       = std::make_shared<IfStatement>(*ifStat);
+        if (thenStatements.has_value()) {
+            modified->thenStatements = std::move(*thenStatements);
+        }
+        if (elseStatements.has_value()) {
+            modified->elseStatements = std::move(*elseStatements);
+        }
+
+        auto before = hoistCommonStatements(modified->thenStatements, modified->elseStatements, readVariablesOf(modified->condition), module, false);
+        auto after  = hoistCommonStatements(modified->thenStatements, modified->elseStatements, readVariablesOf(modified->fiCondition), module, true);
+        nHoisted += before.size() + after.size();
+        isModified |= !before.empty() || !after.empty();
+        if (!isModified) {
+            return std::nullopt;
+        }
+
+        Statement::vec replacement = std::move(before);
+        if (!modified->thenStatements.empty() || !modified->elseStatements.empty()) {
+            replacement.emplace_back(modified);
+        }
+        replacement.insert(replacement.end(), after.cbegin(), after.cend());
+        return replacement;
+    }
+
+    std::optional<Statement::vec> hoistInStatements(const Statement::vec& statements, const Module& module, std::size_t& nHoisted) {
+        std::optional<Statement::vec> modified;
+        for (std::size_t i = 0U; i < statements.size(); ++i) {
+            auto replacement = hoistInStatement(statements[i], module, nHoisted);
+            if (replacement.has_value() && !modified.has_value()) {
+                modified = Statement::vec(statements.cbegin(), statements.cbegin() + static_cast<std::ptrdiff_t>(i));
+            }
+            if (modified.has_value()) {
+                if (replacement.has_value()) {
+                    modified->insert(modified->end(), replacement->cbegin(), replacement->cend());
+                } else {
+                    modified->emplace_back(statements[i]);
+                }
+            }
+        }
+        return modified;
+    }
+} // namespace
+
+std::size_t syrec::hoistBranchCommonStatements(Program& program) {
+    std::size_t nHoisted = 0U;
+    for (const auto& module: program.modules()) {
+        if (auto statements = hoistInStatements(module->statements, *module, nHoisted); statements.has_value()) {
+            module->statements = std::move(*statements);
+        }
+    }
+    return nHoisted;
+}
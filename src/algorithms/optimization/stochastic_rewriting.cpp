@@ -0,0 +1,526 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/stochastic_rewriting.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/parallel_for.hpp"
+#include "core/properties.hpp"
+#include "dd/FunctionalityConstruction.hpp"
+#include "dd/Package.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using Gate    = BitParallelGate;
+    using Gates   = std::vector<Gate>;
+    using Control = std::pair<qc::Qubit, bool>;
+    using Cost    = AnnotatableQuantumComputation::SynthesisCostMetricValue;
+
+    // replacement of the gates [begin, end) of a circuit
+    struct Rewrite {
+        std::size_t begin = 0U;
+        std::size_t end   = 0U;
+        Gates       gates;
+    };
+
+    enum class RewriteKind : std::uint8_t {
+        Commute,
+        Merge,
+        Peres,
+        FredkinCollapse,
+        FredkinExpand,
+        PolarityFlip,
+        Split
+    };
+
+    // proposal frequencies of the kinds of rewrites (in the order of RewriteKind)
+    constexpr double REWRITE_WEIGHTS[] = {3., 3., 2., 2., 1., 1., 1.};
+
+    std::optional<bool> polarityOf(const Gate& gate, const qc::Qubit qubit) {
+        const auto it = std::lower_bound(gate.controls.cbegin(), gate.controls.cend(), Control{qubit, false});
+        if (it != gate.controls.cend() && it->first == qubit) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    bool isTarget(const Gate& gate, const qc::Qubit qubit) {
+        return gate.target1 == qubit || (gate.swap && gate.target2 == qubit);
+    }
+
+    bool involves(const Gate& gate, const qc::Qubit qubit) {
+        return isTarget(gate, qubit) || polarityOf(gate, qubit).has_value();
+    }
+
+    // adds the control or changes the polarity of an existing control
+    void setControl(Gate& gate, const qc::Qubit qubit, const bool positive) {
+        const auto it = std::lower_bound(gate.controls.begin(), gate.controls.end(), Control{qubit, false});
+        if (it != gate.controls.end() && it->first == qubit) {
+            it->second = positive;
+        } else {
+            gate.controls.emplace(it, qubit, positive);
+        }
+    }
+
+    void removeControl(Gate& gate, const qc::Qubit qubit) {
+        gate.controls.erase(std::remove_if(gate.controls.begin(), gate.controls.end(), [qubit](const Control& control) { return control.first == qubit; }), gate.controls.end());
+    }
+
+    Gate xGate(std::vector<Control> controls, const qc::Qubit target) {
+        Gate gate;
+        gate.target1  = target;
+        gate.controls = std::move(controls);
+        return gate;
+    }
+
+    Gate swapGate(std::vector<Control> controls, const qc::Qubit target1, const qc::Qubit target2) {
+        Gate gate;
+        gate.swap     = true;
+        gate.target1  = std::min(target1, target2);
+        gate.target2  = std::max(target1, target2);
+        gate.controls = std::move(controls);
+        return gate;
+    }
+
+    std::vector<Control> difference(const std::vector<Control>& lhs, const std::vector<Control>& rhs) {
+        std::vector<Control> result;
+        std::set_difference(lhs.cbegin(), lhs.cend(), rhs.cbegin(), rhs.cend(), std::back_inserter(result));
+        return result;
+    }
+
+    bool commute(const Gate& first, const Gate& second) {
+        // gates with contradicting controls are never applied both
+        for (const auto& [qubit, positive]: first.controls) {
+            if (const auto polarity = polarityOf(second, qubit); polarity.has_value() && *polarity != positive) {
+                return true;
+            }
+        }
+
+        const auto controlsTargetOf = [](const Gate& gate, const Gate& other) {
+            return polarityOf(gate, other.target1).has_value() || (other.swap && polarityOf(gate, other.target2).has_value());
+        };
+        if (controlsTargetOf(first, second) || controlsTargetOf(second, first)) {
+            return false;
+        }
+        const auto overlappingTargets = isTarget(second, first.target1) || (first.swap && isTarget(second, first.target2));
+        return !overlappingTargets || (first.swap == second.swap && first.target1 == second.target1 && first.target2 == second.target2);
+    }
+
+    // U(C + q) U(C + !q) = U(C), U(C + q) U(C) = U(C + !q) and U(C) U(C) = I for any self-inverse gate U
+    std::optional<Gates> merge(const Gate& first, const Gate& second) {
+        if (first.swap != second.swap || first.target1 != second.target1 || (first.swap && first.target2 != second.target2)) {
+            return std::nullopt;
+        }
+        if (first.controls == second.controls) {
+            return Gates{};
+        }
+
+        const auto onlyFirst  = difference(first.controls, second.controls);
+        const auto onlySecond = difference(second.controls, first.controls);
+        if (onlyFirst.size() == 1U && onlySecond.size() == 1U && onlyFirst.front().first == onlySecond.front().first) {
+            auto merged = first;
+            removeControl(merged, onlyFirst.front().first);
+            return Gates{merged};
+        }
+        if (onlyFirst.size() + onlySecond.size() == 1U) {
+            auto        merged  = onlyFirst.empty() ? second : first;
+            const auto& control = onlyFirst.empty() ? onlySecond.front() : onlyFirst.front();
+            setControl(merged, control.first, !control.second);
+            return Gates{merged};
+        }
+        return std::nullopt;
+    }
+
+    // A gate g whose control t is the target of an X gate h controlled by a subset of the other controls of g commutes with h if the polarity of t is flipped,
+    // e.g. a Toffoli gate followed by a CNOT gate on one of its controls (i.e. the Peres gate) is the CNOT gate followed by the Toffoli gate with a negative control.
+    bool canMoveAcross(const Gate& gate, const Gate& cnotLike) {
+        if (cnotLike.swap || !polarityOf(gate, cnotLike.target1).has_value()) {
+            return false;
+        }
+        if (polarityOf(cnotLike, gate.target1).has_value() || (gate.swap && polarityOf(cnotLike, gate.target2).has_value())) {
+            return false;
+        }
+        return std::includes(gate.controls.cbegin(), gate.controls.cend(), cnotLike.controls.cbegin(), cnotLike.controls.cend());
+    }
+
+    std::optional<Gates> peresMove(const Gate& first, const Gate& second) {
+        if (canMoveAcross(first, second)) {
+            auto moved = first;
+            setControl(moved, second.target1, !*polarityOf(first, second.target1));
+            return Gates{second, moved};
+        }
+        if (canMoveAcross(second, first)) {
+            auto moved = second;
+            setControl(moved, first.target1, !*polarityOf(second, first.target1));
+            return Gates{moved, first};
+        }
+        return std::nullopt;
+    }
+
+    // CNOT(b -> a) X(C + a -> b) CNOT(b -> a) = SWAP(a, b; C), the outer gates may be further controlled by a subset of C
+    std::optional<Gate> fredkinCollapse(const Gate& outer, const Gate& middle, const Gate& last) {
+        if (outer != last || outer.swap || middle.swap) {
+            return std::nullopt;
+        }
+        const auto a = outer.target1;
+        const auto b = middle.target1;
+        if (polarityOf(outer, b) != std::optional{true} || polarityOf(middle, a) != std::optional{true}) {
+            return std::nullopt;
+        }
+
+        auto outerControls = outer.controls;
+        auto swapControls  = middle.controls;
+        outerControls.erase(std::find(outerControls.begin(), outerControls.end(), Control{b, true}));
+        swapControls.erase(std::find(swapControls.begin(), swapControls.end(), Control{a, true}));
+        if (!std::includes(swapControls.cbegin(), swapControls.cend(), outerControls.cbegin(), outerControls.cend())) {
+            return std::nullopt;
+        }
+        return swapGate(std::move(swapControls), a, b);
+    }
+
+    Gates fredkinExpand(const Gate& fredkin, const bool reversed) {
+        const auto a = reversed ? fredkin.target2 : fredkin.target1;
+        const auto b = reversed ? fredkin.target1 : fredkin.target2;
+
+        auto middleControls = fredkin.controls;
+        middleControls.insert(std::lower_bound(middleControls.begin(), middleControls.end(), Control{a, false}), Control{a, true});
+        const auto outer = xGate({Control{b, true}}, a);
+        return Gates{outer, xGate(std::move(middleControls), b), outer};
+    }
+
+    // quantum cost of the gates of a circuit with a fixed number of qubits
+    class CostModel {
+    public:
+        explicit CostModel(const std::size_t nQubits):
+            nQubits(nQubits) {
+            for (std::size_t nControls = 0U; nControls <= nQubits; ++nControls) {
+                xCosts.emplace_back(AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(nControls, qc::OpType::X, nQubits));
+                swapCosts.emplace_back(AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(nControls, qc::OpType::SWAP, nQubits));
+            }
+        }
+
+        template<class Iterator>
+        [[nodiscard]] Cost operator()(Iterator begin, Iterator end) const {
+            Cost sum = 0U;
+            for (auto it = begin; it != end; ++it) {
+                const auto& costs = it->swap ? swapCosts : xCosts;
+                sum += costs[std::min(it->controls.size(), nQubits)];
+            }
+            return sum;
+        }
+
+    private:
+        std::size_t       nQubits;
+        std::vector<Cost> xCosts;
+        std::vector<Cost> swapCosts;
+    };
+
+    // simulates both gate lists for all assignments of the qubits if there are at most maxExhaustiveQubits qubits, for random assignments otherwise
+    bool equivalent(const Gates& lhs, const Gates& rhs, const std::size_t nQubits, const StochasticRewritingSettings& settings, std::mt19937_64& rng) {
+        std::vector<std::uint64_t> lhsState(nQubits, 0U);
+        std::vector<std::uint64_t> rhsState(nQubits, 0U);
+
+        const auto exhaustive = nQubits <= std::min<std::size_t>(settings.maxExhaustiveQubits, 32U);
+        const auto nBlocks    = exhaustive ? (nQubits <= 6U ? 1ULL : 1ULL << (nQubits - 6U)) : static_cast<std::uint64_t>(settings.randomSimulationBlocks);
+
+        std::vector<qc::Qubit> qubits(nQubits);
+        for (std::size_t i = 0U; i < nQubits; ++i) {
+            qubits[i] = static_cast<qc::Qubit>(i);
+        }
+        for (std::uint64_t block = 0U; block < nBlocks; ++block) {
+            if (exhaustive) {
+                assignBitParallelBlock(lhsState, qubits, block * 64U);
+            } else {
+                std::generate(lhsState.begin(), lhsState.end(), std::ref(rng));
+            }
+            rhsState = lhsState;
+            simulateBitParallel(lhs, lhsState);
+            simulateBitParallel(rhs, rhsState);
+            if (lhsState != rhsState) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // the DDs of the functionality of the circuits are canonical, thus the circuits are equivalent iff their DDs are identical
+    bool equivalentFunctionality(const qc::QuantumComputation& lhs, const qc::QuantumComputation& rhs) {
+        const auto dd    = std::make_unique<dd::Package>(lhs.getNqubits());
+        const auto lhsDD = dd::buildFunctionality(lhs, *dd);
+        const auto rhsDD = dd::buildFunctionality(rhs, *dd);
+        return lhsDD == rhsDD;
+    }
+
+    class Chain {
+    public:
+        Chain(const Gates& gates, const CostModel& costOf, const std::size_t nQubits, const StochasticRewritingSettings& settings, const std::uint64_t seed):
+            gates(gates), cost(costOf(gates.cbegin(), gates.cend())), best(gates), bestCost(cost), costOf(costOf), nQubits(nQubits), settings(settings), rng(seed) {}
+
+        std::optional<Rewrite> propose() {
+            if (gates.empty()) {
+                return std::nullopt;
+            }
+            const auto  position = std::uniform_int_distribution<std::size_t>(0U, gates.size() - 1U)(rng);
+            const auto& gate     = gates[position];
+            const auto  hasNext  = position + 1U < gates.size();
+
+            switch (static_cast<RewriteKind>(kindDistribution(rng))) {
+                case RewriteKind::Commute:
+                    if (hasNext && commute(gate, gates[position + 1U])) {
+                        return Rewrite{position, position + 2U, Gates{gates[position + 1U], gate}};
+                    }
+                    break;
+                case RewriteKind::Merge:
+                    if (hasNext) {
+                        if (auto merged = merge(gate, gates[position + 1U]); merged.has_value()) {
+                            return Rewrite{position, position + 2U, std::move(*merged)};
+                        }
+                    }
+                    break;
+                case RewriteKind::Peres:
+                    if (hasNext) {
+                        if (auto moved = peresMove(gate, gates[position + 1U]); moved.has_value()) {
+                            return Rewrite{position, position + 2U, std::move(*moved)};
+                        }
+                    }
+                    break;
+                case RewriteKind::FredkinCollapse:
+                    if (position + 2U < gates.size()) {
+                        if (auto fredkin = fredkinCollapse(gate, gates[position + 1U], gates[position + 2U]); fredkin.has_value()) {
+                            return Rewrite{position, position + 3U, Gates{std::move(*fredkin)}};
+                        }
+                    }
+                    break;
+                case RewriteKind::FredkinExpand:
+                    if (gate.swap) {
+                        return Rewrite{position, position + 1U, fredkinExpand(gate, std::bernoulli_distribution()(rng))};
+                    }
+                    break;
+                case RewriteKind::PolarityFlip:
+                    if (!gate.controls.empty()) {
+                        const auto [qubit, positive] = gate.controls[std::uniform_int_distribution<std::size_t>(0U, gate.controls.size() - 1U)(rng)];
+                        auto flipped                 = gate;
+                        setControl(flipped, qubit, !positive);
+                        const auto x = xGate({}, qubit);
+                        return Rewrite{position, position + 1U, Gates{x, flipped, x}};
+                    }
+                    break;
+                case RewriteKind::Split: {
+                    const auto qubit = static_cast<qc::Qubit>(std::uniform_int_distribution<std::size_t>(0U, nQubits - 1U)(rng));
+                    if (!involves(gate, qubit)) {
+                        auto positive = gate;
+                        auto negative = gate;
+                        setControl(positive, qubit, true);
+                        setControl(negative, qubit, false);
+                        return Rewrite{position, position + 1U, Gates{positive, negative}};
+                    }
+                    break;
+                }
+            }
+            return std::nullopt;
+        }
+
+        // simulates the replaced and the replacing gates on the qubits affected by them
+        bool verify(const Gates& replaced, const Gates& replacing) {
+            std::vector<qc::Qubit> qubits;
+            for (const auto* gateList: {&replaced, &replacing}) {
+                for (const auto& gate: *gateList) {
+                    qubits.emplace_back(gate.target1);
+                    if (gate.swap) {
+                        qubits.emplace_back(gate.target2);
+                    }
+                    for (const auto& control: gate.controls) {
+                        qubits.emplace_back(control.first);
+                    }
+                }
+            }
+            std::sort(qubits.begin(), qubits.end());
+            qubits.erase(std::unique(qubits.begin(), qubits.end()), qubits.end());
+
+            // the gates are simulated on the affected qubits only
+            const auto local = [&qubits](const qc::Qubit qubit) {
+                return static_cast<qc::Qubit>(std::lower_bound(qubits.cbegin(), qubits.cend(), qubit) - qubits.cbegin());
+            };
+            const auto localize = [&local](Gates localGates) {
+                for (auto& gate: localGates) {
+                    gate.target1 = local(gate.target1);
+                    gate.target2 = gate.swap ? local(gate.target2) : gate.target2;
+                    for (auto& control: gate.controls) {
+                        control.first = local(control.first);
+                    }
+                }
+                return localGates;
+            };
+            return equivalent(localize(replaced), localize(replacing), qubits.size(), settings, rng);
+        }
+
+        // performs the given number of annealing steps, the temperature is determined by the overall progress of the chain
+        void anneal(const std::size_t nSteps) {
+            const auto ratio = settings.finalTemperature / settings.initialTemperature;
+            for (std::size_t i = 0U; i < nSteps && step < settings.stepsPerChain; ++i, ++step) {
+                auto rewrite = propose();
+                if (!rewrite.has_value()) {
+                    continue;
+                }
+
+                const auto begin       = gates.cbegin() + static_cast<std::ptrdiff_t>(rewrite->begin);
+                const auto end         = gates.cbegin() + static_cast<std::ptrdiff_t>(rewrite->end);
+                const auto removedCost = costOf(begin, end);
+                const auto addedCost   = costOf(rewrite->gates.cbegin(), rewrite->gates.cend());
+                if (addedCost > removedCost) {
+                    const auto temperature = settings.initialTemperature * std::pow(ratio, static_cast<double>(step) / static_cast<double>(settings.stepsPerChain));
+                    if (std::uniform_real_distribution<double>()(rng) >= std::exp(-static_cast<double>(addedCost - removedCost) / temperature)) {
+                        continue;
+                    }
+                }
+
+                if (!verify(Gates(begin, end), rewrite->gates)) {
+                    // a rewrite changing the functionality of the window is never applied, only counted
+                    ++discarded;
+                    continue;
+                }
+                gates.erase(begin, end);
+                gates.insert(gates.cbegin() + static_cast<std::ptrdiff_t>(rewrite->begin), rewrite->gates.cbegin(), rewrite->gates.cend());
+                cost = cost - removedCost + addedCost;
+                ++accepted;
+
+                if (cost < bestCost) {
+                    best     = gates;
+                    bestCost = cost;
+                }
+            }
+        }
+
+        [[nodiscard]] bool finished() const {
+            return step >= settings.stepsPerChain;
+        }
+
+        Gates         gates;
+        Cost          cost     = 0U;
+        Gates         best;
+        Cost          bestCost  = 0U;
+        std::uint64_t accepted  = 0U;
+        std::uint64_t discarded = 0U;
+
+    private:
+        const CostModel&                   costOf;
+        std::size_t                        nQubits;
+        const StochasticRewritingSettings& settings;
+        std::mt19937_64                    rng;
+        std::discrete_distribution<int>    kindDistribution{std::begin(REWRITE_WEIGHTS), std::end(REWRITE_WEIGHTS)};
+        std::size_t                        step = 0U;
+    };
+
+    struct SharedBest {
+        std::mutex mutex;
+        Gates      gates;
+        Cost       cost = 0U;
+
+        // publishes the best circuit of the chain and lets the chain continue from the best circuit of all chains if its current circuit is worse
+        void synchronize(Chain& chain) {
+            const std::lock_guard lock(mutex);
+            if (chain.bestCost < cost) {
+                gates = chain.best;
+                cost  = chain.bestCost;
+            } else if (chain.cost > cost) {
+                chain.gates = gates;
+                chain.cost  = cost;
+            }
+        }
+    };
+} // namespace
+
+bool syrec::stochasticRewriting(qc::QuantumComputation& quantumComputation, const StochasticRewritingSettings& settings, const Properties::ptr& statistics) {
+    const auto start = std::chrono::steady_clock::now();
+
+    auto compiled = compileBitParallel(quantumComputation);
+    if (!compiled.has_value()) {
+        return false;
+    }
+    for (auto& gate: *compiled) {
+        if (gate.swap && gate.target1 > gate.target2) {
+            std::swap(gate.target1, gate.target2);
+        }
+    }
+
+    const auto      nQubits = quantumComputation.getNqubits();
+    const CostModel costOf(nQubits);
+    const auto      initialCost = costOf(compiled->cbegin(), compiled->cend());
+
+    SharedBest shared;
+    shared.gates = *compiled;
+    shared.cost  = initialCost;
+
+    std::atomic<std::uint64_t> accepted{0U};
+    std::atomic<std::uint64_t> discarded{0U};
+    if (nQubits != 0U && settings.nChains != 0U && settings.initialTemperature > 0. && settings.finalTemperature > 0.) {
+        parallelFor(settings.nChains, settings.nThreads, [&](const std::size_t i) {
+            Chain      chain(*compiled, costOf, nQubits, settings, settings.seed + i);
+            const auto interval = settings.syncInterval == 0U ? settings.stepsPerChain : settings.syncInterval;
+            while (!chain.finished()) {
+                chain.anneal(interval);
+                shared.synchronize(chain);
+            }
+            accepted += chain.accepted;
+            discarded += chain.discarded;
+        });
+    }
+
+    if (shared.cost < initialCost) {
+        // the rewrites are verified locally, thus the whole circuit is checked once more before it is replaced.
+        // Circuits with too many qubits to simulate all assignments are compared by the DDs of their functionality instead of random assignments.
+        if (nQubits <= std::min<std::size_t>(settings.maxExhaustiveQubits, 32U)) {
+            std::mt19937_64 rng(settings.seed);
+            if (!equivalent(*compiled, shared.gates, nQubits, settings, rng)) {
+                std::cerr << "The optimized circuit is not equivalent to the original one\n";
+                return false;
+            }
+            replaceByBitParallelGates(quantumComputation, shared.gates);
+        } else {
+            auto optimized = quantumComputation;
+            replaceByBitParallelGates(optimized, shared.gates);
+            if (!equivalentFunctionality(quantumComputation, optimized)) {
+                std::cerr << "The optimized circuit is not equivalent to the original one\n";
+                return false;
+            }
+            quantumComputation = std::move(optimized);
+        }
+    }
+
+    if (statistics != nullptr) {
+        statistics->set("initial_quantum_cost", initialCost);
+        statistics->set("quantum_cost", shared.cost);
+        statistics->set("accepted_rewrites", accepted.load());
+        statistics->set("discarded_rewrites", discarded.load());
+        statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+    return true;
+}
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/windowed_resynthesis.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/parallel_for.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using Gate  = BitParallelGate;
+    using Gates = std::vector<Gate>;
+    using Cost  = AnnotatableQuantumComputation::SynthesisCostMetricValue;
+
+    // the permutation of a window maps every assignment of its qubits (bit j is the value of the j-th qubit) to the resulting assignment
+    using Permutation = std::vector<std::uint8_t>;
+
+    constexpr std::size_t MAX_WINDOW_QUBITS = 8U;
+
+    // the gates [begin, end) of a circuit touching the given qubits (sorted by their index)
+    struct Window {
+        std::size_t            begin = 0U;
+        std::size_t            end   = 0U;
+        std::vector<qc::Qubit> qubits;
+        std::optional<Gates>   replacement;
+    };
+
+    std::vector<qc::Qubit> qubitsOf(const Gate& gate) {
+        std::vector<qc::Qubit> qubits;
+        qubits.reserve(gate.controls.size() + 2U);
+        for (const auto& control: gate.controls) {
+            qubits.emplace_back(control.first);
+        }
+        qubits.emplace_back(gate.target1);
+        if (gate.swap) {
+            qubits.emplace_back(gate.target2);
+        }
+        std::sort(qubits.begin(), qubits.end());
+        qubits.erase(std::unique(qubits.begin(), qubits.end()), qubits.end());
+        return qubits;
+    }
+
+    Cost costOf(const Gate& gate, const std::size_t nQubits) {
+        return AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(gate.controls.size(), gate.swap ? qc::OpType::SWAP : qc::OpType::X, nQubits);
+    }
+
+    template<typename It>
+    Cost costOf(It first, const It last, const std::size_t nQubits) {
+        Cost cost = 0U;
+        for (; first != last; ++first) {
+            cost += costOf(*first, nQubits);
+        }
+        return cost;
+    }
+
+    // partition the gates greedily into maximal windows, gates touching more than maxQubits qubits as well as windows with less than minGates gates are skipped
+    std::vector<Window> partition(const Gates& gates, const std::size_t maxQubits, const std::size_t minGates) {
+        std::vector<Window> windows;
+        Window              current;
+        const auto          close = [&]() {
+            if (current.end - current.begin >= std::max<std::size_t>(minGates, 1U)) {
+                windows.emplace_back(std::move(current));
+            }
+            current = Window{};
+        };
+
+        for (std::size_t i = 0U; i < gates.size(); ++i) {
+            const auto             qubits = qubitsOf(gates[i]);
+            std::vector<qc::Qubit> merged;
+            std::set_union(current.qubits.cbegin(), current.qubits.cend(), qubits.cbegin(), qubits.cend(), std::back_inserter(merged));
+            if (merged.size() > maxQubits) {
+                close();
+                if (qubits.size() > maxQubits) {
+                    continue;
+                }
+                merged = qubits;
+            }
+            if (current.qubits.empty()) {
+                current.begin = i;
+            }
+            current.end    = i + 1U;
+            current.qubits = std::move(merged);
+        }
+        close();
+        return windows;
+    }
+
+    // map the qubits of a gate to their index in qubits (local = true) or the other way around
+    Gate remap(Gate gate, const std::vector<qc::Qubit>& qubits, const bool local) {
+        const auto map = [&](const qc::Qubit qubit) {
+            return local ? static_cast<qc::Qubit>(std::lower_bound(qubits.cbegin(), qubits.cend(), qubit) - qubits.cbegin()) : qubits[qubit];
+        };
+        gate.target1 = map(gate.target1);
+        gate.target2 = gate.swap ? map(gate.target2) : gate.target2;
+        for (auto& control: gate.controls) {
+            control.first = map(control.first);
+        }
+        return gate;
+    }
+
+    Permutation permutationOf(const Gates& localGates, const std::size_t nQubits) {
+        const std::size_t      nAssignments = 1ULL << nQubits;
+        Permutation            permutation(nAssignments);
+        std::vector<qc::Qubit> qubits(nQubits);
+        std::iota(qubits.begin(), qubits.end(), 0U);
+        std::vector<std::uint64_t> state(nQubits);
+
+        for (std::uint64_t base = 0U; base < nAssignments; base += 64U) {
+            assignBitParallelBlock(state, qubits, base);
+            simulateBitParallel(localGates, state);
+            for (std::uint64_t k = 0U; k < 64U && base + k < nAssignments; ++k) {
+                std::uint8_t output = 0U;
+                for (std::size_t j = 0U; j < nQubits; ++j) {
+                    output |= static_cast<std::uint8_t>(((state[j] >> k) & 1U) << j);
+                }
+                permutation[base + k] = output;
+            }
+        }
+        return permutation;
+    }
+
+    // resynthesize a permutation, the resulting gates act on the qubits 0, ..., nQubits - 1 and are verified by simulation
+    std::optional<Gates> resynthesize(const Permutation& permutation, const std::size_t nQubits) {
+        // the truth table is built as by buildTruthTable, i.e. the i-th input corresponds to qubit i and the i-th output to qubit nQubits - 1 - i
+        TruthTable tt;
+        for (std::size_t assignment = 0U; assignment < permutation.size(); ++assignment) {
+            TruthTable::Cube input;
+            TruthTable::Cube output;
+            for (std::size_t i = 0U; i < nQubits; ++i) {
+                input.emplace_back(((assignment >> i) & 1U) != 0U);
+                output.emplace_back(((permutation[assignment] >> (nQubits - 1U - i)) & 1U) != 0U);
+            }
+            tt.try_emplace(std::move(input), std::move(output));
+        }
+
+        const auto synthesized = DDSynthesizer::synthesizeOnePass(tt);
+        if (synthesized == nullptr || synthesized->getNqubits() != nQubits) {
+            return std::nullopt;
+        }
+        auto gates = compileBitParallel(*synthesized);
+        if (!gates.has_value() || permutationOf(*gates, nQubits) != permutation) {
+            return std::nullopt;
+        }
+        return gates;
+    }
+
+    // resynthesized gates of the windows (std::nullopt if the resynthesis failed) indexed by the number of qubits and the permutation of a window
+    class ResynthesisCache {
+    public:
+        static std::string keyOf(const Permutation& permutation, const std::size_t nQubits) {
+            std::string key(1U, static_cast<char>(nQubits));
+            key.append(permutation.cbegin(), permutation.cend());
+            return key;
+        }
+
+        // the first lookup of a key resynthesizes the permutation, concurrent lookups of the same key wait for its result instead of resynthesizing it again
+        std::optional<Gates> findOrResynthesize(const std::string& key, const Permutation& permutation, const std::size_t nQubits, bool& hit) {
+            std::promise<std::optional<Gates>>       promise;
+            std::shared_future<std::optional<Gates>> entry;
+            {
+                const std::lock_guard lock(mutex);
+                const auto [it, inserted] = entries.try_emplace(key);
+                if (inserted) {
+                    it->second = promise.get_future().share();
+                }
+                entry = it->second;
+                hit   = !inserted;
+            }
+            if (!hit) {
+                try {
+                    promise.set_value(resynthesize(permutation, nQubits));
+                } catch (...) {
+                    promise.set_exception(std::current_exception());
+                }
+            }
+            return entry.get();
+        }
+
+    private:
+        std::mutex                                                                 mutex;
+        std::unordered_map<std::string, std::shared_future<std::optional<Gates>>> entries;
+    };
+} // namespace
+
+bool syrec::windowedResynthesis(qc::QuantumComputation& quantumComputation, const WindowedResynthesisSettings& settings, const Properties::ptr& statistics) {
+    const auto start = std::chrono::steady_clock::now();
+
+    if (settings.maxQubits == 0U || settings.maxQubits > MAX_WINDOW_QUBITS) {
+        std::cerr << "Windows have to touch between 1 and " << MAX_WINDOW_QUBITS << " qubits\n";
+        return false;
+    }
+
+    auto compiled = compileBitParallel(quantumComputation);
+    if (!compiled.has_value()) {
+        return false;
+    }
+    auto& gates = *compiled;
+
+    const auto nQubits     = quantumComputation.getNqubits();
+    const auto initialCost = costOf(gates.cbegin(), gates.cend(), nQubits);
+    auto       cost        = initialCost;
+
+    ResynthesisCache           cache;
+    std::uint64_t              nWindows  = 0U;
+    std::uint64_t              nReplaced = 0U;
+    std::atomic<std::uint64_t> cacheHits{0U};
+
+    for (std::size_t pass = 0U; pass < settings.maxPasses; ++pass) {
+        auto windows = partition(gates, settings.maxQubits, settings.minGates);
+        nWindows += windows.size();
+
+        parallelFor(windows.size(), settings.nThreads, [&](const std::size_t i) {
+            auto& window = windows[i];
+
+            Gates localGates;
+            localGates.reserve(window.end - window.begin);
+            for (auto j = window.begin; j < window.end; ++j) {
+                localGates.emplace_back(remap(gates[j], window.qubits, true));
+            }
+
+            const auto permutation = permutationOf(localGates, window.qubits.size());
+            bool       hit         = false;
+            const auto candidate   = cache.findOrResynthesize(ResynthesisCache::keyOf(permutation, window.qubits.size()), permutation, window.qubits.size(), hit);
+            if (hit) {
+                ++cacheHits;
+            }
+
+            if (candidate.has_value() && costOf(candidate->cbegin(), candidate->cend(), nQubits) < costOf(gates.cbegin() + static_cast<std::ptrdiff_t>(window.begin), gates.cbegin() + static_cast<std::ptrdiff_t>(window.end), nQubits)) {
+                Gates replacement;
+                replacement.reserve(candidate->size());
+                for (const auto& gate: *candidate) {
+                    replacement.emplace_back(remap(gate, window.qubits, false));
+                }
+                window.replacement = std::move(replacement);
+            }
+        });
+
+        // splice the replacements into the circuit
+        Gates       spliced;
+        std::size_t next     = 0U;
+        bool        improved = false;
+        for (auto& window: windows) {
+            if (!window.replacement.has_value()) {
+                continue;
+            }
+            spliced.insert(spliced.end(), gates.cbegin() + static_cast<std::ptrdiff_t>(next), gates.cbegin() + static_cast<std::ptrdiff_t>(window.begin));
+            spliced.insert(spliced.end(), window.replacement->cbegin(), window.replacement->cend());
+            next     = window.end;
+            improved = true;
+            ++nReplaced;
+        }
+        if (!improved) {
+            break;
+        }
+        spliced.insert(spliced.end(), gates.cbegin() + static_cast<std::ptrdiff_t>(next), gates.cend());
+        gates = std::move(spliced);
+        cost  = costOf(gates.cbegin(), gates.cend(), nQubits);
+    }
+
+    if (cost < initialCost) {
+        replaceByBitParallelGates(quantumComputation, gates);
+    }
+
+    if (statistics != nullptr) {
+        statistics->set("initial_quantum_cost", initialCost);
+        statistics->set("quantum_cost", cost);
+        statistics->set("windows", nWindows);
+        statistics->set("replaced_windows", nReplaced);
+        statistics->set("cache_hits", cacheHits.load());
+        statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+    return true;
+}
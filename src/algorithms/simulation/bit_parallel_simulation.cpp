@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+
+#include "algorithms/simulation/waveform_trace.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    // values of the six least significant bits of the assignments 0, ..., 63 of a block
+    constexpr std::uint64_t BLOCK_PATTERNS[] = {0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL, 0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+} // namespace
+
+std::optional<std::vector<syrec::BitParallelGate>> syrec::compileBitParallel(const qc::QuantumComputation& quantumComputation) {
+    std::vector<BitParallelGate> gates;
+    gates.reserve(quantumComputation.getNops());
+    for (const auto& op: quantumComputation) {
+        BitParallelGate gate;
+        const auto&     targets = op->getTargets();
+        if (op->getType() == qc::OpType::X && targets.size() == 1U) {
+            gate.target1 = targets.front();
+        } else if (op->getType() == qc::OpType::SWAP && targets.size() == 2U) {
+            gate.swap    = true;
+            gate.target1 = targets[0];
+            gate.target2 = targets[1];
+        } else {
+            std::cerr << "Cannot simulate gate of type " << std::to_string(op->getType()) << " bit-parallel\n";
+            return std::nullopt;
+        }
+        for (const auto& control: op->getControls()) {
+            gate.controls.emplace_back(control.qubit, control.type == qc::Control::Type::Pos);
+        }
+        gates.emplace_back(std::move(gate));
+    }
+    return gates;
+}
+
+void syrec::replaceByBitParallelGates(qc::QuantumComputation& quantumComputation, const std::vector<BitParallelGate>& gates) {
+    quantumComputation.clear();
+    for (const auto& gate: gates) {
+        qc::Controls controls;
+        for (const auto& [qubit, positive]: gate.controls) {
+            controls.emplace(qc::Control{qubit, positive ? qc::Control::Type::Pos : qc::Control::Type::Neg});
+        }
+        if (gate.swap) {
+            quantumComputation.emplace_back<qc::StandardOperation>(controls, qc::Targets{gate.target1, gate.target2}, qc::OpType::SWAP);
+        } else {
+            quantumComputation.emplace_back<qc::StandardOperation>(controls, qc::Targets{gate.target1}, qc::OpType::X);
+        }
+    }
+}
+
+void syrec::assignBitParallelBlock(std::vector<std::uint64_t>& state, const std::vector<qc::Qubit>& qubits, const std::uint64_t base) {
+    for (std::size_t k = 0U; k < qubits.size(); ++k) {
+        state[qubits[k]] = k < std::size(BLOCK_PATTERNS) ? BLOCK_PATTERNS[k] : ((k < 64U && ((base >> k) & 1U) != 0U) ? ~0ULL : 0U);
+    }
+}
+
+void syrec::simulateBitParallel(const std::vector<BitParallelGate>& gates, std::vector<std::uint64_t>& state) {
+    for (const auto& gate: gates) {
+        gate.apply(state);
+    }
+}
+
+syrec::WordPackedGates::WordPackedGates(const std::vector<BitParallelGate>& bitParallelGates, const std::size_t nQubits):
+    nQubits(nQubits) {
+    gates.reserve(bitParallelGates.size());
+    for (const auto& bitParallelGate: bitParallelGates) {
+        Gate gate;
+        gate.swap    = bitParallelGate.swap;
+        gate.target1 = bitParallelGate.target1;
+        gate.target2 = bitParallelGate.target2;
+
+        // the controls are ordered by their qubit, thus the controls in the same word are consecutive
+        gate.firstControlWord = controlWords.size();
+        for (const auto& [qubit, positive]: bitParallelGate.controls) {
+            const std::size_t word = qubit / 64U;
+            const auto        bit  = 1ULL << (qubit % 64U);
+            if (controlWords.size() == gate.firstControlWord || controlWords.back().word != word) {
+                controlWords.emplace_back(ControlWord{word, 0U, 0U});
+            }
+            controlWords.back().mask |= bit;
+            if (positive) {
+                controlWords.back().expected |= bit;
+            }
+        }
+        gate.endControlWord = controlWords.size();
+        gates.emplace_back(gate);
+    }
+}
+
+std::optional<syrec::WordPackedGates> syrec::WordPackedGates::compile(const qc::QuantumComputation& quantumComputation) {
+    const auto gates = compileBitParallel(quantumComputation);
+    if (!gates.has_value()) {
+        return std::nullopt;
+    }
+    return WordPackedGates(*gates, quantumComputation.getNqubits());
+}
+
+template<bool Traced>
+void syrec::WordPackedGates::simulateGates(std::vector<std::uint64_t>& state, [[maybe_unused]] WaveformTrace* trace) const {
+    for (std::size_t g = 0U; g < gates.size(); ++g) {
+        const auto&   gate     = gates[g];
+        std::uint64_t mismatch = 0U;
+        for (auto i = gate.firstControlWord; i < gate.endControlWord; ++i) {
+            const auto& controlWord = controlWords[i];
+            mismatch |= (state[controlWord.word] ^ controlWord.expected) & controlWord.mask;
+        }
+        // one if all controls are satisfied, zero otherwise
+        const auto active = static_cast<std::uint64_t>(mismatch == 0U);
+
+        auto&      word1 = state[gate.target1 / 64U];
+        const auto bit1  = gate.target1 % 64U;
+        if (gate.swap) {
+            auto&      word2 = state[gate.target2 / 64U];
+            const auto bit2  = gate.target2 % 64U;
+            const auto diff  = (((word1 >> bit1) ^ (word2 >> bit2)) & 1U) & active;
+            word1 ^= diff << bit1;
+            word2 ^= diff << bit2;
+            if constexpr (Traced) {
+                if (diff != 0U) {
+                    trace->recordChange(g, gate.target1);
+                    trace->recordChange(g, gate.target2);
+                }
+            }
+        } else {
+            word1 ^= active << bit1;
+            if constexpr (Traced) {
+                if (active != 0U) {
+                    trace->recordChange(g, gate.target1);
+                }
+            }
+        }
+    }
+}
+
+void syrec::WordPackedGates::simulate(std::vector<std::uint64_t>& state) const {
+    simulateGates<false>(state, nullptr);
+}
+
+void syrec::WordPackedGates::simulate(std::vector<std::uint64_t>& state, WaveformTrace& trace) const {
+    trace.begin(state, nQubits);
+    simulateGates<true>(state, &trace);
+    trace.end(gates.size());
+}
+
+bool syrec::WordPackedGates::simulate(NBitValuesContainer& output, const NBitValuesContainer& input) const {
+    if (input.size() != nQubits) {
+        std::cerr << "Input state size (" << input.size() << ") must match number of qubits in the quantum computation (" << nQubits << ")\n";
+        return false;
+    }
+
+    std::vector<std::uint64_t> state(getNwords(), 0U);
+    for (std::size_t qubit = 0U; qubit < nQubits; ++qubit) {
+        state[qubit / 64U] |= static_cast<std::uint64_t>(input[qubit]) << (qubit % 64U);
+    }
+    simulate(state);
+
+    output = NBitValuesContainer(nQubits);
+    for (std::size_t qubit = 0U; qubit < nQubits; ++qubit) {
+        output.set(qubit, ((state[qubit / 64U] >> (qubit % 64U)) & 1U) != 0U);
+    }
+    return true;
+}
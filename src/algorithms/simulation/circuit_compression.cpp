@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_compression.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "core/properties.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <iterator>
+#include <map>
+#include <optional>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    using Gate = BitParallelGate;
+
+    constexpr std::uint64_t HASH_BASE = 0x100000001B3ULL;
+
+    std::uint64_t mix(std::uint64_t value) {
+        // finalizer of splitmix64
+        value ^= value >> 30U;
+        value *= 0xBF58476D1CE4E5B9ULL;
+        value ^= value >> 27U;
+        value *= 0x94D049BB133111EBULL;
+        return value ^ (value >> 31U);
+    }
+
+    qc::Qubit lowestQubit(const Gate& gate) {
+        auto lowest = gate.swap ? std::min(gate.target1, gate.target2) : gate.target1;
+        if (!gate.controls.empty()) {
+            // the controls are ordered by their qubit
+            lowest = std::min(lowest, gate.controls.front().first);
+        }
+        return lowest;
+    }
+
+    // hash of the gate with all qubits given relative to its lowest qubit, thus gates which only differ by a shift of their qubits have the same hash
+    std::uint64_t relativeHash(const Gate& gate, const qc::Qubit lowest) {
+        auto hash = mix(gate.swap ? 2U : 1U);
+        hash      = mix(hash ^ (gate.target1 - lowest));
+        if (gate.swap) {
+            hash = mix(hash ^ (gate.target2 - lowest));
+        }
+        for (const auto& [qubit, positive]: gate.controls) {
+            hash = mix(hash ^ ((static_cast<std::uint64_t>(qubit - lowest) << 1U) | (positive ? 1U : 0U)));
+        }
+        return hash;
+    }
+
+    Gate shifted(Gate gate, const std::int64_t shift) {
+        const auto apply = [shift](const qc::Qubit qubit) { return static_cast<qc::Qubit>(static_cast<std::int64_t>(qubit) + shift); };
+        gate.target1     = apply(gate.target1);
+        gate.target2     = gate.swap ? apply(gate.target2) : gate.target2;
+        for (auto& control: gate.controls) {
+            control.first = apply(control.first);
+        }
+        return gate;
+    }
+
+    class SequenceFinder {
+    public:
+        explicit SequenceFinder(const std::vector<Gate>& gates):
+            gates(gates), lowest(gates.size()), shapes(gates.size()), prefix(gates.size() + 1U, 0U), powers(gates.size() + 1U, 1U) {
+            for (std::size_t i = 0U; i < gates.size(); ++i) {
+                lowest[i] = lowestQubit(gates[i]);
+                shapes[i] = relativeHash(gates[i], lowest[i]);
+                // a gate is encoded together with the distance of its lowest qubit to the lowest qubit of the preceding gate
+                const auto distance = i == 0U ? 0 : static_cast<std::int64_t>(lowest[i]) - static_cast<std::int64_t>(lowest[i - 1U]);
+                prefix[i + 1U]      = (prefix[i] * HASH_BASE) + mix(shapes[i] ^ static_cast<std::uint64_t>(distance));
+                powers[i + 1U]      = powers[i] * HASH_BASE;
+            }
+        }
+
+        // hash of the sequence [begin, begin + length), the distance of its first gate to the preceding gate is ignored
+        [[nodiscard]] std::uint64_t hash(const std::size_t begin, const std::size_t length) const {
+            const auto end = begin + length;
+            return mix(shapes[begin]) ^ (prefix[end] - (prefix[begin + 1U] * powers[end - begin - 1U]));
+        }
+
+        // whether the sequence starting at other equals the sequence starting at begin shifted by shift(begin, other)
+        [[nodiscard]] bool matches(const std::size_t begin, const std::size_t other, const std::size_t length) const {
+            const auto delta = shift(begin, other);
+            for (std::size_t j = 0U; j < length; ++j) {
+                if (shifted(gates[begin + j], delta) != gates[other + j]) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        [[nodiscard]] std::int64_t shift(const std::size_t begin, const std::size_t other) const {
+            return static_cast<std::int64_t>(lowest[other]) - static_cast<std::int64_t>(lowest[begin]);
+        }
+
+    private:
+        const std::vector<Gate>&   gates;
+        std::vector<qc::Qubit>     lowest;
+        std::vector<std::uint64_t> shapes;
+        std::vector<std::uint64_t> prefix;
+        std::vector<std::uint64_t> powers;
+    };
+
+    // disjoint intervals [begin, end) of the gates which are replaced by calls
+    class CoveredIntervals {
+    public:
+        [[nodiscard]] bool overlaps(const std::size_t begin, const std::size_t end) const {
+            auto it = intervals.lower_bound(end);
+            if (it == intervals.cbegin()) {
+                return false;
+            }
+            --it;
+            return it->second > begin;
+        }
+
+        void insert(const std::size_t begin, const std::size_t end) {
+            intervals.emplace(begin, end);
+        }
+
+    private:
+        std::map<std::size_t, std::size_t> intervals;
+    };
+
+    std::string gateToString(const Gate& gate) {
+        std::ostringstream os;
+        if (gate.swap) {
+            os << "swap " << gate.target1 << ' ' << gate.target2;
+        } else {
+            os << "x " << gate.target1;
+        }
+        for (const auto& [qubit, positive]: gate.controls) {
+            os << ' ' << qubit << (positive ? '+' : '-');
+        }
+        return os.str();
+    }
+
+    std::optional<Gate> gateFromStream(std::istream& is, const std::size_t nQubits) {
+        std::string type;
+        Gate        gate;
+        if (!(is >> type >> gate.target1) || gate.target1 >= nQubits) {
+            return std::nullopt;
+        }
+        if (type == "swap") {
+            gate.swap = true;
+            if (!(is >> gate.target2) || gate.target2 >= nQubits) {
+                return std::nullopt;
+            }
+        } else if (type != "x") {
+            return std::nullopt;
+        }
+        qc::Qubit qubit{};
+        char      polarity{};
+        while (is >> qubit >> polarity) {
+            if (qubit >= nQubits || (polarity != '+' && polarity != '-') || (!gate.controls.empty() && gate.controls.back().first >= qubit)) {
+                return std::nullopt;
+            }
+            gate.controls.emplace_back(qubit, polarity == '+');
+        }
+        if (!is.eof()) {
+            return std::nullopt;
+        }
+        return gate;
+    }
+} // namespace
+
+std::size_t CompressedCircuit::expandedSize() const {
+    std::size_t size = 0U;
+    for (const auto& step: body) {
+        size += std::holds_alternative<Call>(step) ? subroutines[std::get<Call>(step).subroutine].gates.size() : 1U;
+    }
+    return size;
+}
+
+std::size_t CompressedCircuit::compressedSize() const {
+    std::size_t size = body.size();
+    for (const auto& subroutine: subroutines) {
+        size += subroutine.gates.size();
+    }
+    return size;
+}
+
+std::vector<BitParallelGate> CompressedCircuit::expand() const {
+    std::vector<Gate> gates;
+    gates.reserve(expandedSize());
+    for (const auto& step: body) {
+        if (const auto* gate = std::get_if<Gate>(&step)) {
+            gates.emplace_back(*gate);
+            continue;
+        }
+        const auto& call = std::get<Call>(step);
+        for (auto gate: subroutines[call.subroutine].gates) {
+            gate.target1 = call.remap[gate.target1];
+            gate.target2 = gate.swap ? call.remap[gate.target2] : gate.target2;
+            for (auto& control: gate.controls) {
+                control.first = call.remap[control.first];
+            }
+            // the remap table is not necessarily monotonic
+            std::sort(gate.controls.begin(), gate.controls.end());
+            gates.emplace_back(std::move(gate));
+        }
+    }
+    return gates;
+}
+
+std::optional<CompressedCircuit> syrec::compressCircuit(const qc::QuantumComputation& quantumComputation, const CircuitCompressionSettings& settings, const Properties::ptr& statistics) {
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto compiled = compileBitParallel(quantumComputation);
+    if (!compiled.has_value()) {
+        return std::nullopt;
+    }
+    const auto& gates = *compiled;
+
+    CompressedCircuit compressed;
+    compressed.nQubits = quantumComputation.getNqubits();
+
+    const SequenceFinder finder(gates);
+    CoveredIntervals     covered;
+    // calls ordered by the first gate they replace
+    std::map<std::size_t, CompressedCircuit::Call> calls;
+
+    const auto minLength = std::max<std::size_t>(settings.minSequenceLength, 2U);
+    for (auto length = settings.maxSequenceLength; length >= minLength; length /= 2U) {
+        if (length > gates.size()) {
+            continue;
+        }
+
+        // uncovered sequences of the current length grouped by their hash (in the order of their first occurrence)
+        std::unordered_map<std::uint64_t, std::size_t> groupOfHash;
+        std::vector<std::vector<std::size_t>>          groups;
+        for (std::size_t begin = 0U; begin + length <= gates.size(); ++begin) {
+            if (covered.overlaps(begin, begin + length)) {
+                continue;
+            }
+            const auto [it, inserted] = groupOfHash.try_emplace(finder.hash(begin, length), groups.size());
+            if (inserted) {
+                groups.emplace_back();
+            }
+            groups[it->second].emplace_back(begin);
+        }
+
+        for (const auto& group: groups) {
+            if (group.size() < 2U) {
+                continue;
+            }
+            // choose non-overlapping occurrences which are still uncovered and identical to the first one up to a shift
+            std::vector<std::size_t> occurrences;
+            for (const auto begin: group) {
+                if ((!occurrences.empty() && begin < occurrences.back() + length) || covered.overlaps(begin, begin + length)) {
+                    continue;
+                }
+                if (occurrences.empty() || finder.matches(occurrences.front(), begin, length)) {
+                    occurrences.emplace_back(begin);
+                }
+            }
+            if (occurrences.size() < 2U) {
+                continue;
+            }
+
+            // the formal qubits of the subroutine are the qubits of the first occurrence in ascending order
+            const auto             first = occurrences.front();
+            std::vector<qc::Qubit> qubits;
+            for (std::size_t j = first; j < first + length; ++j) {
+                const auto& gate = gates[j];
+                qubits.emplace_back(gate.target1);
+                if (gate.swap) {
+                    qubits.emplace_back(gate.target2);
+                }
+                for (const auto& control: gate.controls) {
+                    qubits.emplace_back(control.first);
+                }
+            }
+            std::sort(qubits.begin(), qubits.end());
+            qubits.erase(std::unique(qubits.begin(), qubits.end()), qubits.end());
+
+            CompressedCircuit::Subroutine subroutine;
+            subroutine.nQubits = qubits.size();
+            const auto formal  = [&qubits](const qc::Qubit qubit) {
+                return static_cast<qc::Qubit>(std::lower_bound(qubits.cbegin(), qubits.cend(), qubit) - qubits.cbegin());
+            };
+            for (std::size_t j = first; j < first + length; ++j) {
+                auto gate    = gates[j];
+                gate.target1 = formal(gate.target1);
+                gate.target2 = gate.swap ? formal(gate.target2) : gate.target2;
+                for (auto& control: gate.controls) {
+                    control.first = formal(control.first);
+                }
+                subroutine.gates.emplace_back(std::move(gate));
+            }
+
+            for (const auto begin: occurrences) {
+                CompressedCircuit::Call call;
+                call.subroutine = compressed.subroutines.size();
+                const auto delta = finder.shift(first, begin);
+                for (const auto qubit: qubits) {
+                    call.remap.emplace_back(static_cast<qc::Qubit>(static_cast<std::int64_t>(qubit) + delta));
+                }
+                covered.insert(begin, begin + length);
+                calls.emplace(begin, std::move(call));
+            }
+            compressed.subroutines.emplace_back(std::move(subroutine));
+        }
+    }
+
+    for (std::size_t i = 0U; i < gates.size();) {
+        if (auto it = calls.find(i); it != calls.end()) {
+            i += compressed.subroutines[it->second.subroutine].gates.size();
+            compressed.body.emplace_back(std::move(it->second));
+        } else {
+            compressed.body.emplace_back(gates[i]);
+            ++i;
+        }
+    }
+
+    if (statistics != nullptr) {
+        statistics->set("subroutines", compressed.subroutines.size());
+        statistics->set("calls", calls.size());
+        statistics->set("compression_ratio", gates.empty() ? 1. : static_cast<double>(gates.size()) / static_cast<double>(compressed.compressedSize()));
+        statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+    return compressed;
+}
+
+void syrec::simulateBitParallel(const CompressedCircuit& circuit, std::vector<std::uint64_t>& state) {
+    std::vector<std::uint64_t> formalState;
+    for (const auto& step: circuit.body) {
+        if (const auto* gate = std::get_if<Gate>(&step)) {
+            gate->apply(state);
+            continue;
+        }
+        const auto& call = std::get<CompressedCircuit::Call>(step);
+        formalState.resize(call.remap.size());
+        for (std::size_t j = 0U; j < call.remap.size(); ++j) {
+            formalState[j] = state[call.remap[j]];
+        }
+        simulateBitParallel(circuit.subroutines[call.subroutine].gates, formalState);
+        for (std::size_t j = 0U; j < call.remap.size(); ++j) {
+            state[call.remap[j]] = formalState[j];
+        }
+    }
+}
+
+bool syrec::writeCompressedCircuit(const CompressedCircuit& circuit, std::ostream& os) {
+    os << "syrec-compressed-circuit 1\n";
+    os << "qubits " << circuit.nQubits << '\n';
+    os << "subroutines " << circuit.subroutines.size() << '\n';
+    for (const auto& subroutine: circuit.subroutines) {
+        os << "subroutine " << subroutine.nQubits << ' ' << subroutine.gates.size() << '\n';
+        for (const auto& gate: subroutine.gates) {
+            os << gateToString(gate) << '\n';
+        }
+    }
+    os << "body " << circuit.body.size() << '\n';
+    for (const auto& step: circuit.body) {
+        if (const auto* gate = std::get_if<Gate>(&step)) {
+            os << "gate " << gateToString(*gate) << '\n';
+            continue;
+        }
+        const auto& call = std::get<CompressedCircuit::Call>(step);
+        os << "call " << call.subroutine;
+        for (const auto qubit: call.remap) {
+            os << ' ' << qubit;
+        }
+        os << '\n';
+    }
+    return os.good();
+}
+
+std::string syrec::readCompressedCircuit(CompressedCircuit& circuit, std::istream& is) {
+    std::string line;
+    const auto  nextLine = [&](const std::string& keyword, std::istringstream& fields) {
+        if (!std::getline(is, line)) {
+            return false;
+        }
+        fields = std::istringstream(line);
+        std::string actual;
+        return fields >> actual && actual == keyword;
+    };
+
+    std::istringstream fields;
+    std::size_t        version = 0U;
+    if (!nextLine("syrec-compressed-circuit", fields) || !(fields >> version) || version != 1U) {
+        return "Not a compressed circuit (version 1)";
+    }
+
+    CompressedCircuit result;
+    std::size_t       nSubroutines = 0U;
+    if (!nextLine("qubits", fields) || !(fields >> result.nQubits) || !nextLine("subroutines", fields) || !(fields >> nSubroutines)) {
+        return "Invalid header of the compressed circuit";
+    }
+    for (std::size_t s = 0U; s < nSubroutines; ++s) {
+        CompressedCircuit::Subroutine subroutine;
+        std::size_t                   nGates = 0U;
+        if (!nextLine("subroutine", fields) || !(fields >> subroutine.nQubits >> nGates)) {
+            return "Invalid header of subroutine " + std::to_string(s);
+        }
+        for (std::size_t g = 0U; g < nGates; ++g) {
+            if (!std::getline(is, line)) {
+                return "Missing gate " + std::to_string(g) + " of subroutine " + std::to_string(s);
+            }
+            std::istringstream gateFields(line);
+            auto               gate = gateFromStream(gateFields, subroutine.nQubits);
+            if (!gate.has_value()) {
+                return "Invalid gate '" + line + "' in subroutine " + std::to_string(s);
+            }
+            subroutine.gates.emplace_back(std::move(*gate));
+        }
+        result.subroutines.emplace_back(std::move(subroutine));
+    }
+
+    std::size_t nSteps = 0U;
+    if (!nextLine("body", fields) || !(fields >> nSteps)) {
+        return "Invalid header of the body";
+    }
+    for (std::size_t i = 0U; i < nSteps; ++i) {
+        if (!std::getline(is, line)) {
+            return "Missing step " + std::to_string(i) + " of the body";
+        }
+        fields = std::istringstream(line);
+        std::string kind;
+        fields >> kind;
+        if (kind == "gate") {
+            auto gate = gateFromStream(fields, result.nQubits);
+            if (!gate.has_value()) {
+                return "Invalid gate '" + line + "' in the body";
+            }
+            result.body.emplace_back(std::move(*gate));
+        } else if (kind == "call") {
+            CompressedCircuit::Call call;
+            if (!(fields >> call.subroutine) || call.subroutine >= result.subroutines.size()) {
+                return "Invalid subroutine in call '" + line + "'";
+            }
+            qc::Qubit qubit{};
+            while (fields >> qubit) {
+                if (qubit >= result.nQubits || std::find(call.remap.cbegin(), call.remap.cend(), qubit) != call.remap.cend()) {
+                    return "Invalid remap table in call '" + line + "'";
+                }
+                call.remap.emplace_back(qubit);
+            }
+            if (!fields.eof() || call.remap.size() != result.subroutines[call.subroutine].nQubits) {
+                return "Invalid remap table in call '" + line + "'";
+            }
+            result.body.emplace_back(std::move(call));
+        } else {
+            return "Unknown step '" + line + "' in the body";
+        }
+    }
+
+    circuit = std::move(result);
+    return {};
+}
@@ -10,6 +10,7 @@
 
 #include "algorithms/simulation/circuit_to_truthtable.hpp"
 
+#include "algorithms/synthesis/dd_package_tuning.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/Package.hpp"
 #include "dd/Simulation.hpp"
@@ -29,7 +30,8 @@ namespace syrec {
 
         assert(nBits < 65U);
 
-        auto dd = std::make_unique<dd::Package>(nBits);
+        // the states and gates of a reversible circuit stay small, thus the package is sized by the circuit instead of the library defaults
+        auto dd = std::make_unique<dd::Package>(nBits, simulationPackageConfig(nBits, qc.getNops()));
 
         const auto totalInputs = 1U << nBits;
 
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/sequential_simulation.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "core/parallel_for.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t LANES = 64U;
+
+    // The qubits of the variables of the circuit ordered by their index, keyed by the name of the variable preceding the array index or bit of the label
+    std::map<std::string, std::vector<qc::Qubit>> qubitsOfVariables(const qc::QuantumComputation& quantumComputation) {
+        std::map<std::string, std::vector<qc::Qubit>> qubits;
+        for (const auto& [label, quantumRegister]: quantumComputation.getQuantumRegisters()) {
+            const auto end = label.find_first_of(".[");
+            if (end != std::string::npos) {
+                qubits[label.substr(0U, end)].emplace_back(quantumRegister.getStartIndex());
+            }
+        }
+        for (auto& [name, variableQubits]: qubits) {
+            std::sort(variableQubits.begin(), variableQubits.end());
+        }
+        return qubits;
+    }
+
+    // Adds the names of the state variables of the modules (un)called by the statements and by the called modules, keyed by the name of the module
+    void addStateVariablesOfCalledModules(const Statement::vec& statements, std::map<std::string, std::set<std::string>>& stateVariables) {
+        for (const auto& statement: statements) {
+            const Module* target = nullptr;
+            if (const auto* callStatement = dynamic_cast<const CallStatement*>(statement.get()); callStatement != nullptr) {
+                target = callStatement->target.get();
+            } else if (const auto* uncallStatement = dynamic_cast<const UncallStatement*>(statement.get()); uncallStatement != nullptr) {
+                target = uncallStatement->target.get();
+            } else if (const auto* forStatement = dynamic_cast<const ForStatement*>(statement.get()); forStatement != nullptr) {
+                addStateVariablesOfCalledModules(forStatement->statements, stateVariables);
+            } else if (const auto* ifStatement = dynamic_cast<const IfStatement*>(statement.get()); ifStatement != nullptr) {
+                addStateVariablesOfCalledModules(ifStatement->thenStatements, stateVariables);
+                addStateVariablesOfCalledModules(ifStatement->elseStatements, stateVariables);
+            }
+            if (target == nullptr || !stateVariables.try_emplace(target->name).second) {
+                continue;
+            }
+            for (const auto& variable: target->variables) {
+                if (variable->type == Variable::State) {
+                    stateVariables[target->name].emplace(variable->name);
+                }
+            }
+            addStateVariablesOfCalledModules(target->statements, stateVariables);
+        }
+    }
+
+    // The qubits of the state variables of the instances of the called modules, i.e. of the variables labelled '<module>#<instance>/<name>' (\see SyrecSynthesis#nextInstanceLabelPrefix)
+    std::vector<std::pair<std::string, std::vector<qc::Qubit>>> stateOfModuleInstances(const Module& mainModule, const std::map<std::string, std::vector<qc::Qubit>>& qubitsOfVariables) {
+        std::map<std::string, std::set<std::string>> stateVariables;
+        addStateVariablesOfCalledModules(mainModule.statements, stateVariables);
+
+        std::vector<std::pair<std::string, std::vector<qc::Qubit>>> state;
+        for (const auto& [name, qubits]: qubitsOfVariables) {
+            const auto instanceEnd = name.find('#');
+            const auto nameBegin   = name.find('/');
+            if (instanceEnd == std::string::npos || nameBegin == std::string::npos || nameBegin < instanceEnd) {
+                continue;
+            }
+            const auto module = stateVariables.find(name.substr(0U, instanceEnd));
+            if (module != stateVariables.cend() && module->second.count(name.substr(nameBegin + 1U)) != 0U) {
+                state.emplace_back(name, qubits);
+            }
+        }
+        return state;
+    }
+
+    struct Signal {
+        std::string            name;
+        std::vector<qc::Qubit> qubits;
+        const Variable*        variable = nullptr;
+    };
+
+    std::optional<Signal> findSignal(const std::string& name, const Module& mainModule, const std::map<std::string, std::vector<qc::Qubit>>& qubitsOfVariables) {
+        const Variable* variable = nullptr;
+        for (const auto* candidates: {&mainModule.parameters, &mainModule.variables}) {
+            const auto it = std::find_if(candidates->cbegin(), candidates->cend(), [&](const auto& candidate) { return candidate->name == name; });
+            if (it != candidates->cend()) {
+                variable = it->get();
+                break;
+            }
+        }
+
+        const auto qubits = qubitsOfVariables.find(name);
+        if (variable == nullptr || qubits == qubitsOfVariables.cend()) {
+            std::cerr << "Unknown signal " << name << " of the main module\n";
+            return std::nullopt;
+        }
+        if (qubits->second.size() > LANES) {
+            std::cerr << "Signal " << name << " has more than " << LANES << " qubits\n";
+            return std::nullopt;
+        }
+        return Signal{name, qubits->second, variable};
+    }
+
+    // Assigns the values of the lanes to the qubits of the signal, i.e. bit l of the state of the j-th qubit is bit j of the value of lane l
+    void assignLanes(std::vector<std::uint64_t>& state, const std::vector<qc::Qubit>& qubits, const std::uint64_t* values, const std::size_t nLanes) {
+        for (std::size_t j = 0U; j < qubits.size(); ++j) {
+            std::uint64_t word = 0U;
+            for (std::size_t l = 0U; l < nLanes; ++l) {
+                word |= ((values[l] >> j) & 1U) << l;
+            }
+            state[qubits[j]] = word;
+        }
+    }
+
+    void readLanes(const std::vector<std::uint64_t>& state, const std::vector<qc::Qubit>& qubits, std::uint64_t* values, const std::size_t nLanes) {
+        for (std::size_t l = 0U; l < nLanes; ++l) {
+            std::uint64_t value = 0U;
+            for (std::size_t j = 0U; j < qubits.size(); ++j) {
+                value |= ((state[qubits[j]] >> l) & 1U) << j;
+            }
+            values[l] = value;
+        }
+    }
+} // namespace
+
+std::optional<SequentialSimulationTrace> syrec::sequentialSimulation(const qc::QuantumComputation& quantumComputation, const Module& mainModule, const std::vector<SequentialStimulus>& stimuli, const SequentialSimulationSettings& settings, const Properties::ptr& statistics) {
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto gates = compileBitParallel(quantumComputation);
+    if (!gates.has_value()) {
+        return std::nullopt;
+    }
+
+    const auto               qubits = qubitsOfVariables(quantumComputation);
+    std::vector<Signal>      stateSignals;
+    std::vector<Signal>      drivenSignals;
+    std::vector<Signal>      recordedSignals;
+    std::vector<std::size_t> nDrivenCycles;
+    for (const auto& variable: mainModule.variables) {
+        if (variable->type == Variable::State) {
+            auto signal = findSignal(variable->name, mainModule, qubits);
+            if (!signal.has_value()) {
+                return std::nullopt;
+            }
+            stateSignals.emplace_back(std::move(*signal));
+        }
+    }
+    // every (un)call of a module with state variables is an instance of its own whose state is carried to the next cycle like the one of the main module
+    for (auto& [name, stateQubits]: stateOfModuleInstances(mainModule, qubits)) {
+        stateSignals.emplace_back(Signal{name, std::move(stateQubits), nullptr});
+    }
+    for (const auto& stimulus: stimuli) {
+        auto signal = findSignal(stimulus.signal, mainModule, qubits);
+        if (!signal.has_value()) {
+            return std::nullopt;
+        }
+        if (signal->variable->type != Variable::In && signal->variable->type != Variable::Inout && signal->variable->type != Variable::State) {
+            std::cerr << "Signal " << stimulus.signal << " is neither an in or inout parameter nor a state variable and cannot be driven\n";
+            return std::nullopt;
+        }
+        if (settings.nStreams == 0U || stimulus.values.size() % settings.nStreams != 0U) {
+            std::cerr << "Stimulus of signal " << stimulus.signal << " has no value for every stream of its last cycle\n";
+            return std::nullopt;
+        }
+        drivenSignals.emplace_back(std::move(*signal));
+        nDrivenCycles.emplace_back(std::min(stimulus.values.size() / settings.nStreams, settings.nCycles));
+    }
+    for (const auto& name: settings.recordedSignals) {
+        auto signal = findSignal(name, mainModule, qubits);
+        if (!signal.has_value()) {
+            return std::nullopt;
+        }
+        recordedSignals.emplace_back(std::move(*signal));
+    }
+
+    SequentialSimulationTrace trace;
+    trace.nCycles  = settings.nCycles;
+    trace.nStreams = settings.nStreams;
+    trace.signals  = settings.recordedSignals;
+    trace.values.assign(recordedSignals.size(), std::vector<std::uint64_t>(settings.nCycles * settings.nStreams, 0U));
+
+    // the buffers of a thread are reused for all of its blocks
+    const std::size_t                                    nBlocks  = (settings.nStreams + LANES - 1U) / LANES;
+    const auto                                           nThreads = parallelForThreads(nBlocks, settings.nThreads);
+    std::vector<std::vector<std::uint64_t>>              states(nThreads, std::vector<std::uint64_t>(quantumComputation.getNqubits(), 0U));
+    std::vector<std::vector<std::vector<std::uint64_t>>> carriedOfThreads(nThreads, std::vector<std::vector<std::uint64_t>>(stateSignals.size()));
+    parallelForPerThread(nBlocks, settings.nThreads, [&](const std::size_t block, const std::size_t thread) {
+        const std::size_t firstStream = block * LANES;
+        const std::size_t nLanes      = std::min(LANES, settings.nStreams - firstStream);
+        auto&             state       = states[thread];
+        auto&             carried     = carriedOfThreads[thread];
+        for (std::size_t i = 0U; i < stateSignals.size(); ++i) {
+            carried[i].assign(stateSignals[i].qubits.size(), 0U);
+        }
+
+        for (std::size_t cycle = 0U; cycle < settings.nCycles; ++cycle) {
+            std::fill(state.begin(), state.end(), 0U);
+            for (std::size_t i = 0U; i < stateSignals.size(); ++i) {
+                for (std::size_t j = 0U; j < stateSignals[i].qubits.size(); ++j) {
+                    state[stateSignals[i].qubits[j]] = carried[i][j];
+                }
+            }
+            for (std::size_t i = 0U; i < drivenSignals.size(); ++i) {
+                if (cycle < nDrivenCycles[i]) {
+                    assignLanes(state, drivenSignals[i].qubits, stimuli[i].values.data() + (cycle * settings.nStreams) + firstStream, nLanes);
+                }
+            }
+
+            simulateBitParallel(*gates, state);
+
+            for (std::size_t i = 0U; i < stateSignals.size(); ++i) {
+                for (std::size_t j = 0U; j < stateSignals[i].qubits.size(); ++j) {
+                    carried[i][j] = state[stateSignals[i].qubits[j]];
+                }
+            }
+            for (std::size_t i = 0U; i < recordedSignals.size(); ++i) {
+                readLanes(state, recordedSignals[i].qubits, trace.values[i].data() + (cycle * settings.nStreams) + firstStream, nLanes);
+            }
+        }
+    });
+
+    if (statistics) {
+        statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+    return trace;
+}
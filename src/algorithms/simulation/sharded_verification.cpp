@@ -0,0 +1,454 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/sharded_verification.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "core/parallel_for.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t   BLOCK_SIZE         = 64U;
+    constexpr std::uint64_t ALL_ONES           = ~0ULL;
+    constexpr char          CHECKPOINT_MAGIC[] = "syrec-verification-checkpoint";
+    constexpr unsigned      CHECKPOINT_VERSION = 1U;
+
+    struct BitParallelCircuit {
+        std::size_t                  nQubits = 0U;
+        std::vector<qc::Qubit>       primaryInputs;
+        std::vector<qc::Qubit>       primaryOutputs;
+        std::vector<BitParallelGate> gates;
+
+        // simulates the assignments of the primary inputs base, ..., base + 63 (base is a multiple of 64)
+        void simulate(const std::uint64_t base, std::vector<std::uint64_t>& state) const {
+            state.assign(nQubits, 0U);
+            assignBitParallelBlock(state, primaryInputs, base);
+            simulateBitParallel(gates, state);
+        }
+    };
+
+    struct Verification {
+        BitParallelCircuit circuit;
+        BitParallelCircuit reference;
+        std::uint64_t      fingerprint = 0U;
+
+        [[nodiscard]] std::uint64_t totalAssignments() const {
+            return 1ULL << circuit.primaryInputs.size();
+        }
+
+        // the shards consist of whole blocks such that all blocks (except for the last one) are aligned
+        [[nodiscard]] std::pair<std::uint64_t, std::uint64_t> shardRange(const std::size_t shard, const std::size_t nShards) const {
+            const auto total          = totalAssignments();
+            const auto nBlocks        = (total + BLOCK_SIZE - 1U) / BLOCK_SIZE;
+            const auto blocksPerShard = (nBlocks + nShards - 1U) / nShards;
+            const auto begin          = std::min(total, static_cast<std::uint64_t>(shard) * blocksPerShard * BLOCK_SIZE);
+            return {begin, std::min(total, begin + (blocksPerShard * BLOCK_SIZE))};
+        }
+    };
+
+    struct ShardCheckpoint {
+        std::uint64_t               fingerprint = 0U;
+        std::size_t                 shard       = 0U;
+        std::size_t                 nShards     = 0U;
+        std::uint64_t               begin       = 0U;
+        std::uint64_t               end         = 0U;
+        std::uint64_t               next        = 0U;
+        std::uint64_t               mismatches  = 0U;
+        std::vector<Counterexample> counterexamples;
+    };
+
+    class FingerprintBuilder {
+    public:
+        void add(const std::uint64_t value) {
+            // 64-bit FNV-1a over the bytes of the value
+            for (std::size_t i = 0U; i < sizeof(value); ++i) {
+                hash ^= (value >> (8U * i)) & 0xFFU;
+                hash *= 1099511628211ULL;
+            }
+        }
+
+        void addCircuit(const qc::QuantumComputation& qc) {
+            add(qc.getNqubits());
+            add(qc.getNops());
+            for (std::size_t i = 0U; i < qc.getNqubits(); ++i) {
+                add((qc.getAncillary()[i] ? 1U : 0U) | (qc.getGarbage()[i] ? 2U : 0U));
+            }
+            for (const auto& op: qc) {
+                add(static_cast<std::uint64_t>(op->getType()));
+                for (const auto target: op->getTargets()) {
+                    add(target);
+                }
+                for (const auto& control: op->getControls()) {
+                    add((static_cast<std::uint64_t>(control.qubit) << 1U) | (control.type == qc::Control::Type::Pos ? 1U : 0U));
+                }
+            }
+        }
+
+        [[nodiscard]] std::uint64_t get() const {
+            return hash;
+        }
+
+    private:
+        std::uint64_t hash = 14695981039346656037ULL;
+    };
+
+    std::optional<BitParallelCircuit> compile(const qc::QuantumComputation& qc) {
+        BitParallelCircuit circuit;
+        circuit.nQubits = qc.getNqubits();
+        for (std::size_t i = 0U; i < circuit.nQubits; ++i) {
+            if (!qc.getAncillary()[i]) {
+                circuit.primaryInputs.emplace_back(static_cast<qc::Qubit>(i));
+            }
+            if (!qc.getGarbage()[i]) {
+                circuit.primaryOutputs.emplace_back(static_cast<qc::Qubit>(i));
+            }
+        }
+
+        auto gates = compileBitParallel(qc);
+        if (!gates.has_value()) {
+            return std::nullopt;
+        }
+        circuit.gates = std::move(*gates);
+        return circuit;
+    }
+
+    std::optional<Verification> prepare(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const ShardedVerificationSettings& settings) {
+        if (settings.nShards == 0U) {
+            std::cerr << "The number of shards must be positive\n";
+            return std::nullopt;
+        }
+
+        Verification verification;
+        auto         compiledCircuit   = compile(circuit);
+        auto         compiledReference = compile(reference);
+        if (!compiledCircuit.has_value() || !compiledReference.has_value()) {
+            return std::nullopt;
+        }
+        verification.circuit   = std::move(*compiledCircuit);
+        verification.reference = std::move(*compiledReference);
+
+        if (verification.circuit.primaryInputs.size() != verification.reference.primaryInputs.size() || verification.circuit.primaryOutputs.size() != verification.reference.primaryOutputs.size()) {
+            std::cerr << "The circuit (" << verification.circuit.primaryInputs.size() << " primary inputs, " << verification.circuit.primaryOutputs.size() << " primary outputs) and the reference ("
+                      << verification.reference.primaryInputs.size() << " primary inputs, " << verification.reference.primaryOutputs.size() << " primary outputs) do not have the same interface\n";
+            return std::nullopt;
+        }
+        if (verification.circuit.primaryInputs.size() >= 64U) {
+            std::cerr << "Overflow!, Number of primary inputs is greater than maximum capacity (63)\n";
+            return std::nullopt;
+        }
+
+        FingerprintBuilder fingerprint;
+        fingerprint.addCircuit(circuit);
+        fingerprint.addCircuit(reference);
+        fingerprint.add(settings.nShards);
+        verification.fingerprint = fingerprint.get();
+        return verification;
+    }
+
+    std::optional<ShardCheckpoint> readCheckpoint(const std::string& filename) {
+        std::ifstream is(filename);
+        if (!is.good()) {
+            return std::nullopt;
+        }
+
+        std::string     magic;
+        unsigned        version = 0U;
+        ShardCheckpoint checkpoint;
+        std::string     key;
+        std::size_t     nCounterexamples = 0U;
+        is >> magic >> version;
+        is >> key >> checkpoint.fingerprint;
+        is >> key >> checkpoint.shard >> checkpoint.nShards;
+        is >> key >> checkpoint.begin >> checkpoint.end >> checkpoint.next;
+        is >> key >> checkpoint.mismatches;
+        is >> key >> nCounterexamples;
+        if (is.fail() || magic != CHECKPOINT_MAGIC || version != CHECKPOINT_VERSION) {
+            return std::nullopt;
+        }
+        for (std::size_t i = 0U; i < nCounterexamples; ++i) {
+            Counterexample counterexample;
+            if (!(is >> counterexample.input >> counterexample.output >> counterexample.expected)) {
+                return std::nullopt;
+            }
+            checkpoint.counterexamples.emplace_back(std::move(counterexample));
+        }
+        return checkpoint;
+    }
+
+    // the checkpoint is written to a temporary file first such that a crash while writing does not destroy the previous checkpoint
+    bool writeCheckpoint(const std::string& filename, const ShardCheckpoint& checkpoint) {
+        const auto temporaryFilename = filename + ".tmp";
+        {
+            std::ofstream os(temporaryFilename, std::ios::out | std::ios::trunc);
+            os << CHECKPOINT_MAGIC << ' ' << CHECKPOINT_VERSION << '\n';
+            os << "fingerprint " << checkpoint.fingerprint << '\n';
+            os << "shard " << checkpoint.shard << ' ' << checkpoint.nShards << '\n';
+            os << "range " << checkpoint.begin << ' ' << checkpoint.end << ' ' << checkpoint.next << '\n';
+            os << "mismatches " << checkpoint.mismatches << '\n';
+            os << "counterexamples " << checkpoint.counterexamples.size() << '\n';
+            for (const auto& counterexample: checkpoint.counterexamples) {
+                os << counterexample.input << ' ' << counterexample.output << ' ' << counterexample.expected << '\n';
+            }
+            if (!os.good()) {
+                std::cerr << "Cannot write checkpoint " << temporaryFilename << '\n';
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(temporaryFilename, filename, ec);
+        if (ec) {
+            std::cerr << "Cannot write checkpoint " << filename << ": " << ec.message() << '\n';
+            return false;
+        }
+        return true;
+    }
+
+    bool isCompleted(const Verification& verification, const ShardedVerificationSettings& settings, const std::size_t shard) {
+        const auto checkpoint = readCheckpoint(shardCheckpointFilename(settings, shard));
+        return checkpoint.has_value() && checkpoint->fingerprint == verification.fingerprint && checkpoint->next >= checkpoint->end;
+    }
+
+    std::string outputValues(const std::vector<qc::Qubit>& outputs, const std::vector<std::uint64_t>& state, const std::size_t bit) {
+        std::string values;
+        values.reserve(outputs.size());
+        for (const auto qubit: outputs) {
+            values.push_back(((state[qubit] >> bit) & 1U) != 0U ? '1' : '0');
+        }
+        return values;
+    }
+
+    // verifies a shard of the circuits compiled once by prepare
+    bool verifyPreparedShard(const Verification& verification, const std::size_t shard, const ShardedVerificationSettings& settings) {
+        if (shard >= settings.nShards) {
+            std::cerr << "Shard " << shard << " does not exist, there are " << settings.nShards << " shards only\n";
+            return false;
+        }
+
+        const auto filename = shardCheckpointFilename(settings, shard);
+        auto       state    = readCheckpoint(filename);
+        if (!state.has_value() || state->fingerprint != verification.fingerprint || state->shard != shard || state->nShards != settings.nShards) {
+            // no checkpoint of this verification, start from scratch
+            state              = ShardCheckpoint{};
+            state->fingerprint = verification.fingerprint;
+            state->shard       = shard;
+            state->nShards     = settings.nShards;
+
+            const auto [begin, end] = verification.shardRange(shard, settings.nShards);
+            state->begin            = begin;
+            state->end              = end;
+            state->next             = begin;
+        }
+
+        std::vector<std::uint64_t> circuitState;
+        std::vector<std::uint64_t> referenceState;
+        std::uint64_t              checkedInThisRun   = 0U;
+        std::uint64_t              lastCheckpointNext = state->next;
+        while (state->next < state->end && (settings.maxAssignmentsPerRun == 0U || checkedInThisRun < settings.maxAssignmentsPerRun)) {
+            const auto base   = state->next;
+            const auto nValid = std::min<std::uint64_t>(BLOCK_SIZE, state->end - base);
+            const auto valid  = nValid == BLOCK_SIZE ? ALL_ONES : ((1ULL << nValid) - 1U);
+
+            verification.circuit.simulate(base, circuitState);
+            verification.reference.simulate(base, referenceState);
+
+            std::uint64_t diff = 0U;
+            for (std::size_t k = 0U; k < verification.circuit.primaryOutputs.size(); ++k) {
+                diff |= circuitState[verification.circuit.primaryOutputs[k]] ^ referenceState[verification.reference.primaryOutputs[k]];
+            }
+            diff &= valid;
+
+            if (diff != 0U) {
+                state->mismatches += std::bitset<BLOCK_SIZE>(diff).count();
+                for (std::size_t bit = 0U; bit < BLOCK_SIZE && state->counterexamples.size() < settings.maxCounterexamples; ++bit) {
+                    if (((diff >> bit) & 1U) != 0U) {
+                        state->counterexamples.push_back({base + bit, outputValues(verification.circuit.primaryOutputs, circuitState, bit), outputValues(verification.reference.primaryOutputs, referenceState, bit)});
+                    }
+                }
+            }
+
+            state->next += nValid;
+            checkedInThisRun += nValid;
+            if (state->next - lastCheckpointNext >= settings.checkpointInterval) {
+                if (!writeCheckpoint(filename, *state)) {
+                    return false;
+                }
+                lastCheckpointNext = state->next;
+            }
+        }
+        return writeCheckpoint(filename, *state);
+    }
+
+    // merges the checkpoints of the shards of the circuits compiled once by prepare
+    VerificationReport mergePreparedShardCheckpoints(const Verification& verification, const ShardedVerificationSettings& settings) {
+        VerificationReport report;
+        report.totalAssignments = verification.totalAssignments();
+        for (std::size_t shard = 0U; shard < settings.nShards; ++shard) {
+            const auto checkpoint = readCheckpoint(shardCheckpointFilename(settings, shard));
+            if (!checkpoint.has_value() || checkpoint->fingerprint != verification.fingerprint || checkpoint->shard != shard) {
+                report.incompleteShards.emplace_back(shard);
+                continue;
+            }
+            report.checkedAssignments += checkpoint->next - checkpoint->begin;
+            report.mismatches += checkpoint->mismatches;
+            report.counterexamples.insert(report.counterexamples.end(), checkpoint->counterexamples.cbegin(), checkpoint->counterexamples.cend());
+            if (checkpoint->next < checkpoint->end) {
+                report.incompleteShards.emplace_back(shard);
+            }
+        }
+
+        std::sort(report.counterexamples.begin(), report.counterexamples.end(), [](const auto& lhs, const auto& rhs) { return lhs.input < rhs.input; });
+        if (report.counterexamples.size() > settings.maxCounterexamples) {
+            report.counterexamples.resize(settings.maxCounterexamples);
+        }
+        return report;
+    }
+
+    // verifies the shards in threads of the calling process and returns the shards whose verification failed
+    std::vector<std::size_t> verifyInThreads(const Verification& verification, const std::vector<std::size_t>& shards, const ShardedVerificationSettings& settings, const std::size_t nWorkers) {
+        std::vector<char> failed(shards.size(), 0);
+        parallelFor(shards.size(), nWorkers, [&](const std::size_t i) { failed[i] = verifyPreparedShard(verification, shards[i], settings) ? 0 : 1; });
+
+        std::vector<std::size_t> failedShards;
+        for (std::size_t i = 0U; i < shards.size(); ++i) {
+            if (failed[i] != 0) {
+                failedShards.emplace_back(shards[i]);
+            }
+        }
+        return failedShards;
+    }
+
+#ifndef _WIN32
+    // waits for the given worker process only (the calling process may have other children) and returns whether it verified its shard
+    bool joinWorkerProcess(const pid_t pid) {
+        int status = 0;
+        while (waitpid(pid, &status, 0) < 0) {
+            if (errno != EINTR) {
+                return false;
+            }
+        }
+        return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    }
+
+    // verifies every shard in a forked process, thus a crashing worker does not affect the other shards, and returns the shards whose verification failed
+    std::vector<std::size_t> verifyInProcesses(const Verification& verification, const std::vector<std::size_t>& shards, const ShardedVerificationSettings& settings, const std::size_t nWorkers) {
+        std::vector<std::size_t>                  failedShards;
+        std::deque<std::pair<pid_t, std::size_t>> running;
+        const auto                                joinOldestWorker = [&]() {
+            if (!joinWorkerProcess(running.front().first)) {
+                failedShards.emplace_back(running.front().second);
+            }
+            running.pop_front();
+        };
+
+        for (const auto shard: shards) {
+            if (running.size() == nWorkers) {
+                joinOldestWorker();
+            }
+
+            std::cout.flush();
+            std::cerr.flush();
+            if (const auto pid = fork(); pid == 0) {
+                _exit(verifyPreparedShard(verification, shard, settings) ? 0 : 1);
+            } else if (pid > 0) {
+                running.emplace_back(pid, shard);
+            } else if (!verifyPreparedShard(verification, shard, settings)) {
+                // the worker cannot be forked, thus the shard is verified by the calling process
+                failedShards.emplace_back(shard);
+            }
+        }
+        while (!running.empty()) {
+            joinOldestWorker();
+        }
+        return failedShards;
+    }
+#endif
+} // namespace
+
+std::string syrec::shardCheckpointFilename(const ShardedVerificationSettings& settings, const std::size_t shard) {
+    return (std::filesystem::path(settings.directory) / ("shard_" + std::to_string(shard) + ".checkpoint")).string();
+}
+
+bool syrec::verifyShard(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const std::size_t shard, const ShardedVerificationSettings& settings) {
+    const auto verification = prepare(circuit, reference, settings);
+    return verification.has_value() && verifyPreparedShard(*verification, shard, settings);
+}
+
+VerificationReport syrec::mergeShardCheckpoints(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const ShardedVerificationSettings& settings) {
+    const auto verification = prepare(circuit, reference, settings);
+    if (!verification.has_value()) {
+        VerificationReport report;
+        for (std::size_t shard = 0U; shard < settings.nShards; ++shard) {
+            report.incompleteShards.emplace_back(shard);
+        }
+        return report;
+    }
+    return mergePreparedShardCheckpoints(*verification, settings);
+}
+
+VerificationReport syrec::verifyExhaustively(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const ShardedVerificationSettings& settings) {
+    const auto verification = prepare(circuit, reference, settings);
+    if (!verification.has_value()) {
+        return mergeShardCheckpoints(circuit, reference, settings);
+    }
+
+    std::error_code ec;
+    std::filesystem::create_directories(settings.directory, ec);
+
+    std::vector<std::size_t> pendingShards;
+    for (std::size_t shard = 0U; shard < settings.nShards; ++shard) {
+        if (!isCompleted(*verification, settings, shard)) {
+            pendingShards.emplace_back(shard);
+        }
+    }
+    const auto nWorkers = std::max<std::size_t>(1U, std::min(settings.nWorkers, pendingShards.size()));
+
+#ifndef _WIN32
+    const auto failedShards = settings.isolateWorkers ? verifyInProcesses(*verification, pendingShards, settings, nWorkers) : verifyInThreads(*verification, pendingShards, settings, nWorkers);
+#else
+    const auto failedShards = verifyInThreads(*verification, pendingShards, settings, nWorkers);
+#endif
+
+    // the checkpoint of a shard whose worker failed cannot be trusted to be complete
+    auto report = mergePreparedShardCheckpoints(*verification, settings);
+    for (const auto shard: failedShards) {
+        if (std::find(report.incompleteShards.cbegin(), report.incompleteShards.cend(), shard) == report.incompleteShards.cend()) {
+            report.incompleteShards.emplace_back(shard);
+        }
+    }
+    std::sort(report.incompleteShards.begin(), report.incompleteShards.end());
+    return report;
+}
@@ -31,21 +31,24 @@ namespace {
     //Prefer the usage of std::chrono::steady_clock instead of std::chrono::system_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
     using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
 
-    bool areAllControlQubitsSetInState(const qc::Controls& controlQubits, const NBitValuesContainer& state) {
-        return controlQubits.empty() || std::all_of(controlQubits.cbegin(), controlQubits.cend(), [&state](const qc::Control& controlQubit) { return state.test(controlQubit.qubit).value_or(false); });
+    bool areAllControlQubitsSatisfiedInState(const qc::Controls& controlQubits, const NBitValuesContainer& state) {
+        return controlQubits.empty() || std::all_of(controlQubits.cbegin(), controlQubits.cend(), [&state](const qc::Control& controlQubit) {
+                   const auto value = state.test(controlQubit.qubit);
+                   return value.has_value() && *value == (controlQubit.type == qc::Control::Type::Pos);
+               });
     }
 } // namespace
 
 bool syrec::coreOperationSimulation(const qc::Operation& op, NBitValuesContainer& input) {
     const auto gateType = op.getType();
     if (gateType == qc::OpType::X) {
-        if (areAllControlQubitsSetInState(op.getControls(), input)) {
+        if (areAllControlQubitsSatisfiedInState(op.getControls(), input)) {
             input.flip(op.getTargets().front());
         }
         return true;
     }
     if (gateType == qc::OpType::SWAP) {
-        if (areAllControlQubitsSetInState(op.getControls(), input)) {
+        if (areAllControlQubitsSatisfiedInState(op.getControls(), input)) {
             const qc::Qubit targetQubitOne = op.getTargets()[0];
             const qc::Qubit targetQubitTwo = op.getTargets()[1];
 
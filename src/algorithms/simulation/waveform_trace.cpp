@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/waveform_trace.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    struct Signal {
+        std::string            name;
+        std::vector<qc::Qubit> qubits;
+        std::string            id;
+    };
+
+    // Identifier of the k-th signal of the dump consisting of the printable characters '!' to '~'
+    std::string vcdId(std::size_t k) {
+        std::string id;
+        do {
+            id += static_cast<char>('!' + (k % 94U));
+            k /= 94U;
+        } while (k != 0U);
+        return id;
+    }
+
+    // The signals of the registers ordered by the names of their variables, followed by a signal for every other qubit
+    std::vector<Signal> signalsOfQubits(const qc::QuantumComputation& quantumComputation) {
+        std::map<std::string, std::vector<qc::Qubit>> qubitsOfVariables;
+        std::vector<bool>                             labeled(quantumComputation.getNqubits(), false);
+        for (const auto& [label, quantumRegister]: quantumComputation.getQuantumRegisters()) {
+            auto& qubits = qubitsOfVariables[label.substr(0U, label.find_first_of(".["))];
+            for (std::size_t i = 0U; i < quantumRegister.getSize(); ++i) {
+                const auto qubit = static_cast<qc::Qubit>(quantumRegister.getStartIndex() + i);
+                qubits.emplace_back(qubit);
+                labeled[qubit] = true;
+            }
+        }
+
+        std::vector<Signal> signals;
+        for (auto& [name, qubits]: qubitsOfVariables) {
+            std::sort(qubits.begin(), qubits.end());
+            signals.emplace_back(Signal{name, std::move(qubits), vcdId(signals.size())});
+        }
+        for (std::size_t qubit = 0U; qubit < labeled.size(); ++qubit) {
+            if (!labeled[qubit]) {
+                signals.emplace_back(Signal{"q" + std::to_string(qubit), {static_cast<qc::Qubit>(qubit)}, vcdId(signals.size())});
+            }
+        }
+        return signals;
+    }
+
+    void writeValue(std::ostream& os, const Signal& signal, const std::vector<std::uint64_t>& state) {
+        const auto bit = [&state](const qc::Qubit qubit) { return ((state[qubit / 64U] >> (qubit % 64U)) & 1U) != 0U ? '1' : '0'; };
+        if (signal.qubits.size() == 1U) {
+            os << bit(signal.qubits.front()) << signal.id << "\n";
+            return;
+        }
+        os << 'b';
+        for (auto it = signal.qubits.crbegin(); it != signal.qubits.crend(); ++it) {
+            os << bit(*it);
+        }
+        os << ' ' << signal.id << "\n";
+    }
+
+    void writeInteger(std::ostream& os, const std::size_t value, const std::string& id) {
+        std::string bits;
+        for (auto remaining = value; remaining != 0U; remaining >>= 1U) {
+            bits += (remaining & 1U) != 0U ? '1' : '0';
+        }
+        std::reverse(bits.begin(), bits.end());
+        os << 'b' << (bits.empty() ? "0" : bits) << ' ' << id << "\n";
+    }
+} // namespace
+
+void WaveformTrace::begin(const std::vector<std::uint64_t>& initialState, const std::size_t nQubits) {
+    this->initialState = initialState;
+    this->nQubits      = nQubits;
+    nGates             = 0U;
+    nChanges           = 0U;
+    lastGate           = 0U;
+    buffer.clear();
+}
+
+void WaveformTrace::forEachChange(const std::function<void(std::size_t, qc::Qubit)>& onChange) const {
+    std::size_t position = 0U;
+    const auto  varint   = [&]() {
+        std::uint64_t value = 0U;
+        for (unsigned shift = 0U;; shift += 7U) {
+            const auto byte = buffer[position++];
+            value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+            if ((byte & 0x80U) == 0U) {
+                return value;
+            }
+        }
+    };
+
+    std::size_t gate = 0U;
+    while (position < buffer.size()) {
+        gate += varint();
+        onChange(gate, static_cast<qc::Qubit>(varint()));
+    }
+}
+
+std::vector<std::uint64_t> WaveformTrace::stateAfter(const std::size_t nGates) const {
+    auto state = initialState;
+    forEachChange([&](const std::size_t gate, const qc::Qubit qubit) {
+        if (gate < nGates) {
+            state[qubit / 64U] ^= 1ULL << (qubit % 64U);
+        }
+    });
+    return state;
+}
+
+void syrec::writeVcd(std::ostream& os, const WaveformTrace& trace, const qc::QuantumComputation& quantumComputation, const std::vector<std::size_t>& lineNumberOfGate, const VcdSettings& settings) {
+    if (trace.getNqubits() != quantumComputation.getNqubits() || trace.getNgates() != quantumComputation.getNops()) {
+        throw std::invalid_argument("The trace of " + std::to_string(trace.getNqubits()) + " qubits and " + std::to_string(trace.getNgates()) + " gates does not match the circuit of " + std::to_string(quantumComputation.getNqubits()) + " qubits and " + std::to_string(quantumComputation.getNops()) + " gates");
+    }
+    if (lineNumberOfGate.size() != trace.getNgates()) {
+        throw std::invalid_argument("Expected a line number for each of the " + std::to_string(trace.getNgates()) + " gates but got " + std::to_string(lineNumberOfGate.size()));
+    }
+
+    const auto               signals = signalsOfQubits(quantumComputation);
+    std::vector<std::size_t> signalOfQubit(trace.getNqubits(), 0U);
+    for (std::size_t i = 0U; i < signals.size(); ++i) {
+        for (const auto qubit: signals[i].qubits) {
+            signalOfQubit[qubit] = i;
+        }
+    }
+    const auto lineNumberId = vcdId(signals.size());
+
+    // the time step of a gate and the line number of the gates of a time step
+    std::vector<std::size_t> stepOfGate(trace.getNgates(), 0U);
+    std::vector<std::size_t> lineNumberOfStep;
+    for (std::size_t gate = 0U; gate < trace.getNgates(); ++gate) {
+        if (lineNumberOfStep.empty() || !settings.groupByStatement || lineNumberOfGate[gate] != lineNumberOfGate[gate - 1U]) {
+            lineNumberOfStep.emplace_back(lineNumberOfGate[gate]);
+        }
+        stepOfGate[gate] = lineNumberOfStep.size();
+    }
+
+    os << "$timescale " << settings.timescale << " $end\n";
+    os << "$scope module " << settings.scope << " $end\n";
+    for (const auto& signal: signals) {
+        os << "$var wire " << signal.qubits.size() << ' ' << signal.id << ' ' << signal.name << " $end\n";
+    }
+    os << "$var integer 32 " << lineNumberId << " lno $end\n";
+    os << "$upscope $end\n";
+    os << "$enddefinitions $end\n";
+
+    auto state = trace.getInitialState();
+    os << "#0\n$dumpvars\n";
+    for (const auto& signal: signals) {
+        writeValue(os, signal, state);
+    }
+    writeInteger(os, 0U, lineNumberId);
+    os << "$end\n";
+
+    std::vector<bool>        dirty(signals.size(), false);
+    std::vector<std::size_t> dirtySignals;
+    std::size_t              dumpedLineNumber = 0U;
+    std::size_t              step             = 0U;
+    // dump the time step if it changes a signal or the line number
+    const auto flush = [&]() {
+        const auto lineNumber = lineNumberOfStep[step - 1U];
+        if (dirtySignals.empty() && lineNumber == dumpedLineNumber) {
+            return;
+        }
+        os << '#' << step << "\n";
+        if (lineNumber != dumpedLineNumber) {
+            writeInteger(os, lineNumber, lineNumberId);
+            dumpedLineNumber = lineNumber;
+        }
+        std::sort(dirtySignals.begin(), dirtySignals.end());
+        for (const auto signal: dirtySignals) {
+            writeValue(os, signals[signal], state);
+            dirty[signal] = false;
+        }
+        dirtySignals.clear();
+    };
+    const auto advanceTo = [&](const std::size_t nextStep) {
+        for (; step < nextStep; ++step) {
+            if (step != 0U) {
+                flush();
+            }
+        }
+    };
+
+    trace.forEachChange([&](const std::size_t gate, const qc::Qubit qubit) {
+        advanceTo(stepOfGate[gate]);
+        state[qubit / 64U] ^= 1ULL << (qubit % 64U);
+        if (const auto signal = signalOfQubit[qubit]; !dirty[signal]) {
+            dirty[signal] = true;
+            dirtySignals.emplace_back(signal);
+        }
+    });
+    advanceTo(lineNumberOfStep.size());
+    if (step != 0U) {
+        flush();
+    }
+}
+
+void syrec::writeVcd(std::ostream& os, const WaveformTrace& trace, const AnnotatableQuantumComputation& annotatableQuantumComputation, const VcdSettings& settings) {
+    std::vector<std::size_t> lineNumberOfGate(annotatableQuantumComputation.getNops(), 0U);
+    for (std::size_t i = 0U; i < lineNumberOfGate.size(); ++i) {
+        const auto annotations = annotatableQuantumComputation.getAnnotationsOfQuantumOperation(i);
+        if (const auto it = annotations.find(settings.lineNumberAnnotationKey); it != annotations.cend()) {
+            lineNumberOfGate[i] = static_cast<std::size_t>(std::strtoull(it->second.c_str(), nullptr, 10));
+        }
+    }
+    writeVcd(os, trace, annotatableQuantumComputation, lineNumberOfGate, settings);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/dd_package_tuning.hpp"
+
+#include "core/properties.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Node.hpp"
+#include "dd/Package.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+using namespace syrec;
+
+namespace {
+    // the tables of the package mask their hashes, thus all sizes are powers of two
+    constexpr std::size_t MIN_BUCKETS         = 64U;
+    constexpr std::size_t MIN_COMPUTE_BUCKETS = 1024U;
+    constexpr std::size_t MAX_COMPUTE_BUCKETS = 1U << 20U;
+    constexpr std::size_t MAX_ALLOCATION_SIZE = 1U << 16U;
+
+    std::size_t powerOfTwoAtLeast(const std::size_t value, const std::size_t lowerBound, const std::size_t upperBound) {
+        std::size_t power = lowerBound;
+        while (power < value && power < upperBound) {
+            power <<= 1U;
+        }
+        return power;
+    }
+
+    std::size_t saturatedProduct(const std::size_t a, const std::size_t b) {
+        return (a != 0U && b > SIZE_MAX / a) ? SIZE_MAX : a * b;
+    }
+
+    double hitRatio(const std::size_t hits, const std::size_t lookups) {
+        return lookups == 0U ? 0. : static_cast<double>(hits) / static_cast<double>(lookups);
+    }
+} // namespace
+
+auto DDPackageTuning::fromProperties(const Properties::ptr& settings) -> DDPackageTuning {
+    DDPackageTuning tuning;
+    tuning.adaptiveSizing               = get<bool>(settings, "dd_adaptive_sizing", tuning.adaptiveSizing);
+    tuning.adaptiveGarbageCollection    = get<bool>(settings, "dd_adaptive_garbage_collection", tuning.adaptiveGarbageCollection);
+    tuning.minGarbageCollectionInterval = get<unsigned>(settings, "dd_min_garbage_collection_interval", static_cast<unsigned>(tuning.minGarbageCollectionInterval));
+    tuning.maxGarbageCollectionInterval = get<unsigned>(settings, "dd_max_garbage_collection_interval", static_cast<unsigned>(tuning.maxGarbageCollectionInterval));
+    tuning.minFreedShare                = get<double>(settings, "dd_min_freed_share", tuning.minFreedShare);
+
+    tuning.minGarbageCollectionInterval = std::max<std::size_t>(tuning.minGarbageCollectionInterval, 1U);
+    tuning.maxGarbageCollectionInterval = std::max(tuning.maxGarbageCollectionInterval, tuning.minGarbageCollectionInterval);
+    return tuning;
+}
+
+auto syrec::synthesisPackageConfig(const std::size_t nLines, const std::size_t sizeHint) -> dd::DDPackageConfig {
+    dd::DDPackageConfig config{};
+
+    // every cube adds at most one node per line to the DD, the gates applied to it keep it in the same order of magnitude
+    const auto nodes = saturatedProduct(std::max<std::size_t>(sizeHint, 1U), std::max<std::size_t>(nLines, 1U));
+
+    config.utMatInitialAllocationSize = powerOfTwoAtLeast(nodes, MIN_BUCKETS, MAX_ALLOCATION_SIZE);
+    config.ctMatMatMultNumBucket      = powerOfTwoAtLeast(nodes, MIN_COMPUTE_BUCKETS, MAX_COMPUTE_BUCKETS);
+    config.ctMatAddNumBucket          = powerOfTwoAtLeast(nodes, MIN_COMPUTE_BUCKETS, MAX_COMPUTE_BUCKETS);
+
+    // the synthesis only operates on matrix DDs
+    config.utVecNumBucket             = MIN_BUCKETS;
+    config.utVecInitialAllocationSize = MIN_BUCKETS;
+    config.ctVecAddNumBucket          = MIN_BUCKETS;
+    config.ctVecAddMagNumBucket       = MIN_BUCKETS;
+    config.ctVecConjNumBucket         = MIN_BUCKETS;
+    config.ctMatVecMultNumBucket      = MIN_BUCKETS;
+    config.ctVecKronNumBucket         = MIN_BUCKETS;
+    config.ctVecInnerProdNumBucket    = MIN_BUCKETS;
+    return config;
+}
+
+auto syrec::simulationPackageConfig(const std::size_t nQubits, const std::size_t nOperations) -> dd::DDPackageConfig {
+    dd::DDPackageConfig config{};
+
+    // a basis state and the DD of a gate have at most one node per qubit, thus the unique tables hold about one node per operation and qubit
+    const auto nodesPerQubit = std::max<std::size_t>(nOperations, 1U);
+    const auto nodes         = saturatedProduct(nodesPerQubit, std::max<std::size_t>(nQubits, 1U));
+
+    config.utVecNumBucket             = powerOfTwoAtLeast(nodesPerQubit, MIN_BUCKETS, config.utVecNumBucket);
+    config.utMatNumBucket             = powerOfTwoAtLeast(nodesPerQubit, MIN_BUCKETS, config.utMatNumBucket);
+    config.utVecInitialAllocationSize = powerOfTwoAtLeast(nodes, MIN_BUCKETS, MAX_ALLOCATION_SIZE);
+    config.utMatInitialAllocationSize = powerOfTwoAtLeast(nodes, MIN_BUCKETS, MAX_ALLOCATION_SIZE);
+    config.ctMatVecMultNumBucket      = powerOfTwoAtLeast(nodes, MIN_COMPUTE_BUCKETS, MAX_COMPUTE_BUCKETS);
+    config.ctVecAddNumBucket          = powerOfTwoAtLeast(nodes, MIN_COMPUTE_BUCKETS, MAX_COMPUTE_BUCKETS);
+
+    // gates are only ever applied to states
+    config.ctMatMatMultNumBucket   = MIN_COMPUTE_BUCKETS;
+    config.ctMatAddNumBucket       = MIN_COMPUTE_BUCKETS;
+    config.ctVecKronNumBucket      = MIN_BUCKETS;
+    config.ctMatKronNumBucket      = MIN_BUCKETS;
+    config.ctVecInnerProdNumBucket = MIN_BUCKETS;
+    return config;
+}
+
+auto DDPackageMonitor::afterOperation(dd::Package& dd) -> void {
+    ++operations;
+    // without adaptive garbage collection, the package is asked to collect its garbage after every operation
+    if (tuning.adaptiveGarbageCollection && ++operationsSinceCollection < interval) {
+        return;
+    }
+    operationsSinceCollection = 0U;
+
+    // the nodes are counted before every collection, since the collection might free most of them
+    const auto nodesBefore = static_cast<std::uint64_t>(dd.getUniqueTable<dd::mNode>().getNumEntries());
+    peakNodes              = std::max(peakNodes, nodesBefore);
+    // the package only collects once its tables have grown past their own limits
+    if (!dd.garbageCollect()) {
+        return;
+    }
+    ++garbageCollections;
+    if (!tuning.adaptiveGarbageCollection) {
+        return;
+    }
+
+    const auto nodesAfter = static_cast<std::uint64_t>(dd.getUniqueTable<dd::mNode>().getNumEntries());
+    const auto freedShare = nodesBefore == 0U ? 0. : static_cast<double>(nodesBefore - std::min(nodesAfter, nodesBefore)) / static_cast<double>(nodesBefore);
+    if (freedShare < tuning.minFreedShare) {
+        // most nodes are still alive, collecting again soon is wasted effort
+        interval = std::min(interval * 2U, tuning.maxGarbageCollectionInterval);
+    } else if (freedShare > 2. * tuning.minFreedShare) {
+        interval = std::max(interval / 2U, tuning.minGarbageCollectionInterval);
+    }
+}
+
+auto DDPackageMonitor::writeStatistics(dd::Package& dd, const Properties::ptr& statistics) const -> void {
+    if (statistics == nullptr) {
+        return;
+    }
+    const auto  nodes               = static_cast<std::uint64_t>(dd.getUniqueTable<dd::mNode>().getNumEntries());
+    const auto& multiplicationStats = dd.getMultiplicationComputeTable<dd::mNode>().getStats();
+    const auto& additionStats       = dd.getAddComputeTable<dd::mNode>().getStats();
+
+    statistics->set("dd_operations", operations);
+    statistics->set("dd_garbage_collections", garbageCollections);
+    statistics->set("dd_garbage_collection_interval", static_cast<std::uint64_t>(interval));
+    statistics->set("dd_nodes", nodes);
+    statistics->set("dd_peak_nodes", std::max(peakNodes, nodes));
+    statistics->set("dd_multiplication_lookups", static_cast<std::uint64_t>(multiplicationStats.lookups));
+    statistics->set("dd_multiplication_hit_ratio", hitRatio(multiplicationStats.hits, multiplicationStats.lookups));
+    statistics->set("dd_addition_hit_ratio", hitRatio(additionStats.hits, additionStats.lookups));
+}
@@ -11,28 +11,94 @@
 #include "algorithms/synthesis/dd_synthesis.hpp"
 
 #include "algorithms/optimization/esop_minimization.hpp"
+#include "algorithms/synthesis/dd_package_tuning.hpp"
 #include "algorithms/synthesis/encoding.hpp"
+#include "core/memory_report.hpp"
+#include "core/parallel_for.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/bdd_package.hpp"
+#include "core/truthTable/bdd_truth_table.hpp"
 #include "core/truthTable/truth_table.hpp"
 #include "dd/DDDefinitions.hpp"
+#include "dd/DDpackageConfig.hpp"
 #include "dd/Node.hpp"
 #include "dd/Operations.hpp"
 #include "dd/Package.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "ir/operations/StandardOperation.hpp"
 
 #include <algorithm>
 #include <array>
 #include <cassert>
 #include <chrono>
+#include <complex>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
 #include <memory>
 #include <queue>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <variant>
+#include <vector>
 
 using namespace qc::literals;
 
+namespace {
+    constexpr auto CHECKPOINT_HEADER  = "syrec-dd-synthesis-checkpoint";
+    constexpr auto CHECKPOINT_VERSION = 1U;
+
+    // floating-point values are stored by their bit pattern to restore them exactly
+    std::uint64_t toBits(const double value) {
+        std::uint64_t bits = 0U;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+
+    double fromBits(const std::uint64_t bits) {
+        double value = 0.;
+        std::memcpy(&value, &bits, sizeof(value));
+        return value;
+    }
+
+    template<class T>
+    T readCheckpointValue(std::istream& is, const std::string& what) {
+        T value{};
+        if (!(is >> value)) {
+            throw std::invalid_argument("Invalid checkpoint: cannot read " + what);
+        }
+        return value;
+    }
+
+    void expectCheckpointKeyword(std::istream& is, const std::string& keyword) {
+        if (readCheckpointValue<std::string>(is, "section " + keyword) != keyword) {
+            throw std::invalid_argument("Invalid checkpoint: expected section " + keyword);
+        }
+    }
+
+    // the number of cubes of a truth table (the number of BDD nodes for the BDD-based one) bounds the number of nodes per level of its DD
+    std::size_t packageSizeHintOf(const syrec::TruthTable& tt) {
+        return tt.size();
+    }
+
+    std::size_t packageSizeHintOf(const syrec::BddTruthTable& tt) {
+        return tt.getPackage()->size();
+    }
+} // namespace
+
 namespace syrec {
     auto buildDD(const TruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
         // truth table has to have the same number of inputs and outputs
@@ -90,6 +156,99 @@ namespace syrec {
         return dd->makeDDNode(label, edges);
     }
 
+    auto buildDD(BddTruthTable& tt, std::unique_ptr<dd::Package>& dd) -> dd::mEdge {
+        // truth table has to have the same number of inputs and outputs
+        assert(tt.nInputs() == tt.nOutputs());
+
+        const auto  nBits   = tt.nInputs();
+        const auto& package = tt.getPackage();
+
+        // the key consists of the remaining domain followed by the on-sets and the don't care sets of the remaining outputs (restricted to the remaining inputs).
+        // Since the BDDs are canonical, identical sub-tables are only built once.
+        using Key = std::vector<BddPackage::Node>;
+        std::map<Key, dd::mEdge> computed;
+
+        const std::function<dd::mEdge(std::size_t, const Key&)> build = [&](const std::size_t depth, const Key& key) -> dd::mEdge {
+            const auto domain = key.front();
+            if (depth == nBits || domain == BddPackage::ZERO) {
+                return domain == BddPackage::ZERO ? dd::mEdge::zero() : dd::mEdge::one();
+            }
+            if (const auto it = computed.find(key); it != computed.end()) {
+                return it->second;
+            }
+
+            const auto nRemaining = nBits - depth;
+            auto       edges      = std::array<dd::mEdge, 4U>{dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero(), dd::mEdge::zero()};
+            for (const auto in: {false, true}) {
+                const auto restrict = [&](const BddPackage::Node f) {
+                    if (package->variable(f) != depth) {
+                        return f;
+                    }
+                    return in ? package->high(f) : package->low(f);
+                };
+
+                const auto restrictedDomain = restrict(domain);
+                const auto on               = restrict(key[1U]);
+                const auto dc               = restrict(key[1U + nRemaining]);
+
+                // the remaining outputs are the same for both values of the current output
+                Key zeroKey{package->conjunction(restrictedDomain, package->negate(on))};
+                Key oneKey{package->conjunction(restrictedDomain, package->disjunction(on, dc))};
+                for (std::size_t i = 1U; i < nRemaining; ++i) {
+                    zeroKey.emplace_back(restrict(key[1U + i]));
+                }
+                for (std::size_t i = 1U; i < nRemaining; ++i) {
+                    zeroKey.emplace_back(restrict(key[1U + nRemaining + i]));
+                }
+                oneKey.insert(oneKey.end(), zeroKey.begin() + 1, zeroKey.end());
+
+                const auto offset     = in ? 1U : 0U;
+                edges.at(0U + offset) = build(depth + 1U, zeroKey);
+                edges.at(2U + offset) = build(depth + 1U, oneKey);
+            }
+
+            const auto label  = static_cast<dd::Qubit>(nRemaining - 1U);
+            const auto result = dd->makeDDNode(label, edges);
+            computed.emplace(key, result);
+            return result;
+        };
+
+        if (nBits == 0U) {
+            return dd::mEdge::zero();
+        }
+
+        Key root{tt.domain()};
+        for (std::size_t i = 0U; i < nBits; ++i) {
+            root.emplace_back(tt.onSet(i));
+        }
+        for (std::size_t i = 0U; i < nBits; ++i) {
+            root.emplace_back(tt.dontCareSet(i));
+        }
+        return build(0U, root);
+    }
+
+    auto memoryReportOfDD(const dd::mEdge& src) -> MemoryReport {
+        MemoryReport report;
+
+        std::unordered_set<const dd::mNode*> visited;
+        std::queue<const dd::mNode*>         queue;
+        if (!src.isTerminal()) {
+            queue.emplace(src.p);
+            visited.emplace(src.p);
+        }
+        while (!queue.empty()) {
+            const auto* node = queue.front();
+            queue.pop();
+            report.add("dd.nodes", sizeof(dd::mNode));
+            for (const auto& e: node->e) {
+                if (!e.isTerminal() && visited.emplace(e.p).second) {
+                    queue.emplace(e.p);
+                }
+            }
+        }
+        return report;
+    }
+
     // This algorithm provides all paths with their signatures from the `src` node to the `current` node.
     // Refer to the control path section of http://www.informatik.uni-bremen.de/agra/doc/konf/12aspdac_qmdd_synth_rev.pdf
     auto DDSynthesizer::pathFromSrcDst(dd::mEdge const& src, dd::mNode* const& dst, TruthTable::Cube::Set& sigVec) -> void {
@@ -154,7 +313,7 @@ namespace syrec {
         TruthTable::Cube::Set rootSigVec;
         pathFromSrcDst(src, current.p, rootSigVec);
 
-        const auto  tables = dd->getUniqueTable<dd::mNode>().getTables();
+        const auto& tables = dd->getUniqueTable<dd::mNode>().getTables();
         auto const& table  = tables[current.p->v];
 
         for (auto* p: table) {
@@ -293,7 +452,7 @@ namespace syrec {
         dd->incRef(tmp);
         dd->decRef(to);
         to = tmp;
-        dd->garbageCollect();
+        packageMonitor.afterOperation(*dd);
         ++numGates;
     }
 
@@ -494,6 +653,9 @@ namespace syrec {
     // Refer to the decoder algorithm of https://www.cda.cit.tum.de/files/eda/2018_aspdac_coding_techniques_in_synthesis.pdf.
     template<class T>
     auto DDSynthesizer::decoder(T const& codewords) -> void {
+        // from now on, a checkpoint already contains the gates of the decoder
+        pendingCodewords = std::monostate{};
+
         const auto codeLength = codewords.begin()->second.size();
 
         // decode the r most significant bits of the original output pattern.
@@ -564,6 +726,19 @@ namespace syrec {
             qc = std::make_shared<qc::QuantumComputation>(totalNoBits, totalNoBits);
         }
 
+        // queue for the nodes to be processed in a breadth-first manner.
+        std::queue<dd::mEdge> queue{};
+        queue.emplace(src);
+
+        // set of nodes that have already been processed.
+        std::unordered_set<dd::mEdge> visited{};
+
+        runtime = 0.;
+        processQueue(src, queue, visited, dd);
+        return qc;
+    }
+
+    auto DDSynthesizer::processQueue(dd::mEdge src, std::queue<dd::mEdge>& queue, std::unordered_set<dd::mEdge>& visited, std::unique_ptr<dd::Package>& dd) -> void {
         // The threshold after which the outputs are considered to be garbage.
         const auto garbageThreshold = static_cast<dd::Qubit>(totalNoBits - m);
 
@@ -571,21 +746,23 @@ namespace syrec {
         // Refer to algorithm Q of http://www.informatik.uni-bremen.de/agra/doc/konf/12aspdac_qmdd_synth_rev.pdf.
 
         // to preserve the `src` DD throughout the synthesis, its reference count has to be at least 2.
+        // The references added here are released again once the DD is synthesized, thus a package synthesizing several DDs does not keep the previous ones alive.
+        const auto entrySrc = src;
+        const auto entryRef = src.p->ref;
         while (src.p->ref < 2U) {
             dd->incRef(src);
         }
 
-        // queue for the nodes to be processed in a breadth-first manner.
-        std::queue<dd::mEdge> queue{};
-        queue.emplace(src);
-
-        // set of nodes that have already been processed.
-        std::unordered_set<dd::mEdge> visited{};
-
-        const auto start = std::chrono::steady_clock::now();
+        const auto  start              = std::chrono::steady_clock::now();
+        std::size_t processedSinceLast = 0U;
 
         // while there are nodes left to process.
         while (!queue.empty()) {
+            if (!checkpointSettings.filename.empty() && ++processedSinceLast > checkpointSettings.interval) {
+                writeCheckpoint(src, queue, visited, runtime + static_cast<double>((std::chrono::steady_clock::now() - start).count()));
+                processedSinceLast = 1U;
+            }
+
             const auto current = queue.front();
 
             // if the garbageFlag is true, the synthesis is terminated once the garbage threshold is reached.
@@ -611,16 +788,17 @@ namespace syrec {
 
             // decrement reference count of `src` node again and trigger garbage collection.
             dd->decRef(src);
-            dd->garbageCollect();
+            packageMonitor.afterOperation(*dd);
 
             if (pathsShifted) {
+                // if paths were shifted, synthesis starts again from the new `src` node.
+                src = srcShifted;
+
                 // stopping criterion
-                if (srcShifted.isIdentity() || dcNodeCondition(srcShifted)) {
+                if (src.isIdentity() || dcNodeCondition(src)) {
                     break;
                 }
 
-                // if paths were shifted, synthesis starts again from the new `src` node.
-                src = srcShifted;
                 visited.clear();
                 queue = {};
                 queue.emplace(src);
@@ -635,11 +813,22 @@ namespace syrec {
                 }
             }
         }
-        runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
-        return qc;
+
+        // the shifted DD holds the one reference the applied operations took from the entry DD, thus the latter is reset to its reference count on entry
+        if (src != entrySrc) {
+            dd->decRef(src);
+        }
+        while (entrySrc.p->ref > entryRef) {
+            dd->decRef(entrySrc);
+        }
+        while (entrySrc.p->ref < entryRef) {
+            dd->incRef(entrySrc);
+        }
+        runtime += static_cast<double>((std::chrono::steady_clock::now() - start).count());
     }
 
-    auto DDSynthesizer::initializeSynthesizer(TruthTable const& tt) -> void {
+    template<class T>
+    auto DDSynthesizer::initializeSynthesizer(T const& tt) -> void {
         n = tt.nInputs();
         m = tt.nOutputs();
 
@@ -652,7 +841,11 @@ namespace syrec {
 
         // construct ddSynth only if it is pointing to null
         if (ddSynth == nullptr) {
-            ddSynth = std::make_unique<dd::Package>(totalNoBits);
+            const auto& tuning = packageMonitor.getTuning();
+            ddSynth            = std::make_unique<dd::Package>(totalNoBits, tuning.adaptiveSizing ? synthesisPackageConfig(totalNoBits, std::max(packageSizeHintOf(tt), packageSizeHint)) : dd::DDPackageConfig{});
+        } else if (ddSynth->qubits() < totalNoBits) {
+            // a package reused for several truth tables is only ever enlarged
+            ddSynth->resize(totalNoBits);
         }
 
         // construct qc only if it is pointing to null
@@ -661,7 +854,8 @@ namespace syrec {
         }
     }
 
-    auto DDSynthesizer::buildAndSynthesize(TruthTable const& tt) -> void {
+    template<class T>
+    auto DDSynthesizer::buildAndSynthesize(T& tt) -> void {
         // the garbage and constants stored in the tt must be equal to the garbage and constants stored in qc.
         assert(tt.getGarbage() == qc->getGarbage() && tt.getConstants() == qc->getAncillary());
         const auto start = std::chrono::steady_clock::now();
@@ -672,7 +866,8 @@ namespace syrec {
         runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
     }
 
-    auto DDSynthesizer::synthesizeOnePassTT(TruthTable tt) -> std::shared_ptr<qc::QuantumComputation> {
+    template<class T>
+    auto DDSynthesizer::synthesizeOnePassTT(T tt) -> std::shared_ptr<qc::QuantumComputation> {
         reset();
         initializeSynthesizer(tt);
 
@@ -741,6 +936,15 @@ namespace syrec {
             qc->setLogicalQubitGarbage(i);
         }
 
+        // the decoder is synthesized from the codewords once the DD has been synthesized, thus they have to be part of the checkpoints
+        if (!checkpointSettings.filename.empty()) {
+            if (withAdditionalLine) {
+                pendingCodewords = codewordWithAdditionalLine;
+            } else {
+                pendingCodewords = codewordWithoutAdditionalLine;
+            }
+        }
+
         buildAndSynthesize(tt);
 
         const auto start = std::chrono::steady_clock::now();
@@ -752,6 +956,352 @@ namespace syrec {
         return qc;
     }
 
+    auto DDSynthesizer::writeStatistics(const Properties::ptr& statistics, const double runtimeInMilliseconds) -> void {
+        if (statistics == nullptr) {
+            return;
+        }
+        packageMonitor.writeStatistics(*ddSynth, statistics);
+        statistics->set("gates", static_cast<std::uint64_t>(numGates));
+        statistics->set("runtime", runtimeInMilliseconds);
+    }
+
+    auto DDSynthesizer::synthesizeOnePass(const TruthTable& tt, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation> {
+        const auto    start = std::chrono::steady_clock::now();
+        DDSynthesizer synthesizer{};
+        synthesizer.packageMonitor = DDPackageMonitor(DDPackageTuning::fromProperties(settings));
+        auto result                = synthesizer.synthesizeOnePassTT(tt);
+        synthesizer.writeStatistics(statistics, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return result;
+    }
+
+    auto DDSynthesizer::synthesizeCodingTechniques(const TruthTable& tt, const bool withAdditionalLine, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation> {
+        const auto    start = std::chrono::steady_clock::now();
+        DDSynthesizer synthesizer{};
+        synthesizer.packageMonitor = DDPackageMonitor(DDPackageTuning::fromProperties(settings));
+        auto result                = synthesizer.synthesizeCodingTechniquesTT(tt, withAdditionalLine);
+        synthesizer.writeStatistics(statistics, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return result;
+    }
+
+    auto DDSynthesizer::writeCheckpoint(const dd::mEdge& src, const std::queue<dd::mEdge>& queue, const std::unordered_set<dd::mEdge>& visited, const double elapsed) const -> bool {
+        std::vector<dd::mEdge> queued;
+        for (auto pending = queue; !pending.empty(); pending.pop()) {
+            queued.emplace_back(pending.front());
+        }
+
+        // the nodes are numbered such that the children of a node precede the node itself
+        std::unordered_map<const dd::mNode*, std::size_t> nodeIndex;
+        std::vector<const dd::mNode*>                     nodes;
+        const std::function<void(const dd::mEdge&)>       collect = [&](const dd::mEdge& e) {
+            if (e.isTerminal() || nodeIndex.find(e.p) != nodeIndex.end()) {
+                return;
+            }
+            for (const auto& child: e.p->e) {
+                collect(child);
+            }
+            nodeIndex.emplace(e.p, nodes.size());
+            nodes.emplace_back(e.p);
+        };
+        collect(src);
+        for (const auto& e: queued) {
+            collect(e);
+        }
+        for (const auto& e: visited) {
+            collect(e);
+        }
+
+        // an edge is stored as the index of its node (0 for the terminal, i + 1 for the i-th node) followed by its weight
+        const auto writeEdge = [&nodeIndex](std::ostream& os, const dd::mEdge& e) {
+            const auto weight = static_cast<std::complex<dd::fp>>(e.w);
+            os << ' ' << (e.isTerminal() ? 0U : nodeIndex.at(e.p) + 1U) << ' ' << toBits(weight.real()) << ' ' << toBits(weight.imag());
+        };
+
+        const auto    temporaryFilename = checkpointSettings.filename + ".tmp";
+        std::ofstream os(temporaryFilename, std::ios::trunc);
+        if (!os.good()) {
+            std::cerr << "Cannot write checkpoint " << temporaryFilename << '\n';
+            return false;
+        }
+
+        os << CHECKPOINT_HEADER << ' ' << CHECKPOINT_VERSION << '\n';
+        os << "counters " << n << ' ' << m << ' ' << totalNoBits << ' ' << r << ' ' << (garbageFlag ? 1U : 0U) << ' ' << numGates << ' ' << toBits(elapsed) << '\n';
+
+        const auto nQubits = qc->getNqubits();
+        os << "qubits " << nQubits << ' ';
+        for (std::size_t i = 0U; i < nQubits; ++i) {
+            os << (qc->getAncillary()[i] ? '1' : '0');
+        }
+        os << ' ';
+        for (std::size_t i = 0U; i < nQubits; ++i) {
+            os << (qc->getGarbage()[i] ? '1' : '0');
+        }
+        os << '\n';
+
+        os << "operations " << qc->getNops() << '\n';
+        for (const auto& op: *qc) {
+            os << qc::toString(op->getType()) << ' ' << op->getControls().size();
+            for (const auto& control: op->getControls()) {
+                os << ' ' << control.qubit << ' ' << (control.type == qc::Control::Type::Pos ? '+' : '-');
+            }
+            os << ' ' << op->getTargets().size();
+            for (const auto target: op->getTargets()) {
+                os << ' ' << target;
+            }
+            os << '\n';
+        }
+
+        const auto writeCodewords = [&os](const auto& codewords) {
+            using T = std::decay_t<decltype(codewords)>;
+            if constexpr (std::is_same_v<T, std::monostate>) {
+                os << "decoder none 0\n";
+            } else {
+                os << "decoder " << (std::is_same_v<T, TruthTable::CubeMap> ? "map" : "multimap") << ' ' << codewords.size() << '\n';
+                for (const auto& [pattern, code]: codewords) {
+                    os << pattern.toString() << ' ' << code.toString() << '\n';
+                }
+            }
+        };
+        std::visit(writeCodewords, pendingCodewords);
+
+        os << "nodes " << nodes.size() << '\n';
+        for (const auto* node: nodes) {
+            os << node->v;
+            for (const auto& child: node->e) {
+                writeEdge(os, child);
+            }
+            os << '\n';
+        }
+
+        os << "src";
+        writeEdge(os, src);
+        os << "\nqueue " << queued.size();
+        for (const auto& e: queued) {
+            writeEdge(os, e);
+        }
+        os << "\nvisited " << visited.size();
+        for (const auto& e: visited) {
+            writeEdge(os, e);
+        }
+        os << '\n';
+        os.close();
+
+        // replacing the checkpoint only once the new one is complete
+        std::error_code error;
+        std::filesystem::rename(temporaryFilename, checkpointSettings.filename, error);
+        if (os.fail() || error) {
+            std::cerr << "Cannot write checkpoint " << checkpointSettings.filename << '\n';
+            return false;
+        }
+        return true;
+    }
+
+    auto DDSynthesizer::resume(const DDCheckpointSettings& checkpoint, const Properties::ptr& settings, const Properties::ptr& statistics) -> std::shared_ptr<qc::QuantumComputation> {
+        const auto    start = std::chrono::steady_clock::now();
+        std::ifstream is(checkpoint.filename);
+        if (!is.good()) {
+            throw std::invalid_argument("Cannot open checkpoint " + checkpoint.filename);
+        }
+        if (readCheckpointValue<std::string>(is, "header") != CHECKPOINT_HEADER || readCheckpointValue<unsigned>(is, "version") != CHECKPOINT_VERSION) {
+            throw std::invalid_argument("Invalid checkpoint: unsupported format of " + checkpoint.filename);
+        }
+
+        DDSynthesizer synthesizer{};
+        synthesizer.checkpointSettings = checkpoint;
+        synthesizer.packageMonitor     = DDPackageMonitor(DDPackageTuning::fromProperties(settings));
+
+        expectCheckpointKeyword(is, "counters");
+        synthesizer.n           = readCheckpointValue<std::size_t>(is, "counters");
+        synthesizer.m           = readCheckpointValue<std::size_t>(is, "counters");
+        synthesizer.totalNoBits = readCheckpointValue<std::size_t>(is, "counters");
+        synthesizer.r           = readCheckpointValue<std::size_t>(is, "counters");
+        synthesizer.garbageFlag = readCheckpointValue<unsigned>(is, "counters") != 0U;
+        synthesizer.numGates    = readCheckpointValue<std::size_t>(is, "counters");
+        synthesizer.runtime     = fromBits(readCheckpointValue<std::uint64_t>(is, "counters"));
+        if (synthesizer.totalNoBits == 0U || synthesizer.m > synthesizer.totalNoBits) {
+            throw std::invalid_argument("Invalid checkpoint: inconsistent counters");
+        }
+
+        expectCheckpointKeyword(is, "qubits");
+        const auto nQubits   = readCheckpointValue<std::size_t>(is, "number of qubits");
+        const auto ancillary = readCheckpointValue<std::string>(is, "ancillary qubits");
+        const auto garbage   = readCheckpointValue<std::string>(is, "garbage qubits");
+        if (nQubits < synthesizer.totalNoBits || ancillary.size() != nQubits || garbage.size() != nQubits) {
+            throw std::invalid_argument("Invalid checkpoint: inconsistent qubits");
+        }
+        synthesizer.qc = std::make_shared<qc::QuantumComputation>(nQubits, nQubits);
+        for (std::size_t i = 0U; i < nQubits; ++i) {
+            if (ancillary[i] == '1') {
+                synthesizer.qc->setLogicalQubitAncillary(static_cast<qc::Qubit>(i));
+            }
+            if (garbage[i] == '1') {
+                synthesizer.qc->setLogicalQubitGarbage(static_cast<qc::Qubit>(i));
+            }
+        }
+
+        const auto readQubit = [&is, nQubits](const std::string& what) {
+            const auto qubit = readCheckpointValue<qc::Qubit>(is, what);
+            if (qubit >= nQubits) {
+                throw std::invalid_argument("Invalid checkpoint: " + what + " out of range");
+            }
+            return qubit;
+        };
+
+        expectCheckpointKeyword(is, "operations");
+        const auto nOperations = readCheckpointValue<std::size_t>(is, "number of operations");
+        for (std::size_t i = 0U; i < nOperations; ++i) {
+            const auto   type      = qc::opTypeFromString(readCheckpointValue<std::string>(is, "operation type"));
+            const auto   nControls = readCheckpointValue<std::size_t>(is, "number of controls");
+            qc::Controls controls;
+            for (std::size_t j = 0U; j < nControls; ++j) {
+                const auto qubit    = readQubit("control");
+                const auto polarity = readCheckpointValue<char>(is, "control polarity");
+                controls.emplace(qc::Control{qubit, polarity == '+' ? qc::Control::Type::Pos : qc::Control::Type::Neg});
+            }
+            const auto  nTargets = readCheckpointValue<std::size_t>(is, "number of targets");
+            qc::Targets targets;
+            for (std::size_t j = 0U; j < nTargets; ++j) {
+                targets.emplace_back(readQubit("target"));
+            }
+            synthesizer.qc->emplace_back<qc::StandardOperation>(controls, targets, type);
+        }
+
+        expectCheckpointKeyword(is, "decoder");
+        const auto decoderKind = readCheckpointValue<std::string>(is, "decoder");
+        const auto nCodewords  = readCheckpointValue<std::size_t>(is, "number of codewords");
+        const auto readCodewords = [&](auto codewords) {
+            for (std::size_t i = 0U; i < nCodewords; ++i) {
+                auto pattern = TruthTable::Cube::fromString(readCheckpointValue<std::string>(is, "codeword"));
+                auto code    = TruthTable::Cube::fromString(readCheckpointValue<std::string>(is, "codeword"));
+                codewords.emplace(std::move(pattern), std::move(code));
+            }
+            return codewords;
+        };
+        if (decoderKind == "map") {
+            synthesizer.pendingCodewords = readCodewords(TruthTable::CubeMap{});
+        } else if (decoderKind == "multimap") {
+            synthesizer.pendingCodewords = readCodewords(TruthTable::CubeMultiMap{});
+        } else if (decoderKind != "none" || nCodewords != 0U) {
+            throw std::invalid_argument("Invalid checkpoint: unknown decoder " + decoderKind);
+        }
+
+        expectCheckpointKeyword(is, "nodes");
+        const auto nNodes = readCheckpointValue<std::size_t>(is, "number of nodes");
+
+        // the DD is rebuilt bottom-up in a new package, which is sized and garbage collected like the one of an uninterrupted synthesis
+        const auto& tuning  = synthesizer.packageMonitor.getTuning();
+        synthesizer.ddSynth = std::make_unique<dd::Package>(synthesizer.totalNoBits, tuning.adaptiveSizing ? synthesisPackageConfig(synthesizer.totalNoBits, nNodes) : dd::DDPackageConfig{});
+        auto& dd            = synthesizer.ddSynth;
+
+        // the weight a rebuilt node is normalized with has to be applied to every edge pointing to it
+        std::vector<dd::mNode*>           nodes;
+        std::vector<std::complex<dd::fp>> nodeWeights;
+        const auto                        readEdge = [&]() {
+            const auto           index = readCheckpointValue<std::size_t>(is, "edge");
+            const auto           real  = fromBits(readCheckpointValue<std::uint64_t>(is, "edge weight"));
+            const auto           imag  = fromBits(readCheckpointValue<std::uint64_t>(is, "edge weight"));
+            std::complex<dd::fp> weight{real, imag};
+            if (index == 0U) {
+                return dd::mEdge::terminal(dd->cn.lookup(weight.real(), weight.imag()));
+            }
+            if (index > nodes.size()) {
+                throw std::invalid_argument("Invalid checkpoint: edge to an unknown node");
+            }
+            weight *= nodeWeights[index - 1U];
+            return dd::mEdge{nodes[index - 1U], dd->cn.lookup(weight.real(), weight.imag())};
+        };
+
+        for (std::size_t i = 0U; i < nNodes; ++i) {
+            const auto variable = readCheckpointValue<std::size_t>(is, "node");
+            if (variable >= synthesizer.totalNoBits) {
+                throw std::invalid_argument("Invalid checkpoint: node variable out of range");
+            }
+            std::array<dd::mEdge, 4U> edges{};
+            for (auto& e: edges) {
+                e = readEdge();
+            }
+            const auto node = dd->makeDDNode(static_cast<dd::Qubit>(variable), edges);
+            if (node.isTerminal()) {
+                throw std::invalid_argument("Invalid checkpoint: redundant node");
+            }
+            nodes.emplace_back(node.p);
+            nodeWeights.emplace_back(static_cast<std::complex<dd::fp>>(node.w));
+        }
+
+        expectCheckpointKeyword(is, "src");
+        const auto src = readEdge();
+        if (src.isTerminal()) {
+            throw std::invalid_argument("Invalid checkpoint: terminal DD");
+        }
+
+        expectCheckpointKeyword(is, "queue");
+        std::queue<dd::mEdge> queue{};
+        const auto            nQueued = readCheckpointValue<std::size_t>(is, "queue size");
+        for (std::size_t i = 0U; i < nQueued; ++i) {
+            queue.emplace(readEdge());
+        }
+
+        expectCheckpointKeyword(is, "visited");
+        std::unordered_set<dd::mEdge> visited{};
+        const auto                    nVisited = readCheckpointValue<std::size_t>(is, "number of visited nodes");
+        for (std::size_t i = 0U; i < nVisited; ++i) {
+            visited.emplace(readEdge());
+        }
+
+        synthesizer.processQueue(src, queue, visited, dd);
+
+        // synthesizing the decoder if the checkpoint was written during the synthesis of the encoded DD
+        const auto synthesizeDecoder = [&synthesizer](const auto& codewords) {
+            if constexpr (!std::is_same_v<std::decay_t<decltype(codewords)>, std::monostate>) {
+                synthesizer.decoder(codewords);
+            }
+        };
+        std::visit(synthesizeDecoder, std::exchange(synthesizer.pendingCodewords, std::monostate{}));
+        synthesizer.writeStatistics(statistics, std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        return synthesizer.qc;
+    }
+
+    auto DDSynthesizer::synthesizeBatch(const std::vector<TruthTable>& tts, const DDBatchSettings& settings) -> std::vector<DDBatchResult> {
+        std::vector<DDBatchResult> results(tts.size());
+
+        // the tables of every package are sized for the largest truth table of the batch
+        std::size_t maxSizeHint = 0U;
+        for (const auto& tt: tts) {
+            maxSizeHint = std::max(maxSizeHint, packageSizeHintOf(tt));
+        }
+
+        // every thread keeps its synthesizer and thus its package for all of its truth tables
+        const auto                                  nThreads = std::max<std::size_t>(settings.nThreads, 1U);
+        std::vector<std::unique_ptr<DDSynthesizer>> synthesizers(parallelForThreads(tts.size(), nThreads));
+        std::vector<std::size_t>                    tablesSinceCollection(synthesizers.size(), 0U);
+        parallelForPerThread(tts.size(), nThreads, [&](const std::size_t i, const std::size_t thread) {
+            if (!synthesizers[thread]) {
+                synthesizers[thread]                  = std::make_unique<DDSynthesizer>();
+                synthesizers[thread]->packageMonitor  = DDPackageMonitor(settings.tuning);
+                synthesizers[thread]->packageSizeHint = maxSizeHint;
+            }
+            auto&      synthesizer = *synthesizers[thread];
+            const auto start       = std::chrono::steady_clock::now();
+
+            // every truth table is synthesized into a new circuit while the package is kept
+            synthesizer.qc = nullptr;
+            results[i].qc  = settings.codingTechniques ? synthesizer.synthesizeCodingTechniquesTT(tts[i], settings.withAdditionalLine) : synthesizer.synthesizeOnePassTT(tts[i]);
+
+            results[i].runtime = static_cast<double>((std::chrono::steady_clock::now() - start).count());
+
+            // no DD is referenced in between two truth tables, thus everything not cached can be freed
+            if (settings.garbageCollectionInterval != 0U && ++tablesSinceCollection[thread] == settings.garbageCollectionInterval) {
+                synthesizer.ddSynth->garbageCollect(true);
+                tablesSinceCollection[thread] = 0U;
+            }
+            results[i].nodes = synthesizer.ddSynth->getUniqueTable<dd::mNode>().getNumEntries();
+        });
+        return results;
+    }
+
+    // explicitly instantiate the one-pass synthesis for both truth table representations.
+    template std::shared_ptr<qc::QuantumComputation> DDSynthesizer::synthesizeOnePassTT(TruthTable tt);
+    template std::shared_ptr<qc::QuantumComputation> DDSynthesizer::synthesizeOnePassTT(BddTruthTable tt);
+
     // explicitly instantiate the template function decoder.
     template void DDSynthesizer::decoder(TruthTable::CubeMap const& codewords);
 
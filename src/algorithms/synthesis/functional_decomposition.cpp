@@ -0,0 +1,787 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/functional_decomposition.hpp"
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/bdd_package.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    // the function and the specified outputs of a component are stored as dense truth vectors of 2^n bits per output and the composed circuit is simulated for
+    // all 2^n inputs of every component
+    constexpr std::size_t MAX_INPUTS = 20U;
+    // the sub-tables are synthesized from truth tables listing all 2^k assignments of their inputs
+    constexpr std::size_t MAX_SUB_TABLE_INPUTS = 16U;
+
+    // Truth vector of a function of k inputs, bit a is the value of the function for the assignment a (whose bit i is the value of the i-th input)
+    using TruthVector = std::vector<std::uint64_t>;
+
+    TruthVector zeroVector(const std::size_t k) {
+        return TruthVector(((1ULL << k) + 63U) / 64U, 0U);
+    }
+
+    bool valueOf(const TruthVector& function, const std::uint64_t assignment) {
+        return ((function[assignment / 64U] >> (assignment % 64U)) & 1U) != 0U;
+    }
+
+    void setValue(TruthVector& function, const std::uint64_t assignment) {
+        function[assignment / 64U] |= 1ULL << (assignment % 64U);
+    }
+
+    // mask of the valid assignments of the last word of a truth vector of k inputs
+    std::uint64_t validMask(const std::size_t k) {
+        return k >= 6U ? ~0ULL : (1ULL << (1ULL << k)) - 1U;
+    }
+
+    // index of the lowest set bit of a non-zero word
+    std::size_t lowestSetBit(const std::uint64_t word) {
+        std::size_t bit = 0U;
+        while (((word >> bit) & 1U) == 0U) {
+            ++bit;
+        }
+        return bit;
+    }
+
+    bool dependsOn(const TruthVector& function, const std::size_t k, const std::size_t input) {
+        if (input < 6U) {
+            // the assignments whose bit input is zero
+            constexpr std::array<std::uint64_t, 6> LOW{0x5555555555555555ULL, 0x3333333333333333ULL, 0x0F0F0F0F0F0F0F0FULL, 0x00FF00FF00FF00FFULL, 0x0000FFFF0000FFFFULL, 0x00000000FFFFFFFFULL};
+            const auto                             mask = LOW[input] & validMask(k);
+            return std::any_of(function.cbegin(), function.cend(), [&](const std::uint64_t word) { return (((word >> (1U << input)) ^ word) & mask) != 0U; });
+        }
+        const std::size_t stride = 1ULL << (input - 6U);
+        for (std::size_t w = 0U; w < function.size(); ++w) {
+            if ((w & stride) == 0U && function[w] != function[w + stride]) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // The index of the assignments of the inputs at the given positions, i.e. bit j of a is the value of the input at positions[j] in indices[a]
+    std::vector<std::uint64_t> scatteredAssignments(const std::vector<std::size_t>& positions) {
+        std::vector<std::uint64_t> indices(1ULL << positions.size(), 0U);
+        for (std::uint64_t a = 1U; a < indices.size(); ++a) {
+            // a differs from a with its lowest set bit cleared only in that bit
+            const auto lowest = lowestSetBit(a);
+            indices[a]        = indices[a & (a - 1U)] | (1ULL << positions[lowest]);
+        }
+        return indices;
+    }
+
+    TruthVector project(const TruthVector& function, const std::vector<std::size_t>& positions) {
+        const auto indices   = scatteredAssignments(positions);
+        auto       projected = zeroVector(positions.size());
+        for (std::uint64_t a = 0U; a < indices.size(); ++a) {
+            if (valueOf(function, indices[a])) {
+                setValue(projected, a);
+            }
+        }
+        return projected;
+    }
+
+    // A multi-output function whose inputs and outputs are signals, i.e. primary inputs, primary outputs or intermediate lines
+    struct Function {
+        std::vector<std::size_t> inputs;
+        std::vector<TruthVector> outputs;
+        std::vector<std::size_t> signals;
+    };
+
+    // restricts the function to the inputs in the mask and the given outputs
+    Function restrict(const Function& function, const std::uint64_t inputMask, const std::vector<std::size_t>& outputs) {
+        Function                 restricted;
+        std::vector<std::size_t> positions;
+        for (std::size_t i = 0U; i < function.inputs.size(); ++i) {
+            if (((inputMask >> i) & 1U) != 0U) {
+                positions.emplace_back(i);
+                restricted.inputs.emplace_back(function.inputs[i]);
+            }
+        }
+        for (const auto o: outputs) {
+            restricted.outputs.emplace_back(positions.size() == function.inputs.size() ? function.outputs[o] : project(function.outputs[o], positions));
+            restricted.signals.emplace_back(function.signals[o]);
+        }
+        return restricted;
+    }
+
+    struct SubTable {
+        std::size_t              nInputs = 0U;
+        std::vector<TruthVector> outputs;
+    };
+
+    struct Step {
+        enum class Kind { SubTable,
+                          Copy,
+                          Constant };
+        Kind                     kind     = Kind::SubTable;
+        std::size_t              subTable = 0U;
+        std::vector<std::size_t> inputs;
+        std::vector<std::size_t> outputs;
+        // whether a copy is negated or the value of a constant
+        bool value = false;
+    };
+
+    // Decomposes a function into the steps computing its outputs from its inputs in order
+    class Decomposer {
+    public:
+        Decomposer(const FunctionalDecompositionSettings& settings, const std::size_t nSignals):
+            settings(settings), nSignals(nSignals) {}
+
+        std::vector<Step>     steps;
+        std::vector<SubTable> subTables;
+        std::uint64_t         nComponents    = 0U;
+        std::uint64_t         nCurtis        = 0U;
+        std::uint64_t         nCopiedOutputs = 0U;
+
+        [[nodiscard]] std::size_t getNsignals() const {
+            return nSignals;
+        }
+
+        void decompose(const Function& function) {
+            const auto k = function.inputs.size();
+
+            // the copies of duplicated outputs are made once the output has been computed
+            std::vector<std::size_t>                      representatives;
+            std::vector<std::pair<std::size_t, std::size_t>> duplicates;
+            std::vector<std::uint64_t>                       supports;
+            for (std::size_t o = 0U; o < function.outputs.size(); ++o) {
+                const auto it = std::find_if(representatives.cbegin(), representatives.cend(), [&](const std::size_t r) { return function.outputs[r] == function.outputs[o]; });
+                if (it != representatives.cend()) {
+                    duplicates.emplace_back(function.signals[*it], function.signals[o]);
+                    continue;
+                }
+                std::uint64_t support = 0U;
+                for (std::size_t i = 0U; i < k; ++i) {
+                    if (dependsOn(function.outputs[o], k, i)) {
+                        support |= 1ULL << i;
+                    }
+                }
+                // constants and literals are copied onto new lines before the inputs are consumed
+                if (support == 0U) {
+                    steps.emplace_back(Step{Step::Kind::Constant, 0U, {}, {function.signals[o]}, valueOf(function.outputs[o], 0U)});
+                    ++nCopiedOutputs;
+                } else if ((support & (support - 1U)) == 0U) {
+                    const auto input = lowestSetBit(support);
+                    steps.emplace_back(Step{Step::Kind::Copy, 0U, {function.inputs[input]}, {function.signals[o]}, valueOf(function.outputs[o], 0U)});
+                    ++nCopiedOutputs;
+                } else {
+                    representatives.emplace_back(o);
+                    supports.emplace_back(support);
+                }
+            }
+
+            // the groups of outputs with disjoint support
+            std::vector<std::uint64_t>            componentSupports;
+            std::vector<std::vector<std::size_t>> componentOutputs;
+            for (std::size_t r = 0U; r < representatives.size(); ++r) {
+                auto                     support = supports[r];
+                std::vector<std::size_t> outputs{representatives[r]};
+                for (std::size_t c = 0U; c < componentSupports.size();) {
+                    if ((componentSupports[c] & support) != 0U) {
+                        support |= componentSupports[c];
+                        outputs.insert(outputs.end(), componentOutputs[c].cbegin(), componentOutputs[c].cend());
+                        componentSupports.erase(componentSupports.begin() + static_cast<std::ptrdiff_t>(c));
+                        componentOutputs.erase(componentOutputs.begin() + static_cast<std::ptrdiff_t>(c));
+                        // the merged support might intersect the support of a component checked before
+                        c = 0U;
+                    } else {
+                        ++c;
+                    }
+                }
+                std::sort(outputs.begin(), outputs.end());
+                componentSupports.emplace_back(support);
+                componentOutputs.emplace_back(std::move(outputs));
+            }
+            if (componentSupports.size() > 1U) {
+                ++nComponents;
+            }
+
+            for (std::size_t c = 0U; c < componentSupports.size(); ++c) {
+                auto component = restrict(function, componentSupports[c], componentOutputs[c]);
+                if (component.inputs.size() <= settings.maxLeafInputs || !decomposeCurtis(component)) {
+                    addSubTable(component);
+                }
+            }
+
+            for (const auto& [representative, duplicate]: duplicates) {
+                steps.emplace_back(Step{Step::Kind::Copy, 0U, {representative}, {duplicate}, false});
+                ++nCopiedOutputs;
+            }
+        }
+
+    private:
+        const FunctionalDecompositionSettings& settings;
+        std::size_t                            nSignals;
+        std::map<std::vector<std::uint64_t>, std::size_t> subTableOfKey;
+
+        // the distinct columns of the decomposition chart of the bound set, columnOf[a] is the column of the assignment a of the bound set
+        static std::vector<TruthVector> columnsOf(const Function& function, const std::vector<std::size_t>& boundSet, const std::vector<std::size_t>& freeSet, std::vector<std::size_t>& columnOf) {
+            const auto indicesOfBound = scatteredAssignments(boundSet);
+            const auto indicesOfFree  = scatteredAssignments(freeSet);
+            const auto nFree          = indicesOfFree.size();
+
+            std::map<TruthVector, std::size_t> columnOfKey;
+            std::vector<TruthVector>           columns;
+            columnOf.assign(indicesOfBound.size(), 0U);
+            for (std::uint64_t a = 0U; a < indicesOfBound.size(); ++a) {
+                TruthVector key((function.outputs.size() * nFree + 63U) / 64U, 0U);
+                for (std::size_t o = 0U; o < function.outputs.size(); ++o) {
+                    for (std::uint64_t b = 0U; b < nFree; ++b) {
+                        if (valueOf(function.outputs[o], indicesOfBound[a] | indicesOfFree[b])) {
+                            setValue(key, (o * nFree) + b);
+                        }
+                    }
+                }
+                const auto [it, inserted] = columnOfKey.try_emplace(key, columns.size());
+                if (inserted) {
+                    columns.emplace_back(std::move(key));
+                }
+                columnOf[a] = it->second;
+            }
+            return columns;
+        }
+
+        static std::size_t bitsFor(const std::size_t nValues) {
+            std::size_t bits = 0U;
+            while ((1ULL << bits) < nValues) {
+                ++bits;
+            }
+            return bits;
+        }
+
+        static std::vector<std::size_t> complementOf(const std::vector<std::size_t>& positions, const std::size_t k) {
+            std::vector<std::size_t> complement;
+            for (std::size_t i = 0U; i < k; ++i) {
+                if (std::find(positions.cbegin(), positions.cend(), i) == positions.cend()) {
+                    complement.emplace_back(i);
+                }
+            }
+            return complement;
+        }
+
+        // f(A, B) = F(g(A), B) for the bound set A saving the most inputs, returns whether such a bound set was found
+        bool decomposeCurtis(const Function& function) {
+            const auto k = function.inputs.size();
+            // every candidate evaluates all outputs for all assignments, thus the number of candidates of large functions is limited by maxBoundSetEvaluations
+            const auto               evaluationsPerCandidate = static_cast<std::uint64_t>(function.outputs.size()) << k;
+            const auto               maxCandidates           = std::min<std::uint64_t>(settings.maxBoundSetCandidates, std::max<std::uint64_t>(1U, settings.maxBoundSetEvaluations / evaluationsPerCandidate));
+            std::vector<std::size_t> bestBoundSet;
+            std::size_t              bestSaving  = 0U;
+            std::uint64_t            nCandidates = 0U;
+            std::vector<std::size_t> columnOf;
+            for (std::size_t size = 2U; size <= std::min(settings.maxBoundSetSize, k - 1U) && nCandidates < maxCandidates; ++size) {
+                // enumerate the bound sets of the size in lexicographic order
+                std::vector<std::size_t> boundSet(size);
+                for (std::size_t j = 0U; j < size; ++j) {
+                    boundSet[j] = j;
+                }
+                while (nCandidates++ < maxCandidates) {
+                    const auto nBits = bitsFor(columnsOf(function, boundSet, complementOf(boundSet, k), columnOf).size());
+                    if (nBits < size && size - nBits > bestSaving) {
+                        bestSaving   = size - nBits;
+                        bestBoundSet = boundSet;
+                    }
+
+                    auto j = size;
+                    while (j > 0U && boundSet[j - 1U] == k - size + j - 1U) {
+                        --j;
+                    }
+                    if (j == 0U) {
+                        break;
+                    }
+                    ++boundSet[j - 1U];
+                    for (auto l = j; l < size; ++l) {
+                        boundSet[l] = boundSet[l - 1U] + 1U;
+                    }
+                }
+            }
+            if (bestBoundSet.empty()) {
+                return false;
+            }
+            ++nCurtis;
+
+            const auto freeSet = complementOf(bestBoundSet, k);
+            const auto columns = columnsOf(function, bestBoundSet, freeSet, columnOf);
+            const auto nBits   = bitsFor(columns.size());
+            const auto nFree   = 1ULL << freeSet.size();
+
+            // g encodes the column of an assignment of the bound set on new lines
+            Function g;
+            for (const auto position: bestBoundSet) {
+                g.inputs.emplace_back(function.inputs[position]);
+            }
+            for (std::size_t j = 0U; j < nBits; ++j) {
+                auto output = zeroVector(bestBoundSet.size());
+                for (std::uint64_t a = 0U; a < columnOf.size(); ++a) {
+                    if (((columnOf[a] >> j) & 1U) != 0U) {
+                        setValue(output, a);
+                    }
+                }
+                g.outputs.emplace_back(std::move(output));
+                g.signals.emplace_back(nSignals++);
+            }
+
+            // F selects the column by the code computed by g (the bits 0, ..., nBits - 1 of its assignments), unused codes have the zero output
+            Function bigF;
+            bigF.inputs = g.signals;
+            for (const auto position: freeSet) {
+                bigF.inputs.emplace_back(function.inputs[position]);
+            }
+            bigF.signals = function.signals;
+            for (std::size_t o = 0U; o < function.outputs.size(); ++o) {
+                auto output = zeroVector(bigF.inputs.size());
+                for (std::size_t code = 0U; code < columns.size(); ++code) {
+                    for (std::uint64_t b = 0U; b < nFree; ++b) {
+                        if (valueOf(columns[code], (o * nFree) + b)) {
+                            setValue(output, code | (b << nBits));
+                        }
+                    }
+                }
+                bigF.outputs.emplace_back(std::move(output));
+            }
+
+            decompose(g);
+            decompose(bigF);
+            return true;
+        }
+
+        void addSubTable(const Function& function) {
+            std::vector<std::uint64_t> key{function.inputs.size(), function.outputs.size()};
+            for (const auto& output: function.outputs) {
+                key.insert(key.end(), output.cbegin(), output.cend());
+            }
+            const auto [it, inserted] = subTableOfKey.try_emplace(std::move(key), subTables.size());
+            if (inserted) {
+                subTables.emplace_back(SubTable{function.inputs.size(), function.outputs});
+            }
+            steps.emplace_back(Step{Step::Kind::SubTable, it->second, function.inputs, function.signals, false});
+        }
+    };
+
+    TruthTable truthTableOf(const SubTable& subTable) {
+        TruthTable tt;
+        for (std::uint64_t a = 0U; a < (1ULL << subTable.nInputs); ++a) {
+            TruthTable::Cube input;
+            input.reserve(subTable.nInputs);
+            for (std::size_t i = 0U; i < subTable.nInputs; ++i) {
+                input.emplace_back(((a >> i) & 1U) != 0U);
+            }
+            TruthTable::Cube output;
+            output.reserve(subTable.outputs.size());
+            for (const auto& function: subTable.outputs) {
+                output.emplace_back(valueOf(function, a));
+            }
+            tt.try_emplace(std::move(input), std::move(output));
+        }
+        return tt;
+    }
+
+    // Whether the gates compute the functions on the output qubits for all assignments of the input qubits (all other qubits being zero) where they are specified
+    bool realizes(const std::vector<BitParallelGate>& gates, const std::size_t nQubits, const std::vector<qc::Qubit>& inputQubits, const std::vector<qc::Qubit>& outputQubits, const std::vector<TruthVector>& values, const std::vector<TruthVector>& cares) {
+        const auto                 valid = validMask(inputQubits.size());
+        std::vector<std::uint64_t> state(nQubits);
+        for (std::uint64_t base = 0U; base < (1ULL << inputQubits.size()); base += 64U) {
+            std::fill(state.begin(), state.end(), 0U);
+            assignBitParallelBlock(state, inputQubits, base);
+            simulateBitParallel(gates, state);
+            for (std::size_t o = 0U; o < outputQubits.size(); ++o) {
+                const auto care = cares.empty() ? ~0ULL : cares[o][base / 64U];
+                if (((state[outputQubits[o]] ^ values[o][base / 64U]) & care & valid) != 0U) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    // A synthesized sub-table with the qubits of its inputs and outputs in the order of the sub-table
+    struct Layout {
+        std::vector<BitParallelGate> gates;
+        std::size_t                  nQubits = 0U;
+        std::vector<qc::Qubit>       inputQubits;
+        std::vector<qc::Qubit>       outputQubits;
+    };
+
+    // the inputs are the non-ancillary and the outputs the non-garbage qubits, their order is determined by simulation
+    std::optional<Layout> layoutOf(const qc::QuantumComputation& quantumComputation, const SubTable& subTable) {
+        auto gates = compileBitParallel(quantumComputation);
+        if (!gates.has_value()) {
+            return std::nullopt;
+        }
+
+        std::vector<qc::Qubit> inputQubits;
+        std::vector<qc::Qubit> outputQubits;
+        const auto&            ancillary = quantumComputation.getAncillary();
+        const auto&            garbage   = quantumComputation.getGarbage();
+        for (qc::Qubit qubit = 0U; qubit < quantumComputation.getNqubits(); ++qubit) {
+            if (!ancillary[qubit]) {
+                inputQubits.emplace_back(qubit);
+            }
+            if (!garbage[qubit]) {
+                outputQubits.emplace_back(qubit);
+            }
+        }
+        if (inputQubits.size() != subTable.nInputs || outputQubits.size() != subTable.outputs.size()) {
+            return std::nullopt;
+        }
+
+        for (const auto reversedInputs: {false, true}) {
+            for (const auto reversedOutputs: {false, true}) {
+                Layout layout{*gates, quantumComputation.getNqubits(), inputQubits, outputQubits};
+                if (reversedInputs) {
+                    std::reverse(layout.inputQubits.begin(), layout.inputQubits.end());
+                }
+                if (reversedOutputs) {
+                    std::reverse(layout.outputQubits.begin(), layout.outputQubits.end());
+                }
+                if (realizes(layout.gates, layout.nQubits, layout.inputQubits, layout.outputQubits, subTable.outputs, {})) {
+                    return layout;
+                }
+            }
+        }
+        return std::nullopt;
+    }
+
+    BitParallelGate notGate(const qc::Qubit target) {
+        BitParallelGate gate;
+        gate.target1 = target;
+        return gate;
+    }
+
+    // Outputs of the truth table which are expanded into truth vectors over the inputs of the component
+    struct Component {
+        std::vector<std::size_t> inputs;
+        std::vector<std::size_t> outputs;
+        std::vector<TruthVector> values;
+        // the specified outputs of every input, empty if all outputs are compared
+        std::vector<TruthVector> cares;
+    };
+
+    // the completely specified function (unspecified outputs are zero) and the specified outputs of every input, as a single component of all inputs and outputs
+    Component denseComponentOf(const TruthTable& tt) {
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
+
+        Component component;
+        component.inputs.resize(nInputs);
+        std::iota(component.inputs.begin(), component.inputs.end(), 0U);
+        component.outputs.resize(nOutputs);
+        std::iota(component.outputs.begin(), component.outputs.end(), 0U);
+        component.values.assign(nOutputs, zeroVector(nInputs));
+        component.cares.assign(nOutputs, zeroVector(nInputs));
+        for (const auto& [input, output]: tt) {
+            std::uint64_t base          = 0U;
+            std::uint64_t dontCareInput = 0U;
+            for (std::size_t i = 0U; i < nInputs; ++i) {
+                if (!input[i].has_value()) {
+                    dontCareInput |= 1ULL << i;
+                } else if (*input[i]) {
+                    base |= 1ULL << i;
+                }
+            }
+            // all subsets of the don't care inputs
+            for (std::uint64_t subset = 0U;; subset = (subset - dontCareInput) & dontCareInput) {
+                for (std::size_t o = 0U; o < nOutputs; ++o) {
+                    if (output[o].has_value()) {
+                        setValue(component.cares[o], base | subset);
+                        if (*output[o]) {
+                            setValue(component.values[o], base | subset);
+                        }
+                    }
+                }
+                if (subset == dontCareInput) {
+                    break;
+                }
+            }
+        }
+        return component;
+    }
+
+    // the inputs (BDD variables) f depends on in ascending order
+    std::vector<std::size_t> supportOf(const BddPackage& package, const BddPackage::Node f) {
+        std::vector<std::size_t>             support;
+        std::unordered_set<BddPackage::Node> visited;
+        std::vector<BddPackage::Node>        pending{f};
+        while (!pending.empty()) {
+            const auto node = pending.back();
+            pending.pop_back();
+            if (BddPackage::isTerminal(node) || !visited.emplace(node).second) {
+                continue;
+            }
+            support.emplace_back(package.variable(node));
+            pending.emplace_back(package.low(node));
+            pending.emplace_back(package.high(node));
+        }
+        std::sort(support.begin(), support.end());
+        support.erase(std::unique(support.begin(), support.end()), support.end());
+        return support;
+    }
+
+    // truth vector of f over the given inputs (in ascending order) which contain the support of f
+    TruthVector expand(const BddPackage& package, const BddPackage::Node f, const std::vector<std::size_t>& inputs) {
+        std::vector<std::size_t> positionOf(inputs.empty() ? 0U : inputs.back() + 1U, 0U);
+        for (std::size_t j = 0U; j < inputs.size(); ++j) {
+            positionOf[inputs[j]] = j;
+        }
+        auto function = zeroVector(inputs.size());
+        for (std::uint64_t a = 0U; a < (1ULL << inputs.size()); ++a) {
+            auto node = f;
+            while (!BddPackage::isTerminal(node)) {
+                node = ((a >> positionOf[package.variable(node)]) & 1U) != 0U ? package.high(node) : package.low(node);
+            }
+            if (node == BddPackage::ONE) {
+                setValue(function, a);
+            }
+        }
+        return function;
+    }
+
+    // The outputs grouped by their support on the BDDs of the completely specified function, thus only the components are expanded into truth vectors.
+    // The outputs of a component are compared for all inputs, as the decomposition realizes the completely specified function.
+    std::optional<std::vector<Component>> sparseComponentsOf(const TruthTable& tt) {
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
+
+        BddPackage                    package;
+        std::vector<BddPackage::Node> onSets(nOutputs, BddPackage::ZERO);
+        for (const auto& [input, output]: tt) {
+            const auto cube = package.fromCube(input);
+            for (std::size_t o = 0U; o < nOutputs; ++o) {
+                if (output[o].has_value() && *output[o]) {
+                    onSets[o] = package.disjunction(onSets[o], cube);
+                }
+            }
+        }
+
+        // the inputs of the outputs depending on a common input are merged (the constant outputs form a component without inputs)
+        std::vector<std::size_t> representativeOf(nInputs);
+        std::iota(representativeOf.begin(), representativeOf.end(), 0U);
+        const auto rootOf = [&representativeOf](std::size_t input) {
+            while (representativeOf[input] != input) {
+                representativeOf[input] = representativeOf[representativeOf[input]];
+                input                   = representativeOf[input];
+            }
+            return input;
+        };
+        std::vector<std::vector<std::size_t>> supports;
+        supports.reserve(nOutputs);
+        for (std::size_t o = 0U; o < nOutputs; ++o) {
+            supports.emplace_back(supportOf(package, onSets[o]));
+            for (const auto input: supports.back()) {
+                representativeOf[rootOf(input)] = rootOf(supports.back().front());
+            }
+        }
+
+        std::vector<Component>             components;
+        std::map<std::size_t, std::size_t> componentOf;
+        for (std::size_t o = 0U; o < nOutputs; ++o) {
+            const auto key            = supports[o].empty() ? nInputs : rootOf(supports[o].front());
+            const auto [it, inserted] = componentOf.try_emplace(key, components.size());
+            if (inserted) {
+                components.emplace_back();
+            }
+            components[it->second].outputs.emplace_back(o);
+        }
+        for (auto& component: components) {
+            for (const auto o: component.outputs) {
+                component.inputs.insert(component.inputs.end(), supports[o].cbegin(), supports[o].cend());
+            }
+            std::sort(component.inputs.begin(), component.inputs.end());
+            component.inputs.erase(std::unique(component.inputs.begin(), component.inputs.end()), component.inputs.end());
+            if (component.inputs.size() > MAX_INPUTS) {
+                std::cerr << "Outputs depending on more than " << MAX_INPUTS << " inputs cannot be decomposed\n";
+                return std::nullopt;
+            }
+            for (const auto o: component.outputs) {
+                component.values.emplace_back(expand(package, onSets[o], component.inputs));
+            }
+        }
+        return components;
+    }
+} // namespace
+
+std::optional<DecomposedCircuit> syrec::synthesizeDecomposed(const TruthTable& tt, const FunctionalDecompositionSettings& settings, const Properties::ptr& statistics) {
+    const auto start = std::chrono::steady_clock::now();
+
+    const auto nInputs  = tt.nInputs();
+    const auto nOutputs = tt.nOutputs();
+
+    // functions of few inputs are expanded directly, the others only once split into the outputs of disjoint support
+    std::vector<Component> components;
+    if (nInputs <= MAX_INPUTS) {
+        components.emplace_back(denseComponentOf(tt));
+    } else if (auto sparseComponents = sparseComponentsOf(tt); sparseComponents.has_value()) {
+        components = std::move(*sparseComponents);
+    } else {
+        return std::nullopt;
+    }
+
+    // the signals 0, ..., nInputs - 1 are the inputs and nInputs, ..., nInputs + nOutputs - 1 the outputs of the truth table
+    Decomposer decomposer(settings, nInputs + nOutputs);
+    if (components.size() > 1U) {
+        ++decomposer.nComponents;
+    }
+    for (const auto& component: components) {
+        Function function;
+        function.inputs  = component.inputs;
+        function.outputs = component.values;
+        for (const auto o: component.outputs) {
+            function.signals.emplace_back(nInputs + o);
+        }
+        decomposer.decompose(function);
+    }
+
+    std::size_t maxSubTableInputs = 0U;
+    for (const auto& subTable: decomposer.subTables) {
+        maxSubTableInputs = std::max(maxSubTableInputs, subTable.nInputs);
+    }
+    if (maxSubTableInputs > MAX_SUB_TABLE_INPUTS) {
+        std::cerr << "The function could not be decomposed into sub-tables with at most " << MAX_SUB_TABLE_INPUTS << " inputs\n";
+        return std::nullopt;
+    }
+
+    std::vector<TruthTable> subTables;
+    subTables.reserve(decomposer.subTables.size());
+    for (const auto& subTable: decomposer.subTables) {
+        subTables.emplace_back(truthTableOf(subTable));
+    }
+    DDBatchSettings batchSettings;
+    batchSettings.nThreads = settings.nThreads;
+    const auto synthesized = DDSynthesizer::synthesizeBatch(subTables, batchSettings);
+
+    std::vector<Layout> layouts;
+    for (std::size_t i = 0U; i < synthesized.size(); ++i) {
+        auto layout = synthesized[i].qc != nullptr ? layoutOf(*synthesized[i].qc, decomposer.subTables[i]) : std::nullopt;
+        if (!layout.has_value()) {
+            std::cerr << "Sub-table " << i << " with " << decomposer.subTables[i].nInputs << " inputs could not be synthesized\n";
+            return std::nullopt;
+        }
+        layouts.emplace_back(std::move(*layout));
+    }
+
+    // compose the steps, every signal is held by a qubit once it has been computed
+    std::vector<qc::Qubit>       qubitOfSignal(decomposer.getNsignals(), 0U);
+    std::vector<BitParallelGate> gates;
+    std::size_t                  nQubits = nInputs;
+    for (std::size_t i = 0U; i < nInputs; ++i) {
+        qubitOfSignal[i] = static_cast<qc::Qubit>(i);
+    }
+    for (const auto& step: decomposer.steps) {
+        if (step.kind == Step::Kind::Constant || step.kind == Step::Kind::Copy) {
+            const auto target = static_cast<qc::Qubit>(nQubits++);
+            if (step.kind == Step::Kind::Copy) {
+                auto copy = notGate(target);
+                copy.controls.emplace_back(qubitOfSignal[step.inputs.front()], true);
+                gates.emplace_back(std::move(copy));
+            }
+            if (step.value) {
+                gates.emplace_back(notGate(target));
+            }
+            qubitOfSignal[step.outputs.front()] = target;
+            continue;
+        }
+
+        const auto&            layout = layouts[step.subTable];
+        std::vector<qc::Qubit> qubitOf(layout.nQubits, 0U);
+        std::vector<bool>      mapped(layout.nQubits, false);
+        for (std::size_t j = 0U; j < step.inputs.size(); ++j) {
+            qubitOf[layout.inputQubits[j]] = qubitOfSignal[step.inputs[j]];
+            mapped[layout.inputQubits[j]]  = true;
+        }
+        for (std::size_t q = 0U; q < layout.nQubits; ++q) {
+            if (!mapped[q]) {
+                qubitOf[q] = static_cast<qc::Qubit>(nQubits++);
+            }
+        }
+        for (const auto& gate: layout.gates) {
+            auto composed    = gate;
+            composed.target1 = qubitOf[gate.target1];
+            composed.target2 = qubitOf[gate.target2];
+            for (auto& [qubit, positive]: composed.controls) {
+                qubit = qubitOf[qubit];
+            }
+            std::sort(composed.controls.begin(), composed.controls.end());
+            gates.emplace_back(std::move(composed));
+        }
+        for (std::size_t o = 0U; o < step.outputs.size(); ++o) {
+            qubitOfSignal[step.outputs[o]] = qubitOf[layout.outputQubits[o]];
+        }
+    }
+
+    DecomposedCircuit decomposed;
+    decomposed.qc = std::make_shared<qc::QuantumComputation>(nQubits);
+    replaceByBitParallelGates(*decomposed.qc, gates);
+    for (std::size_t i = 0U; i < nInputs; ++i) {
+        decomposed.inputQubits.emplace_back(static_cast<qc::Qubit>(i));
+    }
+    std::vector<bool> isOutput(nQubits, false);
+    for (std::size_t o = 0U; o < nOutputs; ++o) {
+        decomposed.outputQubits.emplace_back(qubitOfSignal[nInputs + o]);
+        isOutput[decomposed.outputQubits.back()] = true;
+    }
+    for (std::size_t q = 0U; q < nQubits; ++q) {
+        if (q >= nInputs) {
+            decomposed.qc->setLogicalQubitAncillary(static_cast<qc::Qubit>(q));
+        }
+        if (!isOutput[q]) {
+            decomposed.qc->setLogicalQubitGarbage(static_cast<qc::Qubit>(q));
+        }
+    }
+
+    if (settings.verify) {
+        // the outputs of a component do not depend on the other inputs, which are thus kept zero
+        for (const auto& component: components) {
+            std::vector<qc::Qubit> inputQubits;
+            std::vector<qc::Qubit> outputQubits;
+            for (const auto i: component.inputs) {
+                inputQubits.emplace_back(decomposed.inputQubits[i]);
+            }
+            for (const auto o: component.outputs) {
+                outputQubits.emplace_back(decomposed.outputQubits[o]);
+            }
+            if (!realizes(gates, nQubits, inputQubits, outputQubits, component.values, component.cares)) {
+                std::cerr << "The composed circuit does not realize the truth table\n";
+                return std::nullopt;
+            }
+        }
+    }
+
+    if (statistics) {
+        statistics->set("components", decomposer.nComponents);
+        statistics->set("curtis_decompositions", decomposer.nCurtis);
+        statistics->set("copied_outputs", decomposer.nCopiedOutputs);
+        statistics->set("sub_tables", static_cast<std::uint64_t>(subTables.size()));
+        statistics->set("max_sub_table_inputs", static_cast<std::uint64_t>(maxSubTableInputs));
+        statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+    return decomposed;
+}
@@ -31,6 +31,10 @@ namespace syrec {
         }
 
         const AssignStatement& assignmentStmt = *stmtCastedAsAssignmentStmt;
+        if (isDynamicallyIndexed(assignmentStmt.lhs)) {
+            return SyrecSynthesis::onStatement(statement);
+        }
+
         std::vector<qc::Qubit> d;
         std::vector<qc::Qubit> dd;
         std::vector<qc::Qubit> ddd;
@@ -215,6 +219,10 @@ namespace syrec {
     }
 
     bool LineAwareSynthesis::opRhsLhsExpression(const VariableExpression& expression, std::vector<qc::Qubit>& v) {
+        // The lines of a dynamically indexed variable access are only determined during its synthesis
+        if (isDynamicallyIndexed(expression.var)) {
+            return false;
+        }
         getVariables(expression.var, v);
         return true;
     }
@@ -11,6 +11,7 @@
 #include "algorithms/synthesis/syrec_synthesis.hpp"
 
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/memory_report.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/program.hpp"
@@ -18,11 +19,13 @@
 #include "core/syrec/variable.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
 
 #include <algorithm>
 #include <cassert>
 #include <chrono>
 #include <cstddef>
+#include <functional>
 #include <iostream>
 #include <optional>
 #include <stack>
@@ -35,6 +38,140 @@ namespace {
      * Prefer the usage of std::chrono::steady_clock instead of std::chrono::system_clock since the former cannot decrease (due to time zone changes, etc.) and is most suitable for measuring intervals according to (https://en.cppreference.com/w/cpp/chrono/steady_clock)
      */
     using TimeStamp = std::chrono::time_point<std::chrono::steady_clock>;
+
+    std::optional<syrec::SyrecSynthesis::ComparatorImplementation> parseComparatorImplementation(const std::string& identifier) {
+        if (identifier == "subtract_and_restore") {
+            return syrec::SyrecSynthesis::ComparatorImplementation::SubtractAndRestore;
+        }
+        if (identifier == "carry_chain") {
+            return syrec::SyrecSynthesis::ComparatorImplementation::CarryChain;
+        }
+        if (identifier == "log_depth_tree") {
+            return syrec::SyrecSynthesis::ComparatorImplementation::LogDepthTree;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<syrec::SyrecSynthesis::IncrementerImplementation> parseIncrementerImplementation(const std::string& identifier) {
+        if (identifier == "cascade") {
+            return syrec::SyrecSynthesis::IncrementerImplementation::Cascade;
+        }
+        if (identifier == "carry_chain") {
+            return syrec::SyrecSynthesis::IncrementerImplementation::CarryChain;
+        }
+        if (identifier == "borrowed_qubits") {
+            return syrec::SyrecSynthesis::IncrementerImplementation::BorrowedQubits;
+        }
+        if (identifier == "cost_based") {
+            return syrec::SyrecSynthesis::IncrementerImplementation::CostBased;
+        }
+        return std::nullopt;
+    }
+
+    // A self-inverse gate (NOT, CNOT, Toffoli or MCT depending on the number of controls) recorded to be able to uncompute it later on
+    struct SelfInverseGate {
+        std::vector<qc::Qubit> controls;
+        qc::Qubit              target;
+    };
+
+    bool addSelfInverseGate(syrec::AnnotatableQuantumComputation& annotatableQuantumComputation, const SelfInverseGate& gate) {
+        switch (gate.controls.size()) {
+            case 0:
+                return annotatableQuantumComputation.addOperationsImplementingNotGate(gate.target);
+            case 1:
+                return annotatableQuantumComputation.addOperationsImplementingCnotGate(gate.controls.front(), gate.target);
+            case 2:
+                return annotatableQuantumComputation.addOperationsImplementingToffoliGate(gate.controls.front(), gate.controls.back(), gate.target);
+            default:
+                return annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls(gate.controls.cbegin(), gate.controls.cend()), gate.target);
+        }
+    }
+
+    // Adds the gates in the given order or in the reverse order, the latter implementing the inverse of the sequence
+    bool addSelfInverseGates(syrec::AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<SelfInverseGate>& gates, const bool inverse) {
+        bool synthesisOk = true;
+        for (std::size_t i = 0; i < gates.size() && synthesisOk; ++i) {
+            synthesisOk = addSelfInverseGate(annotatableQuantumComputation, gates[inverse ? gates.size() - 1 - i : i]);
+        }
+        return synthesisOk;
+    }
+
+    // Quantum cost of the gates (\see AnnotatableQuantumComputation#getQuantumCostForSynthesis) if they are added to the quantum computation while the given number of control qubits is propagated
+    syrec::AnnotatableQuantumComputation::SynthesisCostMetricValue quantumCostOfSelfInverseGates(const std::vector<SelfInverseGate>& gates, const std::size_t numPropagatedControlQubits, const std::size_t numQubits) {
+        syrec::AnnotatableQuantumComputation::SynthesisCostMetricValue cost = 0;
+        for (const auto& gate: gates) {
+            cost += syrec::AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(gate.controls.size() + numPropagatedControlQubits, qc::OpType::X, numQubits);
+        }
+        return cost;
+    }
+
+    // Appends the ripple-carry adder of Takahashi et al. computing b += a (modulo 2^n) in-place without any ancillary qubit, a is restored
+    void appendInPlaceAddition(std::vector<SelfInverseGate>& gates, const std::vector<qc::Qubit>& a, const std::vector<qc::Qubit>& b) {
+        const std::size_t n = a.size();
+        for (std::size_t i = 1; i < n; ++i) {
+            gates.push_back({{a[i]}, b[i]});
+        }
+        for (std::size_t i = n - 1; i > 1; --i) {
+            gates.push_back({{a[i - 1]}, a[i]});
+        }
+        for (std::size_t i = 0; i + 1 < n; ++i) {
+            gates.push_back({{b[i], a[i]}, a[i + 1]});
+        }
+        for (std::size_t i = n - 1; i > 0; --i) {
+            gates.push_back({{a[i]}, b[i]});
+            gates.push_back({{b[i - 1], a[i - 1]}, a[i]});
+        }
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            gates.push_back({{a[i]}, a[i + 1]});
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            gates.push_back({{a[i]}, b[i]});
+        }
+    }
+
+    // dest[i] is flipped controlled by all less significant bits, starting with the most significant one
+    std::vector<SelfInverseGate> cascadeIncrementerGates(const std::vector<qc::Qubit>& dest) {
+        std::vector<SelfInverseGate> gates;
+        for (std::size_t i = dest.size(); i > 0; --i) {
+            gates.push_back({std::vector<qc::Qubit>(dest.cbegin(), dest.cbegin() + static_cast<std::ptrdiff_t>(i - 1)), dest[i - 1]});
+        }
+        return gates;
+    }
+
+    // ancillaryQubits[i] (initially zero) stores the conjunction of dest[0], ..., dest[i + 1], every bit is flipped controlled by the conjunction of the less significant bits before the latter is uncomputed
+    std::vector<SelfInverseGate> carryChainIncrementerGates(const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& ancillaryQubits) {
+        const std::size_t            n           = dest.size();
+        const auto                   conjunction = [&](const std::size_t i) { return i == 0 ? dest.front() : ancillaryQubits[i - 1]; };
+        std::vector<SelfInverseGate> gates;
+        for (std::size_t i = 1; i + 1 < n; ++i) {
+            gates.push_back({{conjunction(i - 1), dest[i]}, ancillaryQubits[i - 1]});
+        }
+        for (std::size_t i = n - 1; i > 0; --i) {
+            gates.push_back({{conjunction(i - 1)}, dest[i]});
+            if (i > 1) {
+                gates.push_back({{conjunction(i - 2), dest[i - 1]}, ancillaryQubits[i - 2]});
+            }
+        }
+        gates.push_back({{}, dest.front()});
+        return gates;
+    }
+
+    // dest + 1 = ~(~dest + g + ~g) holds for any value g of the borrowed qubits, which are restored by the second negation
+    std::vector<SelfInverseGate> borrowedQubitsIncrementerGates(const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& borrowedQubits) {
+        std::vector<SelfInverseGate> gates;
+        const auto                   negate = [&](const std::vector<qc::Qubit>& qubits) {
+            for (const auto qubit: qubits) {
+                gates.push_back({{}, qubit});
+            }
+        };
+        negate(dest);
+        appendInPlaceAddition(gates, borrowedQubits, dest);
+        negate(borrowedQubits);
+        appendInPlaceAddition(gates, borrowedQubits, dest);
+        negate(dest);
+        negate(borrowedQubits);
+        return gates;
+    }
 } // namespace
 
 namespace syrec {
@@ -50,20 +187,42 @@ namespace syrec {
         modules.push(mainModule);
     }
 
-    bool SyrecSynthesis::addVariables(const Variable::vec& variables) {
+    bool SyrecSynthesis::addVariables(const Variable::vec& variables, const std::string& labelPrefix) {
         bool couldQubitsForVariablesBeAdded = true;
         for (std::size_t i = 0; i < variables.size() && couldQubitsForVariablesBeAdded; ++i) {
             const auto& variable = variables[i];
-            // entry in var lines map
-            varLines.try_emplace(variable, annotatableQuantumComputation.getNqubits());
-            couldQubitsForVariablesBeAdded &= addVariable(annotatableQuantumComputation, variable->dimensions, variable, std::string());
+            // entry in var lines map, the variables of a called module are mapped to the lines of its latest instance
+            varLines.insert_or_assign(variable, annotatableQuantumComputation.getNqubits());
+            couldQubitsForVariablesBeAdded &= addVariable(annotatableQuantumComputation, variable->dimensions, variable, std::string(), labelPrefix);
         }
         return couldQubitsForVariablesBeAdded;
     }
 
+    std::string SyrecSynthesis::nextInstanceLabelPrefix(const Module& module) {
+        return module.name + "#" + std::to_string(nInstancesOfModule[module.name]++) + "/";
+    }
+
     bool SyrecSynthesis::synthesize(SyrecSynthesis* synthesizer, const Program& program, const Properties::ptr& settings, const Properties::ptr& statistics) {
         // Settings parsing
-        auto mainModule = get<std::string>(settings, "main_module", std::string());
+        auto       mainModule                        = get<std::string>(settings, "main_module", program.mainModule());
+        const auto comparatorImplementationIdentifier = get<std::string>(settings, "comparator_implementation", std::string("subtract_and_restore"));
+        const auto comparatorImplementation           = parseComparatorImplementation(comparatorImplementationIdentifier);
+        if (!comparatorImplementation.has_value()) {
+            std::cerr << "Unknown comparator implementation: " << comparatorImplementationIdentifier << "\n";
+            return false;
+        }
+        const auto incrementerImplementationIdentifier = get<std::string>(settings, "incrementer_implementation", std::string("cost_based"));
+        const auto incrementerImplementation           = parseIncrementerImplementation(incrementerImplementationIdentifier);
+        if (!incrementerImplementation.has_value()) {
+            std::cerr << "Unknown incrementer implementation: " << incrementerImplementationIdentifier << "\n";
+            return false;
+        }
+        synthesizer->comparatorImplementation      = *comparatorImplementation;
+        synthesizer->incrementerImplementation     = *incrementerImplementation;
+        synthesizer->useMctForEqualityWithConstant = get<bool>(settings, "equality_with_constant_using_mct", false);
+        const auto withMemoryReport                = get<bool>(settings, "memory_report", false) && statistics != nullptr;
+        const auto memorySamplingInterval          = get<unsigned>(settings, "memory_report_sampling_interval", 1024U);
+
         // Run-time measuring
         const TimeStamp simulationStartTime = std::chrono::steady_clock::now();
 
@@ -96,8 +255,30 @@ namespace syrec {
             return false;
         }
 
+        // The IR is not modified during the synthesis, but the bookkeeping of the synthesis (e.g. the values of the loop variables) and of the quantum computation
+        // (e.g. the scopes of the control qubit propagation) shrinks again after a statement, thus the memory is additionally sampled during the synthesis of the statements.
+        // The samples only walk the quantum operations added since the previous sample.
+        MemoryReport                                 memoryReport;
+        AnnotatableQuantumComputation::MemorySampler memorySampler;
+        std::size_t                                  irBytes             = 0U;
+        const auto                                   recordMemoryOfPhase = [&](const std::string& phase) {
+            if (withMemoryReport) {
+                memoryReport.recordPhase(phase, irBytes + synthesizer->memoryReport().totalBytes() + synthesizer->annotatableQuantumComputation.sampleMemoryBytes(memorySampler));
+            }
+        };
+        if (withMemoryReport) {
+            irBytes = program.memoryReport().totalBytes();
+        }
+        recordMemoryOfPhase("variables");
+        if (withMemoryReport && memorySamplingInterval > 0U) {
+            synthesizer->memorySamplingInterval        = memorySamplingInterval;
+            synthesizer->nOperationsAtLastMemorySample = synthesizer->annotatableQuantumComputation.getNops();
+            synthesizer->sampleMemory                  = [&recordMemoryOfPhase] { recordMemoryOfPhase("statements"); };
+        }
+
         // synthesize the statements
         const auto synthesisOfMainModuleOk = synthesizer->onModule(main);
+        synthesizer->sampleMemory          = nullptr;
         for (const auto& ancillaryQubit: synthesizer->annotatableQuantumComputation.getAddedPreliminaryAncillaryQubitIndices()) {
             if (!synthesizer->annotatableQuantumComputation.promotePreliminaryAncillaryQubitToDefinitiveAncillary(ancillaryQubit)) {
                 std::cerr << "Failed to mark qubit" << std::to_string(ancillaryQubit) << " as ancillary qubit";
@@ -105,14 +286,38 @@ namespace syrec {
             }
         }
 
+        recordMemoryOfPhase("statements");
+
         if (statistics != nullptr) {
             const TimeStamp simulationEndTime = std::chrono::steady_clock::now();
             const auto      simulationRunTime = std::chrono::duration_cast<std::chrono::milliseconds>(simulationEndTime - simulationStartTime);
             statistics->set("runtime", static_cast<double>(simulationRunTime.count()));
+            if (withMemoryReport) {
+                memoryReport.merge(program.memoryReport());
+                memoryReport.merge(synthesizer->memoryReport());
+                memoryReport.merge(synthesizer->annotatableQuantumComputation.memoryReport());
+                statistics->set("memory_report", memoryReport);
+            }
         }
         return synthesisOfMainModuleOk;
     }
 
+    MemoryReport SyrecSynthesis::memoryReport() const {
+        MemoryReport report;
+        report.add("synthesis.variable_lines", varLines.size() * (sizeof(VarLinesMap::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD), varLines.size());
+        for (const auto& [loopVariable, _]: loopMap) {
+            report.add("synthesis.loop_variables", sizeof(Number::loop_variable_mapping::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD + MemoryReport::dynamicBytes(loopVariable));
+        }
+        for (const auto& [_, freeConstLines]: freeConstLinesMap) {
+            report.add("synthesis.constant_lines", sizeof(decltype(freeConstLinesMap)::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD + freeConstLines.capacity() * sizeof(qc::Qubit), freeConstLines.size());
+        }
+        for (const auto& [moduleName, _]: nInstancesOfModule) {
+            report.add("synthesis.module_instances", sizeof(decltype(nInstancesOfModule)::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD + MemoryReport::dynamicBytes(moduleName));
+        }
+        report.add("synthesis.statements", stmts.size() * sizeof(Statement::ptr) + modules.size() * sizeof(Module::ptr), stmts.size() + modules.size());
+        return report;
+    }
+
     bool SyrecSynthesis::onModule(const Module::ptr& main) {
         bool              synthesisOfModuleStatementOk = true;
         const std::size_t nModuleStatements            = main->statements.size();
@@ -183,43 +388,73 @@ namespace syrec {
             okay = false;
         }
 
+        // sampled before the statement is popped to include the bookkeeping of the enclosing statements
+        if (sampleMemory && annotatableQuantumComputation.getNops() - nOperationsAtLastMemorySample >= memorySamplingInterval) {
+            nOperationsAtLastMemorySample = annotatableQuantumComputation.getNops();
+            sampleMemory();
+        }
+
         stmts.pop();
         return okay;
     }
 
     bool SyrecSynthesis::onStatement(const SwapStatement& statement) {
-        std::vector<qc::Qubit> lhs;
-        std::vector<qc::Qubit> rhs;
+        const auto swapWithRhs = [&](const std::vector<qc::Qubit>& lhs) {
+            if (isDynamicallyIndexed(statement.rhs)) {
+                return onDynamicallyIndexedVariableUpdate(statement.rhs, [&](const std::vector<qc::Qubit>& rhs) { return swap(annotatableQuantumComputation, lhs, rhs); });
+            }
+            std::vector<qc::Qubit> rhs;
+            getVariables(statement.rhs, rhs);
+            assert(lhs.size() == rhs.size());
+            return swap(annotatableQuantumComputation, lhs, rhs);
+        };
 
+        if (isDynamicallyIndexed(statement.lhs)) {
+            return onDynamicallyIndexedVariableUpdate(statement.lhs, swapWithRhs);
+        }
+        std::vector<qc::Qubit> lhs;
         getVariables(statement.lhs, lhs);
-        getVariables(statement.rhs, rhs);
-        assert(lhs.size() == rhs.size());
-        return swap(annotatableQuantumComputation, lhs, rhs);
+        return swapWithRhs(lhs);
     }
 
     bool SyrecSynthesis::onStatement(const UnaryStatement& statement) {
+        const auto applyUnaryOperation = [&](const std::vector<qc::Qubit>& var) {
+            switch (statement.op) {
+                case UnaryStatement::Invert:
+                    return bitwiseNegation(annotatableQuantumComputation, var);
+                case UnaryStatement::Increment:
+                    return incrementUsingSelectedIncrementer(var, false);
+                case UnaryStatement::Decrement:
+                    return incrementUsingSelectedIncrementer(var, true);
+                default:
+                    return false;
+            }
+        };
+
+        if (isDynamicallyIndexed(statement.var)) {
+            return onDynamicallyIndexedVariableUpdate(statement.var, applyUnaryOperation);
+        }
+
         // load variable
         std::vector<qc::Qubit> var;
         getVariables(statement.var, var);
-
-        switch (statement.op) {
-            case UnaryStatement::Invert:
-                return bitwiseNegation(annotatableQuantumComputation, var);
-            case UnaryStatement::Increment:
-                return increment(annotatableQuantumComputation, var);
-            case UnaryStatement::Decrement:
-                return decrement(annotatableQuantumComputation, var);
-            default:
-                return false;
-        }
+        return applyUnaryOperation(var);
     }
 
     bool SyrecSynthesis::onStatement(const AssignStatement& statement) {
+        if (isDynamicallyIndexed(statement.lhs)) {
+            return onDynamicallyIndexedVariableUpdate(statement.lhs, [&](const std::vector<qc::Qubit>& lhs) { return onAssignment(statement, lhs); });
+        }
+
         std::vector<qc::Qubit> lhs;
+        getVariables(statement.lhs, lhs);
+        return onAssignment(statement, std::move(lhs));
+    }
+
+    bool SyrecSynthesis::onAssignment(const AssignStatement& statement, std::vector<qc::Qubit> lhs) {
         std::vector<qc::Qubit> rhs;
         std::vector<qc::Qubit> d;
 
-        getVariables(statement.lhs, lhs);
         opRhsLhsExpression(statement.rhs, d);
         bool synthesisOfAssignmentOk = SyrecSynthesis::onExpression(statement.rhs, rhs, lhs, statement.op);
         opVec.clear();
@@ -326,7 +561,8 @@ namespace syrec {
         }
         // clear loop variable if necessary
         if (!loopVariable.empty()) {
-            assert(loopMap.erase(loopVariable) == 1U);
+            [[maybe_unused]] const auto nErasedLoopVariables = loopMap.erase(loopVariable);
+            assert(nErasedLoopVariables == 1U);
         }
 
         return true;
@@ -341,8 +577,8 @@ namespace syrec {
             moduleParameter->setReference(modules.top()->findParameterOrVariable(parameter));
         }
 
-        // 2. Create new lines for the module's variables
-        if (!addVariables(statement.target->variables)) {
+        // 2. Create new lines for the module's variables, every call is an instance of the module with variables of its own
+        if (!addVariables(statement.target->variables, nextInstanceLabelPrefix(*statement.target))) {
             return false;
         }
 
@@ -366,8 +602,8 @@ namespace syrec {
             moduleParameter->setReference(modules.top()->findParameterOrVariable(parameter));
         }
 
-        // 2. Create new lines for the module's variables
-        if (!addVariables(statement.target->variables)) {
+        // 2. Create new lines for the module's variables, every uncall is an instance of the module with variables of its own
+        if (!addVariables(statement.target->variables, nextInstanceLabelPrefix(*statement.target))) {
             return false;
         }
 
@@ -429,6 +665,9 @@ namespace syrec {
     }
 
     bool SyrecSynthesis::onExpression(const VariableExpression& expression, std::vector<qc::Qubit>& lines) {
+        if (isDynamicallyIndexed(expression.var)) {
+            return onDynamicallyIndexedVariableRead(expression.var, lines);
+        }
         getVariables(expression.var, lines);
         return true;
     }
@@ -437,7 +676,22 @@ namespace syrec {
         std::vector<qc::Qubit> lhs;
         std::vector<qc::Qubit> rhs;
 
-        if (!onExpression(expression.lhs, lhs, lhsStat, op) || !onExpression(expression.rhs, rhs, lhsStat, op)) {
+        // An (in-)equality check against a constant does not require the constant to be stored in ancillary qubits
+        std::optional<unsigned> comparedConstant;
+        if (useMctForEqualityWithConstant && (expression.op == BinaryExpression::Equals || expression.op == BinaryExpression::NotEquals)) {
+            const auto* numericLhs = dynamic_cast<NumericExpression*>(expression.lhs.get());
+            const auto* numericRhs = dynamic_cast<NumericExpression*>(expression.rhs.get());
+            if ((numericLhs == nullptr) != (numericRhs == nullptr)) {
+                comparedConstant = (numericLhs != nullptr ? numericLhs : numericRhs)->value->evaluate(loopMap);
+            }
+        }
+
+        if (comparedConstant.has_value()) {
+            const auto& nonConstantOperand = dynamic_cast<NumericExpression*>(expression.lhs.get()) != nullptr ? expression.rhs : expression.lhs;
+            if (!onExpression(nonConstantOperand, lhs, lhsStat, op)) {
+                return false;
+            }
+        } else if (!onExpression(expression.lhs, lhs, lhsStat, op) || !onExpression(expression.rhs, rhs, lhsStat, op)) {
             return false;
         }
 
@@ -502,7 +756,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = lessThan(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = lessThanUsingSelectedComparator(lines.front(), lhs, rhs);
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -513,7 +767,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = greaterThan(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = lessThanUsingSelectedComparator(lines.front(), rhs, lhs);
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -524,7 +778,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = equals(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = comparedConstant.has_value() ? equalsConstant(lines.front(), lhs, *comparedConstant) : equals(annotatableQuantumComputation, lines.front(), lhs, rhs);
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -535,7 +789,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = notEquals(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = comparedConstant.has_value() ? equalsConstant(lines.front(), lhs, *comparedConstant) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front()) : notEquals(annotatableQuantumComputation, lines.front(), lhs, rhs);
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -546,7 +800,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = lessEquals(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = lessThanUsingSelectedComparator(lines.front(), rhs, lhs) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front());
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -557,7 +811,7 @@ namespace syrec {
                 const std::optional<qc::Qubit> ancillaryQubitForIntermediateResult = getConstantLine(false);
                 if (ancillaryQubitForIntermediateResult.has_value()) {
                     lines.emplace_back(*ancillaryQubitForIntermediateResult);
-                    synthesisOfExprOk = greaterEquals(annotatableQuantumComputation, lines.front(), lhs, rhs);
+                    synthesisOfExprOk = lessThanUsingSelectedComparator(lines.front(), lhs, rhs) && annotatableQuantumComputation.addOperationsImplementingNotGate(lines.front());
                 } else {
                     synthesisOfExprOk = false;
                 }
@@ -609,6 +863,78 @@ namespace syrec {
         return synthesisOk;
     }
 
+    bool SyrecSynthesis::incrementUsingSelectedIncrementer(const std::vector<qc::Qubit>& dest, const bool inverse) {
+        // Below three bits, the cascade does not require MCT gates
+        if (incrementerImplementation == IncrementerImplementation::Cascade || dest.size() < 3) {
+            return inverse ? decrement(annotatableQuantumComputation, dest) : increment(annotatableQuantumComputation, dest);
+        }
+
+        // Qubits neither modified nor used as propagated control qubits can be borrowed in any state
+        const auto&            propagatedControlQubits = annotatableQuantumComputation.getPropagatedControlQubits();
+        std::vector<qc::Qubit> borrowedQubits;
+        for (qc::Qubit qubit = 0; qubit < annotatableQuantumComputation.getNqubits() && borrowedQubits.size() < dest.size(); ++qubit) {
+            if (std::find(dest.cbegin(), dest.cend(), qubit) == dest.cend() && propagatedControlQubits.count(qubit) == 0) {
+                borrowedQubits.emplace_back(qubit);
+            }
+        }
+        const bool canBorrowQubits = borrowedQubits.size() == dest.size();
+
+        auto selectedImplementation = incrementerImplementation;
+        if (selectedImplementation == IncrementerImplementation::CostBased) {
+            // Only the clean ancillary qubits already available are considered for the carry chain since additional qubits would change the cost of all other gates
+            const auto  numQubits  = annotatableQuantumComputation.getNqubits();
+            const auto& freeLines  = freeConstLinesMap[false];
+            auto        lowestCost = quantumCostOfSelfInverseGates(cascadeIncrementerGates(dest), propagatedControlQubits.size(), numQubits);
+            selectedImplementation = IncrementerImplementation::Cascade;
+            if (freeLines.size() >= dest.size() - 2) {
+                const std::vector<qc::Qubit> ancillaryQubits(freeLines.cend() - static_cast<std::ptrdiff_t>(dest.size() - 2), freeLines.cend());
+                const auto                   cost = quantumCostOfSelfInverseGates(carryChainIncrementerGates(dest, ancillaryQubits), propagatedControlQubits.size(), numQubits);
+                if (cost < lowestCost) {
+                    lowestCost             = cost;
+                    selectedImplementation = IncrementerImplementation::CarryChain;
+                }
+            }
+            if (canBorrowQubits && quantumCostOfSelfInverseGates(borrowedQubitsIncrementerGates(dest, borrowedQubits), propagatedControlQubits.size(), numQubits) < lowestCost) {
+                selectedImplementation = IncrementerImplementation::BorrowedQubits;
+            }
+        }
+
+        switch (selectedImplementation) {
+            case IncrementerImplementation::CarryChain:
+                return incrementUsingCarryChain(dest, inverse);
+            case IncrementerImplementation::BorrowedQubits:
+                // Fall back to the cascade if not enough qubits are idle
+                if (canBorrowQubits) {
+                    return addSelfInverseGates(annotatableQuantumComputation, borrowedQubitsIncrementerGates(dest, borrowedQubits), inverse);
+                }
+                break;
+            case IncrementerImplementation::Cascade:
+            case IncrementerImplementation::CostBased:
+                break;
+        }
+        return inverse ? decrement(annotatableQuantumComputation, dest) : increment(annotatableQuantumComputation, dest);
+    }
+
+    bool SyrecSynthesis::incrementUsingCarryChain(const std::vector<qc::Qubit>& dest, const bool inverse) {
+        std::vector<qc::Qubit> ancillaryQubits;
+        bool                   synthesisOk = true;
+        for (std::size_t i = 0; i + 2 < dest.size() && synthesisOk; ++i) {
+            const std::optional<qc::Qubit> ancillaryQubit = getConstantLine(false);
+            synthesisOk                                   = ancillaryQubit.has_value();
+            if (ancillaryQubit.has_value()) {
+                ancillaryQubits.emplace_back(*ancillaryQubit);
+            }
+        }
+
+        synthesisOk = synthesisOk && addSelfInverseGates(annotatableQuantumComputation, carryChainIncrementerGates(dest, ancillaryQubits), inverse);
+        if (synthesisOk) {
+            for (const auto ancillaryQubit: ancillaryQubits) {
+                releaseConstantLine(ancillaryQubit, false);
+            }
+        }
+        return synthesisOk;
+    }
+
     //**********************************************************************
     //*****                     Binary Operations                      *****
     //**********************************************************************
@@ -724,14 +1050,6 @@ namespace syrec {
         return synthesisOk;
     }
 
-    bool SyrecSynthesis::greaterEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit dest, const std::vector<qc::Qubit>& srcTwo, const std::vector<qc::Qubit>& srcOne) {
-        return greaterThan(annotatableQuantumComputation, dest, srcOne, srcTwo) && annotatableQuantumComputation.addOperationsImplementingNotGate(dest);
-    }
-
-    bool SyrecSynthesis::greaterThan(AnnotatableQuantumComputation& annotatableQuantumComputation, const qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1) {
-        return lessThan(annotatableQuantumComputation, dest, src1, src2);
-    }
-
     bool SyrecSynthesis::increase(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& rhs, const std::vector<qc::Qubit>& lhs) {
         if (lhs.size() != rhs.size()) {
             return false;
@@ -833,14 +1151,153 @@ namespace syrec {
         return synthesisOk;
     }
 
-    bool SyrecSynthesis::lessEquals(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src2, const std::vector<qc::Qubit>& src1) {
-        return lessThan(annotatableQuantumComputation, dest, src1, src2) && annotatableQuantumComputation.addOperationsImplementingNotGate(dest);
-    }
-
     bool SyrecSynthesis::lessThan(AnnotatableQuantumComputation& annotatableQuantumComputation, qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
         return decreaseWithCarry(annotatableQuantumComputation, src1, src2, dest) && increase(annotatableQuantumComputation, src1, src2);
     }
 
+    bool SyrecSynthesis::lessThanUsingSelectedComparator(const qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
+        switch (comparatorImplementation) {
+            case ComparatorImplementation::CarryChain:
+                return lessThanUsingCarryChain(dest, src1, src2);
+            case ComparatorImplementation::LogDepthTree:
+                return lessThanUsingComparatorTree(dest, src1, src2);
+            case ComparatorImplementation::SubtractAndRestore:
+                break;
+        }
+        return lessThan(annotatableQuantumComputation, dest, src1, src2);
+    }
+
+    bool SyrecSynthesis::lessThanUsingCarryChain(const qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
+        if (src1.empty() || src1.size() != src2.size()) {
+            return false;
+        }
+
+        const std::optional<qc::Qubit> carryIn = getConstantLine(false);
+        if (!carryIn.has_value()) {
+            return false;
+        }
+
+        // src1 < src2 holds iff the addition ~src1 + src2 generates a carry out of the most significant bit. Only the carry chain (the MAJ gates of the
+        // ripple-carry adder of Cuccaro et al.) is computed, the carry out is copied to dest and the chain is uncomputed again without calculating the sum.
+        const std::size_t bitwidth    = src1.size();
+        bool              synthesisOk = bitwiseNegation(annotatableQuantumComputation, src1);
+        for (std::size_t i = 0; i < bitwidth && synthesisOk; ++i) {
+            const qc::Qubit carry = i == 0 ? *carryIn : src1[i - 1];
+            synthesisOk           = annotatableQuantumComputation.addOperationsImplementingCnotGate(src1[i], src2[i]) && annotatableQuantumComputation.addOperationsImplementingCnotGate(src1[i], carry) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(carry, src2[i], src1[i]);
+        }
+
+        synthesisOk &= annotatableQuantumComputation.addOperationsImplementingCnotGate(src1.back(), dest);
+        for (std::size_t i = bitwidth; i > 0 && synthesisOk; --i) {
+            const qc::Qubit carry = i == 1 ? *carryIn : src1[i - 2];
+            synthesisOk           = annotatableQuantumComputation.addOperationsImplementingToffoliGate(carry, src2[i - 1], src1[i - 1]) && annotatableQuantumComputation.addOperationsImplementingCnotGate(src1[i - 1], carry) && annotatableQuantumComputation.addOperationsImplementingCnotGate(src1[i - 1], src2[i - 1]);
+        }
+        synthesisOk &= bitwiseNegation(annotatableQuantumComputation, src1);
+
+        if (synthesisOk) {
+            releaseConstantLine(*carryIn, false);
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::lessThanUsingComparatorTree(const qc::Qubit dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
+        if (src1.empty() || src1.size() != src2.size()) {
+            return false;
+        }
+
+        // Every node of the tree stores whether the bits of src1 covered by the node are less than (lt) or equal to (eq) the corresponding bits of src2.
+        struct ComparatorTreeNode {
+            qc::Qubit lt;
+            qc::Qubit eq;
+        };
+
+        std::vector<SelfInverseGate> computeGates;
+        std::vector<qc::Qubit>       ancillaryQubits;
+
+        bool synthesisOk = true;
+        auto addGate     = [&](std::vector<qc::Qubit> controls, const qc::Qubit target) {
+            if (synthesisOk) {
+                computeGates.push_back({std::move(controls), target});
+                synthesisOk = addSelfInverseGate(annotatableQuantumComputation, computeGates.back());
+            }
+        };
+        auto fetchAncillaryQubit = [&]() -> qc::Qubit {
+            const std::optional<qc::Qubit> ancillaryQubit = getConstantLine(false);
+            synthesisOk &= ancillaryQubit.has_value();
+            if (!ancillaryQubit.has_value()) {
+                return 0U;
+            }
+            ancillaryQubits.emplace_back(*ancillaryQubit);
+            return *ancillaryQubit;
+        };
+
+        // Leaves (ordered from the least to the most significant bit): lt_i = !a_i & b_i, eq_i = !(a_i ^ b_i) with the latter being computed in-place on b_i
+        std::vector<ComparatorTreeNode> nodes;
+        nodes.reserve(src1.size());
+        for (std::size_t i = 0; i < src1.size() && synthesisOk; ++i) {
+            const qc::Qubit lt = fetchAncillaryQubit();
+            addGate({}, src1[i]);
+            addGate({src1[i], src2[i]}, lt);
+            addGate({}, src1[i]);
+            addGate({src1[i]}, src2[i]);
+            addGate({}, src2[i]);
+            nodes.push_back({lt, src2[i]});
+        }
+
+        // Combination of two neighbouring nodes: lt = lt_hi ^ (eq_hi & lt_lo), eq = eq_hi & eq_lo. The nodes of one level operate on disjoint qubits.
+        while (nodes.size() > 1 && synthesisOk) {
+            const bool                      isRootLevel = nodes.size() == 2;
+            std::vector<ComparatorTreeNode> parentNodes;
+            for (std::size_t i = 0; i + 1 < nodes.size() && synthesisOk; i += 2) {
+                const auto& lo = nodes[i];
+                const auto& hi = nodes[i + 1];
+
+                const qc::Qubit lt = fetchAncillaryQubit();
+                addGate({hi.lt}, lt);
+                addGate({hi.eq, lo.lt}, lt);
+
+                // The equality flag of the root is not required
+                qc::Qubit eq = lt;
+                if (!isRootLevel) {
+                    eq = fetchAncillaryQubit();
+                    addGate({hi.eq, lo.eq}, eq);
+                }
+                parentNodes.push_back({lt, eq});
+            }
+            if (nodes.size() % 2 != 0) {
+                parentNodes.emplace_back(nodes.back());
+            }
+            nodes = std::move(parentNodes);
+        }
+
+        synthesisOk = synthesisOk && annotatableQuantumComputation.addOperationsImplementingCnotGate(nodes.front().lt, dest);
+        for (auto gate = computeGates.crbegin(); gate != computeGates.crend() && synthesisOk; ++gate) {
+            synthesisOk = addSelfInverseGate(annotatableQuantumComputation, *gate);
+        }
+
+        if (synthesisOk) {
+            for (const auto ancillaryQubit: ancillaryQubits) {
+                releaseConstantLine(ancillaryQubit, false);
+            }
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::equalsConstant(const qc::Qubit dest, const std::vector<qc::Qubit>& src, const unsigned value) {
+        if (src.empty()) {
+            return false;
+        }
+
+        // The lines whose corresponding bit of the constant is 0 are negated so that a single MCT gate fires iff src equals the constant
+        std::vector<qc::Qubit> negatedLines;
+        for (std::size_t i = 0; i < src.size(); ++i) {
+            if (i >= 32U || ((value >> i) & 1U) == 0U) {
+                negatedLines.emplace_back(src[i]);
+            }
+        }
+
+        return bitwiseNegation(annotatableQuantumComputation, negatedLines) && annotatableQuantumComputation.addOperationsImplementingMultiControlToffoliGate(qc::Controls(src.begin(), src.end()), dest) && bitwiseNegation(annotatableQuantumComputation, negatedLines);
+    }
+
     bool SyrecSynthesis::modulo(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<qc::Qubit>& dest, const std::vector<qc::Qubit>& src1, const std::vector<qc::Qubit>& src2) {
         std::vector<qc::Qubit> sum;
         std::vector<qc::Qubit> partial;
@@ -985,45 +1442,174 @@ namespace syrec {
                     const auto evaluatedDimensionIndexValue = dynamic_cast<NumericExpression*>(var->indexes.at(i).get())->value->evaluate(loopMap);
                     qc::Qubit  aggregateValue               = evaluatedDimensionIndexValue;
                     for (std::size_t j = i + 1; j < numDeclaredDimensionsOfVariable; ++j) {
-                        aggregateValue *= referenceVariableData->dimensions[i];
+                        aggregateValue *= referenceVariableData->dimensions[j];
                     }
                     offset += aggregateValue * referenceVariableData->bitwidth;
                 }
             }
         }
+        getAccessedLinesOfElement(var, offset, loopMap, lines);
+    }
 
+    void SyrecSynthesis::getAccessedLinesOfElement(const VariableAccess::ptr& var, const qc::Qubit elementOffset, const Number::loop_variable_mapping& loopVariableMapping, std::vector<qc::Qubit>& lines) {
         if (var->range) {
             auto [nfirst, nsecond] = *var->range;
 
-            const qc::Qubit first  = nfirst->evaluate(loopMap);
-            const qc::Qubit second = nsecond->evaluate(loopMap);
+            const qc::Qubit first  = nfirst->evaluate(loopVariableMapping);
+            const qc::Qubit second = nsecond->evaluate(loopVariableMapping);
 
             if (first < second) {
                 for (qc::Qubit i = first; i <= second; ++i) {
-                    lines.emplace_back(offset + i);
+                    lines.emplace_back(elementOffset + i);
                 }
             } else {
                 for (auto i = static_cast<int>(first); i >= static_cast<int>(second); --i) {
-                    lines.emplace_back(offset + static_cast<qc::Qubit>(i));
+                    lines.emplace_back(elementOffset + static_cast<qc::Qubit>(i));
                 }
             }
         } else {
-            for (qc::Qubit i = 0U; i < referenceVariableData->bitwidth; ++i) {
-                lines.emplace_back(offset + i);
+            for (qc::Qubit i = 0U; i < var->getVar()->bitwidth; ++i) {
+                lines.emplace_back(elementOffset + i);
             }
         }
     }
 
+    //**********************************************************************
+    //*****                  Dynamic Array Indexing                    *****
+    //**********************************************************************
+
+    bool SyrecSynthesis::isDynamicallyIndexed(const VariableAccess::ptr& var) {
+        return std::any_of(var->indexes.cbegin(), var->indexes.cend(), [](const Expression::ptr& index) { return dynamic_cast<const NumericExpression*>(index.get()) == nullptr; });
+    }
+
+    bool SyrecSynthesis::evaluateArrayIndexes(const VariableAccess::ptr& var, std::vector<EvaluatedArrayIndex>& indexes) {
+        bool synthesisOk = var->indexes.size() == var->getVar()->dimensions.size();
+        for (std::size_t i = 0; i < var->indexes.size() && synthesisOk; ++i) {
+            EvaluatedArrayIndex evaluatedIndex;
+            if (auto const* numeric = dynamic_cast<NumericExpression*>(var->indexes[i].get())) {
+                evaluatedIndex.value = numeric->value->evaluate(loopMap);
+            } else {
+                synthesisOk = onExpression(var->indexes[i], evaluatedIndex.lines, {}, 0U) && !evaluatedIndex.lines.empty();
+            }
+            indexes.emplace_back(std::move(evaluatedIndex));
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::forEachSelectableArrayElement(const VariableAccess::ptr& var, const std::vector<EvaluatedArrayIndex>& indexes, const std::size_t dimension, const qc::Qubit elementOffset, const std::function<bool(const std::vector<qc::Qubit>&)>& onElement) {
+        const auto& referenceVariableData = var->getVar();
+        if (dimension == indexes.size()) {
+            std::vector<qc::Qubit> elementLines;
+            getAccessedLinesOfElement(var, varLines[referenceVariableData] + elementOffset * referenceVariableData->bitwidth, loopMap, elementLines);
+            return onElement(elementLines);
+        }
+
+        qc::Qubit stride = 1U;
+        for (std::size_t j = dimension + 1; j < referenceVariableData->dimensions.size(); ++j) {
+            stride *= referenceVariableData->dimensions[j];
+        }
+
+        const auto& index = indexes[dimension];
+        if (index.value.has_value()) {
+            return forEachSelectableArrayElement(var, indexes, dimension + 1, elementOffset + *index.value * stride, onElement);
+        }
+        // Every element of the current dimension is processed with the qubit selecting it (i.e. index == element) being used as an additional control qubit
+        return unaryIteration(index.lines, index.lines.size(), std::nullopt, 0U, referenceVariableData->dimensions[dimension], [&](const std::size_t element) {
+            return forEachSelectableArrayElement(var, indexes, dimension + 1, elementOffset + static_cast<qc::Qubit>(element) * stride, onElement);
+        });
+    }
+
+    bool SyrecSynthesis::unaryIteration(const std::vector<qc::Qubit>& selectorLines, const std::size_t nUndecodedSelectorLines, const std::optional<qc::Qubit> selectLine, const std::size_t firstCase, const std::size_t nCases, const std::function<bool(std::size_t)>& onCase) {
+        // Cases outside of the range [0, nCases) are pruned from the decoding tree
+        if (firstCase >= nCases) {
+            return true;
+        }
+
+        if (nUndecodedSelectorLines == 0) {
+            annotatableQuantumComputation.activateControlQubitPropagationScope();
+            if (selectLine.has_value()) {
+                annotatableQuantumComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(*selectLine);
+            }
+            const bool synthesisOk = onCase(firstCase);
+            annotatableQuantumComputation.deactivateControlQubitPropagationScope();
+            return synthesisOk;
+        }
+
+        // The selector lines are decoded starting from the most significant one with each node of the decoding tree sharing the select qubit of its parent
+        const qc::Qubit   selectorLine     = selectorLines[nUndecodedSelectorLines - 1];
+        const std::size_t firstCaseOfOnes  = nUndecodedSelectorLines - 1 < 64U ? firstCase + (static_cast<std::size_t>(1) << (nUndecodedSelectorLines - 1)) : nCases;
+        const bool        hasCasesForOnes  = firstCaseOfOnes < nCases;
+        if (!selectLine.has_value()) {
+            bool synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine) && unaryIteration(selectorLines, nUndecodedSelectorLines - 1, selectorLine, firstCase, nCases, onCase) && annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine);
+            if (synthesisOk && hasCasesForOnes) {
+                synthesisOk = unaryIteration(selectorLines, nUndecodedSelectorLines - 1, selectorLine, firstCaseOfOnes, nCases, onCase);
+            }
+            return synthesisOk;
+        }
+
+        const std::optional<qc::Qubit> childSelectLine = getConstantLine(false);
+        if (!childSelectLine.has_value()) {
+            return false;
+        }
+
+        // childSelectLine = selectLine & !selectorLine
+        bool synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(*selectLine, selectorLine, *childSelectLine) && annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine) && unaryIteration(selectorLines, nUndecodedSelectorLines - 1, childSelectLine, firstCase, nCases, onCase);
+        if (synthesisOk && hasCasesForOnes) {
+            // childSelectLine = (selectLine & !selectorLine) ^ selectLine = selectLine & selectorLine
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingCnotGate(*selectLine, *childSelectLine) && unaryIteration(selectorLines, nUndecodedSelectorLines - 1, childSelectLine, firstCaseOfOnes, nCases, onCase) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(*selectLine, selectorLine, *childSelectLine);
+        } else if (synthesisOk) {
+            synthesisOk = annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine) && annotatableQuantumComputation.addOperationsImplementingToffoliGate(*selectLine, selectorLine, *childSelectLine) && annotatableQuantumComputation.addOperationsImplementingNotGate(selectorLine);
+        }
+
+        if (synthesisOk) {
+            releaseConstantLine(*childSelectLine, false);
+        }
+        return synthesisOk;
+    }
+
+    bool SyrecSynthesis::onDynamicallyIndexedVariableRead(const VariableAccess::ptr& var, std::vector<qc::Qubit>& lines) {
+        // The accessed element is copied to new ancillary qubits using a multiplexer over all elements of the array
+        std::vector<EvaluatedArrayIndex> indexes;
+        return evaluateArrayIndexes(var, indexes) && getConstantLines(var->bitwidth(), 0U, lines) && forEachSelectableArrayElement(var, indexes, 0, 0U, [&](const std::vector<qc::Qubit>& elementLines) {
+                   return bitwiseCnot(annotatableQuantumComputation, lines, elementLines);
+               });
+    }
+
+    bool SyrecSynthesis::onDynamicallyIndexedVariableUpdate(const VariableAccess::ptr& var, const std::function<bool(const std::vector<qc::Qubit>&)>& update) {
+        // The accessed element is swapped into ancillary qubits, updated there and swapped back into the array afterwards
+        std::vector<EvaluatedArrayIndex> indexes;
+        std::vector<qc::Qubit>           gatheredLines;
+        if (!evaluateArrayIndexes(var, indexes) || !getConstantLines(var->bitwidth(), 0U, gatheredLines)) {
+            return false;
+        }
+
+        const auto swapWithGatheredLines = [&](const std::vector<qc::Qubit>& elementLines) {
+            return swap(annotatableQuantumComputation, gatheredLines, elementLines);
+        };
+        if (!forEachSelectableArrayElement(var, indexes, 0, 0U, swapWithGatheredLines) || !update(gatheredLines) || !forEachSelectableArrayElement(var, indexes, 0, 0U, swapWithGatheredLines)) {
+            return false;
+        }
+
+        // The ancillary qubits are only guaranteed to be restored if every value of the indexes selects an element of the array
+        const auto& dimensions                 = var->getVar()->dimensions;
+        bool        everyIndexValueIsSelectable = true;
+        for (std::size_t i = 0; i < indexes.size() && everyIndexValueIsSelectable; ++i) {
+            everyIndexValueIsSelectable = indexes[i].value.has_value() || (indexes[i].lines.size() < 32U && (static_cast<std::size_t>(1) << indexes[i].lines.size()) <= dimensions[i]);
+        }
+        if (everyIndexValueIsSelectable) {
+            for (const auto line: gatheredLines) {
+                releaseConstantLine(line, false);
+            }
+        }
+        return true;
+    }
+
     std::optional<qc::Qubit> SyrecSynthesis::getConstantLine(bool value) {
         qc::Qubit constLine = 0U;
 
         if (!freeConstLinesMap[value].empty()) {
             constLine = freeConstLinesMap[value].back();
             freeConstLinesMap[value].pop_back();
-        } else if (!freeConstLinesMap[!value].empty()) {
-            constLine = freeConstLinesMap[!value].back();
-            freeConstLinesMap[!value].pop_back();
-            annotatableQuantumComputation.addOperationsImplementingNotGate(constLine);
         } else {
             const auto                     qubitIndex          = static_cast<qc::Qubit>(annotatableQuantumComputation.getNqubits());
             const std::string              qubitLabel          = "q_" + std::to_string(qubitIndex) + "_const_" + std::to_string(static_cast<int>(value));
@@ -1036,6 +1622,11 @@ namespace syrec {
         return constLine;
     }
 
+    void SyrecSynthesis::releaseConstantLine(const qc::Qubit line, const bool value) {
+        // Released lines are only handed out again for the same value since inverting them could be subject to propagated control qubits
+        freeConstLinesMap[value].emplace_back(line);
+    }
+
     bool SyrecSynthesis::getConstantLines(unsigned bitwidth, qc::Qubit value, std::vector<qc::Qubit>& lines) {
         assert(bitwidth <= 32);
 
@@ -1051,12 +1642,21 @@ namespace syrec {
         return couldQubitsForConstantLinesBeFetched;
     }
 
-    bool SyrecSynthesis::addVariable(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<unsigned>& dimensions, const Variable::ptr& var, const std::string& arraystr) {
+    bool SyrecSynthesis::addVariable(AnnotatableQuantumComputation& annotatableQuantumComputation, const std::vector<unsigned>& dimensions, const Variable::ptr& var, const std::string& arraystr, const std::string& labelPrefix) {
         bool couldQubitsForVariableBeAdded = true;
         if (dimensions.empty()) {
             for (qc::Qubit i = 0U; i < var->bitwidth && couldQubitsForVariableBeAdded; ++i) {
-                const std::string qubitLabel     = var->name + arraystr + "." + std::to_string(i);
-                const bool        isGarbageQubit = var->type == Variable::In || var->type == Variable::Wire;
+                const std::string qubitLabel = labelPrefix + var->name + arraystr + "." + std::to_string(i);
+                if (var->type == Variable::Wire) {
+                    // wires are local variables with the constant input 0 and a garbage output, i.e. zero-initialized ancillary qubits
+                    const auto qubit = annotatableQuantumComputation.addPreliminaryAncillaryQubit(qubitLabel, false);
+                    if (qubit.has_value()) {
+                        annotatableQuantumComputation.setLogicalQubitGarbage(*qubit);
+                    }
+                    couldQubitsForVariableBeAdded &= qubit.has_value();
+                    continue;
+                }
+                const bool isGarbageQubit = var->type == Variable::In;
                 couldQubitsForVariableBeAdded &= annotatableQuantumComputation.addNonAncillaryQubit(qubitLabel, isGarbageQubit).has_value();
             }
         } else {
@@ -1064,7 +1664,7 @@ namespace syrec {
             const std::vector<qc::Qubit> newDimensions(dimensions.begin() + 1U, dimensions.end());
 
             for (qc::Qubit i = 0U; i < len && couldQubitsForVariableBeAdded; ++i) {
-                couldQubitsForVariableBeAdded &= addVariable(annotatableQuantumComputation, newDimensions, var, arraystr + "[" + std::to_string(i) + "]");
+                couldQubitsForVariableBeAdded &= addVariable(annotatableQuantumComputation, newDimensions, var, arraystr + "[" + std::to_string(i) + "]", labelPrefix);
             }
         }
         return couldQubitsForVariableBeAdded;
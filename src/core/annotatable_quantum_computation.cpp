@@ -10,16 +10,21 @@
 
 #include "core/annotatable_quantum_computation.hpp"
 
+#include "core/memory_report.hpp"
+#include "core/quantum_cost_kernel.hpp"
 #include "ir/Definitions.hpp"
 #include "ir/operations/Control.hpp"
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/Operation.hpp"
+#include "ir/operations/StandardOperation.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -109,6 +114,7 @@ std::optional<qc::Qubit> AnnotatableQuantumComputation::addNonAncillaryQubit(con
     const auto            qubitIndex = static_cast<qc::Qubit>(getNqubits());
     constexpr std::size_t qubitSize  = 1;
     addQubitRegister(qubitSize, qubitLabel);
+    bytesOfQubitRegisters += bytesOfQubitRegister(qubitLabel);
     if (isGarbageQubit) {
         setLogicalQubitGarbage(qubitIndex);
     }
@@ -123,6 +129,7 @@ std::optional<qc::Qubit> AnnotatableQuantumComputation::addPreliminaryAncillaryQ
     constexpr std::size_t qubitSize  = 1;
 
     addQubitRegister(qubitSize, qubitLabel);
+    bytesOfQubitRegisters += bytesOfQubitRegister(qubitLabel);
     addedAncillaryQubitIndices.emplace(qubitIndex);
 
     if (initialStateOfQubit) {
@@ -179,60 +186,73 @@ AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComput
         return cost;
     }
 
+    if (numQubits <= QuantumCostKernel::MAX_QUBITS) {
+        return QuantumCostKernel(*this).cost();
+    }
     for (const auto& quantumOperation: ops) {
-        const std::size_t c             = std::min(quantumOperation->getNcontrols() + static_cast<std::size_t>(quantumOperation->getType() == qc::OpType::SWAP), numQubits - 1);
-        const std::size_t numEmptyLines = numQubits - c - 1U;
-
-        switch (c) {
-            case 0U:
-            case 1U:
-                cost += 1ULL;
-                break;
-            case 2U:
-                cost += 5ULL;
-                break;
-            case 3U:
-                cost += 13ULL;
-                break;
-            case 4U:
-                cost += (numEmptyLines >= 2U) ? 26ULL : 29ULL;
-                break;
-            case 5U:
-                if (numEmptyLines >= 3U) {
-                    cost += 38ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 52ULL;
-                } else {
-                    cost += 61ULL;
-                }
-                break;
-            case 6U:
-                if (numEmptyLines >= 4U) {
-                    cost += 50ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 80ULL;
-                } else {
-                    cost += 125ULL;
-                }
-                break;
-            case 7U:
-                if (numEmptyLines >= 5U) {
-                    cost += 62ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 100ULL;
-                } else {
-                    cost += 253ULL;
-                }
-                break;
-            default:
-                if (numEmptyLines >= c - 2U) {
-                    cost += 12ULL * c - 22ULL;
-                } else if (numEmptyLines >= 1U) {
-                    cost += 24ULL * c - 87ULL;
-                } else {
-                    cost += (1ULL << (c + 1ULL)) - 3ULL;
-                }
-        }
+        cost += getQuantumCostOfOperationForSynthesis(quantumOperation->getNcontrols(), quantumOperation->getType(), numQubits);
+    }
+    return cost;
+}
+
+AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(const std::size_t numControlQubits, const qc::OpType operationType, const std::size_t numQubits) {
+    SynthesisCostMetricValue cost = 0;
+    if (numQubits == 0) {
+        return cost;
+    }
+
+    const std::size_t c             = std::min(numControlQubits + static_cast<std::size_t>(operationType == qc::OpType::SWAP), numQubits - 1);
+    const std::size_t numEmptyLines = numQubits - c - 1U;
+
+    switch (c) {
+        case 0U:
+        case 1U:
+            cost = 1ULL;
+            break;
+        case 2U:
+            cost = 5ULL;
+            break;
+        case 3U:
+            cost = 13ULL;
+            break;
+        case 4U:
+            cost = (numEmptyLines >= 2U) ? 26ULL : 29ULL;
+            break;
+        case 5U:
+            if (numEmptyLines >= 3U) {
+                cost = 38ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost = 52ULL;
+            } else {
+                cost = 61ULL;
+            }
+            break;
+        case 6U:
+            if (numEmptyLines >= 4U) {
+                cost = 50ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost = 80ULL;
+            } else {
+                cost = 125ULL;
+            }
+            break;
+        case 7U:
+            if (numEmptyLines >= 5U) {
+                cost = 62ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost = 100ULL;
+            } else {
+                cost = 253ULL;
+            }
+            break;
+        default:
+            if (numEmptyLines >= c - 2U) {
+                cost = 12ULL * c - 22ULL;
+            } else if (numEmptyLines >= 1U) {
+                cost = 24ULL * c - 87ULL;
+            } else {
+                cost = (1ULL << (c + 1ULL)) - 3ULL;
+            }
     }
     return cost;
 }
@@ -245,6 +265,64 @@ AnnotatableQuantumComputation::SynthesisCostMetricValue AnnotatableQuantumComput
     return cost;
 }
 
+MemoryReport AnnotatableQuantumComputation::memoryReport() const {
+    MemoryReport report;
+
+    report.add("qc.operations", ops.capacity() * sizeof(ops.front()), 0U);
+    for (const auto& quantumOperation: ops) {
+        report.add("qc.operations", bytesOfQuantumOperation(*quantumOperation));
+    }
+
+    for (const auto& [qubitLabel, _]: getQuantumRegisters()) {
+        report.add("qc.qubit_registers", bytesOfQubitRegister(qubitLabel));
+    }
+    report.add("qc.qubit_registers", addedAncillaryQubitIndices.size() * (sizeof(qc::Qubit) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD), addedAncillaryQubitIndices.size());
+
+    const auto accountAnnotations = [&report](const QuantumOperationAnnotationsLookup& annotations) {
+        for (const auto& annotation: annotations) {
+            report.add("qc.annotations", bytesOfAnnotation(annotation));
+        }
+    };
+    report.add("qc.annotations", annotationsPerQuantumOperation.capacity() * sizeof(QuantumOperationAnnotationsLookup), 0U);
+    for (const auto& annotationsOfQuantumOperation: annotationsPerQuantumOperation) {
+        accountAnnotations(annotationsOfQuantumOperation);
+    }
+    accountAnnotations(activateGlobalQuantumOperationAnnotations);
+
+    report.add("qc.control_propagation", aggregateOfPropagatedControlQubits.size() * (sizeof(qc::Qubit) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD), aggregateOfPropagatedControlQubits.size());
+    report.add("qc.control_propagation", controlQubitPropgationScopes.capacity() * sizeof(std::unordered_map<qc::Qubit, bool>), 0U);
+    for (const auto& scope: controlQubitPropgationScopes) {
+        report.add("qc.control_propagation", scope.size() * (sizeof(std::pair<const qc::Qubit, bool>) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD), scope.size());
+    }
+    return report;
+}
+
+std::size_t AnnotatableQuantumComputation::sampleMemoryBytes(MemorySampler& sampler) const {
+    // Quantum operations and their annotations are only ever appended, thus only the ones added since the last sample need to be walked
+    for (; sampler.nAccountedQuantumOperations < ops.size(); ++sampler.nAccountedQuantumOperations) {
+        sampler.bytesOfAccountedQuantumOperations += bytesOfQuantumOperation(*ops[sampler.nAccountedQuantumOperations]);
+        if (sampler.nAccountedQuantumOperations < annotationsPerQuantumOperation.size()) {
+            for (const auto& annotation: annotationsPerQuantumOperation[sampler.nAccountedQuantumOperations]) {
+                sampler.bytesOfAccountedQuantumOperations += bytesOfAnnotation(annotation);
+            }
+        }
+    }
+
+    std::size_t bytes = sampler.bytesOfAccountedQuantumOperations + ops.capacity() * sizeof(ops.front()) + annotationsPerQuantumOperation.capacity() * sizeof(QuantumOperationAnnotationsLookup);
+    bytes += bytesOfQubitRegisters + addedAncillaryQubitIndices.size() * (sizeof(qc::Qubit) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD);
+    for (const auto& annotation: activateGlobalQuantumOperationAnnotations) {
+        bytes += bytesOfAnnotation(annotation);
+    }
+
+    // The data used for the propagation of control qubits only grows with the nesting depth of the propagation scopes
+    bytes += aggregateOfPropagatedControlQubits.size() * (sizeof(qc::Qubit) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD);
+    bytes += controlQubitPropgationScopes.capacity() * sizeof(std::unordered_map<qc::Qubit, bool>);
+    for (const auto& scope: controlQubitPropgationScopes) {
+        bytes += scope.size() * (sizeof(std::pair<const qc::Qubit, bool>) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD);
+    }
+    return bytes;
+}
+
 void AnnotatableQuantumComputation::activateControlQubitPropagationScope() {
     controlQubitPropgationScopes.emplace_back();
 }
@@ -339,6 +417,20 @@ bool AnnotatableQuantumComputation::setOrUpdateAnnotationOfQuantumOperation(std:
 }
 
 // BEGIN NON-PUBLIC FUNCTIONALITY
+std::size_t AnnotatableQuantumComputation::bytesOfQuantumOperation(const qc::Operation& quantumOperation) {
+    // All quantum operations created by the synthesis are standard operations, thus their size is used for every quantum operation.
+    return sizeof(qc::StandardOperation) + quantumOperation.getControls().size() * (sizeof(qc::Control) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD) + quantumOperation.getTargets().capacity() * sizeof(qc::Qubit);
+}
+
+std::size_t AnnotatableQuantumComputation::bytesOfAnnotation(const QuantumOperationAnnotationsLookup::value_type& annotation) {
+    return sizeof(QuantumOperationAnnotationsLookup::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD + MemoryReport::dynamicBytes(annotation.first) + MemoryReport::dynamicBytes(annotation.second);
+}
+
+std::size_t AnnotatableQuantumComputation::bytesOfQubitRegister(const std::string& qubitLabel) const {
+    using QuantumRegisterEntry = std::decay_t<decltype(*getQuantumRegisters().cbegin())>;
+    return sizeof(QuantumRegisterEntry) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD + MemoryReport::dynamicBytes(qubitLabel);
+}
+
 bool AnnotatableQuantumComputation::isQubitWithinRange(const qc::Qubit qubit) const noexcept {
     return qubit < getNqubits();
 }
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/circuit_layout.hpp"
+
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+using namespace syrec;
+
+CircuitLayout::CircuitLayout(const qc::QuantumComputation& quantumComputation):
+    nQubits(quantumComputation.getNqubits()) {
+    const auto nGates = quantumComputation.getNops();
+    columns.reserve(nGates);
+    firstLines.reserve(nGates);
+    lastLines.reserve(nGates);
+
+    // first column in which each line is not occupied by a gate yet
+    std::vector<std::size_t> nextFreeColumn(nQubits, 0U);
+    std::size_t              nColumns = 0U;
+    for (const auto& op: quantumComputation) {
+        auto       first = static_cast<qc::Qubit>(-1);
+        qc::Qubit  last  = 0U;
+        const auto add   = [&](const qc::Qubit qubit) {
+            first = std::min(first, qubit);
+            last  = std::max(last, qubit);
+        };
+        for (const auto target: op->getTargets()) {
+            add(target);
+        }
+        for (const auto& control: op->getControls()) {
+            add(control.qubit);
+        }
+
+        if (first > last) {
+            columns.emplace_back(0U);
+            firstLines.emplace_back(1U);
+            lastLines.emplace_back(0U);
+            nColumns = std::max<std::size_t>(nColumns, 1U);
+            continue;
+        }
+        if (last >= nextFreeColumn.size()) {
+            nextFreeColumn.resize(static_cast<std::size_t>(last) + 1U, 0U);
+        }
+
+        const auto begin  = nextFreeColumn.begin() + first;
+        const auto end    = nextFreeColumn.begin() + last + 1;
+        const auto column = *std::max_element(begin, end);
+        std::fill(begin, end, column + 1U);
+
+        columns.emplace_back(column);
+        firstLines.emplace_back(first);
+        lastLines.emplace_back(last);
+        nColumns = std::max(nColumns, column + 1U);
+    }
+
+    // sort the gates by their column (counting sort keeps the order of the circuit within a column)
+    columnOffsets.assign(nColumns + 1U, 0U);
+    for (const auto column: columns) {
+        ++columnOffsets[column + 1U];
+    }
+    for (std::size_t column = 0U; column < nColumns; ++column) {
+        columnOffsets[column + 1U] += columnOffsets[column];
+    }
+    gatesByColumn.resize(columns.size());
+    auto nextSlot = columnOffsets;
+    for (std::size_t gate = 0U; gate < columns.size(); ++gate) {
+        gatesByColumn[nextSlot[columns[gate]]++] = gate;
+    }
+}
+
+std::vector<std::size_t> CircuitLayout::gatesInColumn(const std::size_t column) const {
+    if (column >= getNcolumns()) {
+        return {};
+    }
+    return {gatesByColumn.cbegin() + static_cast<std::ptrdiff_t>(columnOffsets[column]), gatesByColumn.cbegin() + static_cast<std::ptrdiff_t>(columnOffsets[column + 1U])};
+}
+
+CircuitLayout::Tile CircuitLayout::tile(const std::size_t columnBegin, std::size_t columnEnd, const std::size_t columnResolution, const std::size_t lineBegin, std::size_t lineEnd, const std::size_t lineResolution) const {
+    if (columnResolution == 0U || lineResolution == 0U) {
+        throw std::invalid_argument("The resolution of a tile must be positive");
+    }
+    if (columnBegin >= columnEnd || lineBegin >= lineEnd) {
+        throw std::invalid_argument("The column and line ranges of a tile must not be empty");
+    }
+    columnEnd = std::min(columnEnd, getNcolumns());
+    lineEnd   = std::min(lineEnd, nQubits);
+
+    Tile tile;
+    tile.columnBegin      = columnBegin;
+    tile.columnResolution = columnResolution;
+    tile.nColumnBuckets   = columnBegin < columnEnd ? (columnEnd - columnBegin + columnResolution - 1U) / columnResolution : 0U;
+    tile.lineBegin        = lineBegin;
+    tile.lineResolution   = lineResolution;
+    tile.nLineBuckets     = lineBegin < lineEnd ? (lineEnd - lineBegin + lineResolution - 1U) / lineResolution : 0U;
+    tile.counts.assign(tile.nLineBuckets * tile.nColumnBuckets, 0U);
+    tile.representatives.assign(tile.nLineBuckets * tile.nColumnBuckets, NO_GATE);
+    if (tile.counts.empty()) {
+        return tile;
+    }
+
+    for (auto column = columnBegin; column < columnEnd; ++column) {
+        const auto columnBucket = (column - columnBegin) / columnResolution;
+        for (auto slot = columnOffsets[column]; slot < columnOffsets[column + 1U]; ++slot) {
+            const auto gate  = gatesByColumn[slot];
+            const auto first = std::max<std::size_t>(firstLines[gate], lineBegin);
+            const auto last  = std::min<std::size_t>(lastLines[gate], lineEnd - 1U);
+            if (first > last) {
+                continue;
+            }
+            for (auto lineBucket = (first - lineBegin) / lineResolution; lineBucket <= (last - lineBegin) / lineResolution; ++lineBucket) {
+                const auto cell = (lineBucket * tile.nColumnBuckets) + columnBucket;
+                ++tile.counts[cell];
+                if (tile.representatives[cell] == NO_GATE || static_cast<std::size_t>(tile.representatives[cell]) > gate) {
+                    tile.representatives[cell] = static_cast<std::int64_t>(gate);
+                }
+            }
+        }
+    }
+    return tile;
+}
@@ -10,6 +10,7 @@
 
 #include "core/io/pla_parser.hpp"
 
+#include "core/truthTable/bdd_truth_table.hpp"
 #include "core/truthTable/truth_table.hpp"
 
 #include <algorithm>
@@ -28,75 +29,91 @@
 
 namespace syrec {
 
-    void parsePla(TruthTable& tt, std::istream& in) {
-        std::string      line;
-        std::size_t      nInputs  = 0;
-        std::size_t      nOutputs = 0;
-        std::regex const whitespace("\\s+");
-
-        while (in.good() && getline(in, line)) {
-            trim(line);
-            line = std::regex_replace(line, whitespace, " ");
-            if ((line.empty()) || (line.rfind('#', 0) == 0) || (line.rfind(".ilb", 0) == 0) || (line.rfind(".ob", 0) == 0) || (line.rfind(".p", 0) == 0) || (line.rfind(".type ", 0) == 0)) {
-                continue;
-            }
+    namespace {
+        // the cubes are handed to the truth table as they are, it is up to the truth table how to store (and merge) them
+        template<class T>
+        void parseCubes(T& tt, std::istream& in) {
+            std::string      line;
+            std::size_t      nInputs  = 0;
+            std::size_t      nOutputs = 0;
+            std::regex const whitespace("\\s+");
+
+            while (in.good() && getline(in, line)) {
+                trim(line);
+                line = std::regex_replace(line, whitespace, " ");
+                if ((line.empty()) || (line.rfind('#', 0) == 0) || (line.rfind(".ilb", 0) == 0) || (line.rfind(".ob", 0) == 0) || (line.rfind(".p", 0) == 0) || (line.rfind(".type ", 0) == 0)) {
+                    continue;
+                }
 
-            if (line.rfind(".i", 0) == 0) {
-                nInputs = std::stoi(line.substr(3));
-                // resize the tt constants.
-                tt.getConstants().resize(nInputs);
-            }
+                if (line.rfind(".i", 0) == 0) {
+                    nInputs = std::stoi(line.substr(3));
+                    // resize the tt constants.
+                    tt.getConstants().resize(nInputs);
+                }
 
-            else if (line.rfind(".o", 0) == 0) {
-                nOutputs = std::stoi(line.substr(3));
-                // resize the tt garbage.
-                tt.getGarbage().resize(nOutputs);
-            }
+                else if (line.rfind(".o", 0) == 0) {
+                    nOutputs = std::stoi(line.substr(3));
+                    // resize the tt garbage.
+                    tt.getGarbage().resize(nOutputs);
+                }
 
-            else if (line == ".e") {
-                break;
-            }
+                else if (line == ".e") {
+                    break;
+                }
 
-            else {
-                assert((line[0] == '0' || line[0] == '1' || line[0] == '-' || line[0] == '~'));
+                else {
+                    assert((line[0] == '0' || line[0] == '1' || line[0] == '-' || line[0] == '~'));
 
-                std::vector<std::string> inputOutputMapping;
+                    std::vector<std::string> inputOutputMapping;
 
-                auto        lineString = std::stringstream(line);
-                std::string tokenString;
-                while (std::getline(lineString, tokenString, ' ')) {
-                    inputOutputMapping.emplace_back(tokenString);
-                }
+                    auto        lineString = std::stringstream(line);
+                    std::string tokenString;
+                    while (std::getline(lineString, tokenString, ' ')) {
+                        inputOutputMapping.emplace_back(tokenString);
+                    }
+                    // the rows of a table without inputs only consist of the output
+                    if (nInputs == 0U && inputOutputMapping.size() == 1U) {
+                        inputOutputMapping.insert(inputOutputMapping.begin(), std::string());
+                    }
 
-                if (inputOutputMapping.size() != 2) {
-                    throw std::invalid_argument("Expected exactly 2 columns (input and output), received " + std::to_string(inputOutputMapping.size()) + std::string(" columns"));
-                }
+                    if (inputOutputMapping.size() != 2) {
+                        throw std::invalid_argument("Expected exactly 2 columns (input and output), received " + std::to_string(inputOutputMapping.size()) + std::string(" columns"));
+                    }
 
-                if (inputOutputMapping[0].size() != nInputs) {
-                    throw std::invalid_argument(".i " + std::string("(") + std::to_string(nInputs) + std::string(")") + std::string(" not equal to received number of inputs ") + std::string("(") + std::to_string(inputOutputMapping[0].size()) + std::string(")"));
-                }
+                    if (inputOutputMapping[0].size() != nInputs) {
+                        throw std::invalid_argument(".i " + std::string("(") + std::to_string(nInputs) + std::string(")") + std::string(" not equal to received number of inputs ") + std::string("(") + std::to_string(inputOutputMapping[0].size()) + std::string(")"));
+                    }
 
-                if (inputOutputMapping[1].size() != nOutputs) {
-                    throw std::invalid_argument(".o " + std::string("(") + std::to_string(nOutputs) + std::string(")") + std::string(" not equal to received number of outputs ") + std::string("(") + std::to_string(inputOutputMapping[1].size()) + std::string(")"));
-                }
+                    if (inputOutputMapping[1].size() != nOutputs) {
+                        throw std::invalid_argument(".o " + std::string("(") + std::to_string(nOutputs) + std::string(")") + std::string(" not equal to received number of outputs ") + std::string("(") + std::to_string(inputOutputMapping[1].size()) + std::string(")"));
+                    }
 
-                TruthTable::Cube cubeIn;
-                cubeIn.reserve(nInputs);
+                    TruthTable::Cube cubeIn;
+                    cubeIn.reserve(nInputs);
 
-                for (auto s: inputOutputMapping[0]) {
-                    cubeIn.emplace_back(TruthTable::Cube::getValue(s));
-                }
+                    for (auto s: inputOutputMapping[0]) {
+                        cubeIn.emplace_back(TruthTable::Cube::getValue(s));
+                    }
 
-                TruthTable::Cube cubeOut;
-                cubeOut.reserve(nOutputs);
+                    TruthTable::Cube cubeOut;
+                    cubeOut.reserve(nOutputs);
 
-                for (auto s: inputOutputMapping[1]) {
-                    cubeOut.emplace_back(TruthTable::Cube::getValue(s));
-                }
+                    for (auto s: inputOutputMapping[1]) {
+                        cubeOut.emplace_back(TruthTable::Cube::getValue(s));
+                    }
 
-                tt.try_emplace(cubeIn, cubeOut);
+                    tt.try_emplace(cubeIn, cubeOut);
+                }
             }
         }
+    } // namespace
+
+    void parsePla(TruthTable& tt, std::istream& in) {
+        parseCubes(tt, in);
+    }
+
+    void parsePla(BddTruthTable& tt, std::istream& in) {
+        parseCubes(tt, in);
     }
 
     auto extend(TruthTable& tt) -> void {
@@ -172,4 +189,19 @@ namespace syrec {
         return true;
     }
 
+    bool readPla(BddTruthTable& tt, const std::string& filename) {
+        std::ifstream is;
+        is.open(filename.c_str(), std::ifstream::in);
+
+        if (!is.good()) {
+            std::cerr << "Cannot open " + filename << '\n';
+            return false;
+        }
+
+        // the BDDs cover the inputs not specified in the pla without extending the truth table.
+        parsePla(tt, is);
+
+        return true;
+    }
+
 } // namespace syrec
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/pla_writer.hpp"
+
+#include "core/parallel_for.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+
+    namespace {
+        constexpr std::size_t NO_CUBE = SIZE_MAX;
+
+        // The cubes of a group packed into words, cube k consists of the care words followed by the value words at [k * stride, (k + 1) * stride)
+        // with input j at bit j % 64 of word j / 64 (a value bit is zero if the input is a don't care)
+        struct PackedCubes {
+            std::size_t                nWords = 0U;
+            std::vector<std::uint64_t> words;
+
+            [[nodiscard]] std::size_t stride() const {
+                return 2U * nWords;
+            }
+
+            [[nodiscard]] std::size_t size() const {
+                return words.size() / stride();
+            }
+
+            void add(const TruthTable::Cube& input) {
+                const auto first = words.size();
+                words.resize(first + stride(), 0U);
+                for (std::size_t j = 0U; j < input.size(); ++j) {
+                    if (input[j].has_value()) {
+                        words[first + (j / 64U)] |= 1ULL << (j % 64U);
+                        if (*input[j]) {
+                            words[first + nWords + (j / 64U)] |= 1ULL << (j % 64U);
+                        }
+                    }
+                }
+            }
+
+            // hash of the cube ignoring the input
+            [[nodiscard]] std::uint64_t hashWithout(const std::size_t cube, const std::size_t input) const {
+                std::uint64_t hash = 0U;
+                for (std::size_t w = 0U; w < stride(); ++w) {
+                    auto word = words[(cube * stride()) + w];
+                    if (w % nWords == input / 64U) {
+                        word &= ~(1ULL << (input % 64U));
+                    }
+                    hash = (hash ^ word) * 0x9E3779B97F4A7C15ULL;
+                    hash ^= hash >> 29U;
+                }
+                return hash;
+            }
+
+            [[nodiscard]] bool equalWithout(const std::size_t cube1, const std::size_t cube2, const std::size_t input) const {
+                for (std::size_t w = 0U; w < stride(); ++w) {
+                    auto difference = words[(cube1 * stride()) + w] ^ words[(cube2 * stride()) + w];
+                    if (w % nWords == input / 64U) {
+                        difference &= ~(1ULL << (input % 64U));
+                    }
+                    if (difference != 0U) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+
+            [[nodiscard]] bool cares(const std::size_t cube, const std::size_t input) const {
+                return ((words[(cube * stride()) + (input / 64U)] >> (input % 64U)) & 1U) != 0U;
+            }
+
+            void makeDontCare(const std::size_t cube, const std::size_t input) {
+                words[(cube * stride()) + (input / 64U)] &= ~(1ULL << (input % 64U));
+                words[(cube * stride()) + nWords + (input / 64U)] &= ~(1ULL << (input % 64U));
+            }
+
+            void keep(const std::vector<bool>& kept) {
+                std::size_t nKept = 0U;
+                for (std::size_t cube = 0U; cube < kept.size(); ++cube) {
+                    if (kept[cube]) {
+                        std::copy_n(words.cbegin() + static_cast<std::ptrdiff_t>(cube * stride()), stride(), words.begin() + static_cast<std::ptrdiff_t>(nKept * stride()));
+                        ++nKept;
+                    }
+                }
+                words.resize(nKept * stride());
+            }
+        };
+
+        // Merge the pairs of cubes differing only in the input, returns whether a pair was merged
+        bool mergeAlong(PackedCubes& cubes, const std::size_t input, std::vector<std::size_t>& table) {
+            const auto  nCubes   = cubes.size();
+            std::size_t capacity = 1U;
+            while (capacity < 2U * nCubes) {
+                capacity <<= 1U;
+            }
+            table.assign(capacity, NO_CUBE);
+
+            std::vector<bool> kept(nCubes, true);
+            bool              merged = false;
+            for (std::size_t cube = 0U; cube < nCubes; ++cube) {
+                if (!cubes.cares(cube, input)) {
+                    continue;
+                }
+                // a merged cube does not care about the input anymore and is never merged again in this pass since the cubes are disjoint
+                for (auto slot = cubes.hashWithout(cube, input) & (capacity - 1U);; slot = (slot + 1U) & (capacity - 1U)) {
+                    if (table[slot] == NO_CUBE) {
+                        table[slot] = cube;
+                        break;
+                    }
+                    if (const auto other = table[slot]; cubes.cares(other, input) && cubes.equalWithout(other, cube, input)) {
+                        cubes.makeDontCare(other, input);
+                        kept[cube] = false;
+                        merged     = true;
+                        break;
+                    }
+                }
+            }
+            if (merged) {
+                cubes.keep(kept);
+            }
+            return merged;
+        }
+
+        void mergeCubes(PackedCubes& cubes, const std::size_t nInputs) {
+            std::vector<std::size_t> table;
+            for (bool merged = true; merged;) {
+                merged = false;
+                for (std::size_t input = 0U; input < nInputs; ++input) {
+                    merged |= mergeAlong(cubes, input, table);
+                }
+            }
+        }
+
+        // The row of a table without inputs only consists of the output
+        void appendRow(std::string& buffer, const PackedCubes& cubes, const std::size_t cube, const std::size_t nInputs, const std::string& output) {
+            for (std::size_t j = 0U; j < nInputs; ++j) {
+                if (!cubes.cares(cube, j)) {
+                    buffer += '-';
+                } else {
+                    buffer += ((cubes.words[(cube * cubes.stride()) + cubes.nWords + (j / 64U)] >> (j % 64U)) & 1U) != 0U ? '1' : '0';
+                }
+            }
+            if (nInputs != 0U) {
+                buffer += ' ';
+            }
+            buffer += output;
+            buffer += '\n';
+        }
+    } // namespace
+
+    void writePla(const TruthTable& tt, std::ostream& os, const PlaWriterSettings& settings, const Properties::ptr& statistics) {
+        const auto start = std::chrono::steady_clock::now();
+
+        const auto nInputs  = tt.nInputs();
+        const auto nOutputs = tt.nOutputs();
+
+        // the groups of the input cubes with the same output ordered by the output
+        std::map<TruthTable::Cube, std::size_t> groupOfOutput;
+        std::vector<std::string>                outputs;
+        std::vector<PackedCubes>                groups;
+        for (const auto& [input, output]: tt) {
+            if (settings.omitZeroOutputs && std::all_of(output.cbegin(), output.cend(), [](const auto& value) { return value.has_value() && !*value; })) {
+                continue;
+            }
+            const auto [it, inserted] = groupOfOutput.try_emplace(output, groups.size());
+            if (inserted) {
+                outputs.emplace_back(output.toString());
+                // a cube of a table without inputs still needs a (zero) word to be counted
+                groups.emplace_back(PackedCubes{std::max<std::size_t>((nInputs + 63U) / 64U, 1U), {}});
+            }
+            groups[it->second].add(input);
+        }
+
+        if (settings.mergeCubes) {
+            parallelFor(groups.size(), settings.nThreads, [&](const std::size_t group) { mergeCubes(groups[group], nInputs); });
+        }
+
+        std::size_t nCubes = 0U;
+        for (const auto& [output, group]: groupOfOutput) {
+            nCubes += groups[group].size();
+        }
+
+        std::string buffer = ".i " + std::to_string(nInputs) + "\n.o " + std::to_string(nOutputs) + "\n.p " + std::to_string(nCubes) + "\n";
+        buffer.reserve(settings.chunkSize + nInputs + nOutputs + 2U);
+        for (const auto& [output, group]: groupOfOutput) {
+            const auto& cubes = groups[group];
+            for (std::size_t cube = 0U; cube < cubes.size(); ++cube) {
+                appendRow(buffer, cubes, cube, nInputs, outputs[group]);
+                if (buffer.size() >= settings.chunkSize) {
+                    os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+                    buffer.clear();
+                }
+            }
+        }
+        buffer += ".e\n";
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+        if (statistics) {
+            statistics->set("input_cubes", static_cast<std::uint64_t>(tt.size()));
+            statistics->set("cubes", static_cast<std::uint64_t>(nCubes));
+            statistics->set("runtime", static_cast<double>(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()));
+        }
+    }
+
+    bool writePla(const TruthTable& tt, const std::string& filename, const PlaWriterSettings& settings, const Properties::ptr& statistics) {
+        std::ofstream os;
+        os.open(filename.c_str(), std::ofstream::out);
+
+        if (!os.good()) {
+            std::cerr << "Cannot open " + filename << '\n';
+            return false;
+        }
+
+        writePla(tt, os, settings, statistics);
+        return os.good();
+    }
+
+} // namespace syrec
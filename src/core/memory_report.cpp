@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/memory_report.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+void MemoryReport::add(const std::string& category, const std::size_t bytes, const std::size_t objects) {
+    auto& usage = categories[category];
+    usage.bytes += bytes;
+    usage.objects += objects;
+}
+
+void MemoryReport::merge(const MemoryReport& other) {
+    for (const auto& [category, usage]: other.categories) {
+        add(category, usage.bytes, usage.objects);
+    }
+    for (const auto& [phase, bytes]: other.peakBytesPerPhase) {
+        recordPhase(phase, bytes);
+    }
+}
+
+void MemoryReport::recordPhase(const std::string& phase, const std::size_t bytes) {
+    const auto it = std::find_if(peakBytesPerPhase.begin(), peakBytesPerPhase.end(), [&phase](const auto& entry) { return entry.first == phase; });
+    if (it == peakBytesPerPhase.end()) {
+        peakBytesPerPhase.emplace_back(phase, bytes);
+    } else {
+        it->second = std::max(it->second, bytes);
+    }
+}
+
+std::size_t MemoryReport::totalBytes() const {
+    std::size_t bytes = 0U;
+    for (const auto& [_, usage]: categories) {
+        bytes += usage.bytes;
+    }
+    return bytes;
+}
+
+std::size_t MemoryReport::totalObjects() const {
+    std::size_t objects = 0U;
+    for (const auto& [_, usage]: categories) {
+        objects += usage.objects;
+    }
+    return objects;
+}
+
+std::string MemoryReport::toString() const {
+    std::size_t categoryWidth = std::string("total").size();
+    for (const auto& [category, _]: categories) {
+        categoryWidth = std::max(categoryWidth, category.size());
+    }
+
+    std::stringstream ss{};
+    ss << std::left << std::setw(static_cast<int>(categoryWidth)) << "category" << std::right << std::setw(16) << "bytes" << std::setw(12) << "objects" << '\n';
+    for (const auto& [category, usage]: categories) {
+        ss << std::left << std::setw(static_cast<int>(categoryWidth)) << category << std::right << std::setw(16) << usage.bytes << std::setw(12) << usage.objects << '\n';
+    }
+    ss << std::left << std::setw(static_cast<int>(categoryWidth)) << "total" << std::right << std::setw(16) << totalBytes() << std::setw(12) << totalObjects() << '\n';
+    for (const auto& [phase, bytes]: peakBytesPerPhase) {
+        ss << "peak of phase " << phase << ": " << bytes << " bytes\n";
+    }
+    return ss.str();
+}
+
+std::size_t MemoryReport::dynamicBytes(const std::string& str) {
+    // the capacity of an empty string is the size of the buffer used for the small string optimization
+    static const std::size_t SMALL_STRING_CAPACITY = std::string().capacity();
+    return str.capacity() > SMALL_STRING_CAPACITY ? str.capacity() + 1U : 0U;
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace syrec {
+    std::size_t parallelForThreads(const std::size_t nItems, const std::size_t nThreads) {
+        const auto nHardwareThreads = static_cast<std::size_t>(std::max(std::thread::hardware_concurrency(), 1U));
+        return std::min(nThreads == 0U ? nHardwareThreads : nThreads, std::max<std::size_t>(nItems, 1U));
+    }
+
+    void parallelForPerThread(const std::size_t nItems, const std::size_t nThreads, const std::function<void(std::size_t, std::size_t)>& fn) {
+        std::atomic<std::size_t> nextItem{0U};
+        std::exception_ptr       firstException;
+        std::mutex               exceptionMutex;
+
+        const auto worker = [&](const std::size_t thread) {
+            try {
+                for (auto item = nextItem++; item < nItems; item = nextItem++) {
+                    fn(item, thread);
+                }
+            } catch (...) {
+                const std::lock_guard lock(exceptionMutex);
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+                // stop the remaining threads as early as possible
+                nextItem = nItems;
+            }
+        };
+
+        const auto               nWorkers = parallelForThreads(nItems, nThreads);
+        std::vector<std::thread> threads;
+        threads.reserve(nWorkers - 1U);
+        for (std::size_t thread = 1U; thread < nWorkers; ++thread) {
+            threads.emplace_back(worker, thread);
+        }
+        worker(0U);
+        for (auto& thread: threads) {
+            thread.join();
+        }
+        if (firstException) {
+            std::rethrow_exception(firstException);
+        }
+    }
+
+    void parallelFor(const std::size_t nItems, const std::size_t nThreads, const std::function<void(std::size_t)>& fn) {
+        parallelForPerThread(nItems, nThreads, [&fn](const std::size_t item, const std::size_t /* thread */) { fn(item); });
+    }
+} // namespace syrec
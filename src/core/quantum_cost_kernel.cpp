@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/quantum_cost_kernel.hpp"
+
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/OpType.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+using namespace syrec;
+
+namespace {
+    static_assert(QuantumCostKernel::MAX_QUBITS - 1U <= std::numeric_limits<std::uint16_t>::max(), "the number of effective controls has to fit into 16 bits");
+
+    // number of partial histograms filled in an interleaved manner, thus consecutive gates with the same number of effective controls do not increment the same counter
+    constexpr std::size_t N_LANES = 4U;
+
+    // histograms with at most this many bins count the gates per bin by vectorized comparisons instead of scattered increments
+    constexpr std::size_t MAX_VECTORIZED_BINS = 16U;
+
+    // Number of the values [begin, end) of data equal to the value
+    std::uint64_t countEqual(const std::uint16_t* data, std::size_t begin, const std::size_t end, const std::uint16_t value) {
+        std::uint64_t count = 0U;
+#if defined(__SSE2__)
+        // eight 16-bit counters are decremented by the all-ones mask of every match, they are summed up before they can overflow as signed 16-bit values
+        constexpr std::size_t N_VALUES_PER_VECTOR = 8U;
+        constexpr std::size_t MAX_VECTORS         = 32767U;
+
+        const auto values = _mm_set1_epi16(static_cast<short>(value));
+        const auto ones   = _mm_set1_epi16(1);
+        while (begin + N_VALUES_PER_VECTOR <= end) {
+            const auto nVectors = std::min((end - begin) / N_VALUES_PER_VECTOR, MAX_VECTORS);
+            auto       counters = _mm_setzero_si128();
+            for (std::size_t v = 0U; v < nVectors; ++v, begin += N_VALUES_PER_VECTOR) {
+                const auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + begin)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+                counters         = _mm_sub_epi16(counters, _mm_cmpeq_epi16(chunk, values));
+            }
+            alignas(16) std::int32_t sums[4];
+            _mm_store_si128(reinterpret_cast<__m128i*>(sums), _mm_madd_epi16(counters, ones)); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+            count += static_cast<std::uint64_t>(sums[0]) + static_cast<std::uint64_t>(sums[1]) + static_cast<std::uint64_t>(sums[2]) + static_cast<std::uint64_t>(sums[3]);
+        }
+#endif
+        for (; begin < end; ++begin) {
+            count += static_cast<std::uint64_t>(data[begin] == value);
+        }
+        return count;
+    }
+
+    // the partial histograms of the larger histograms are reused by every call of a thread
+    thread_local std::vector<std::uint64_t> lanesOfHistogram;
+} // namespace
+
+QuantumCostKernel::QuantumCostKernel(const qc::QuantumComputation& quantumComputation) {
+    const auto numQubits = quantumComputation.getNqubits();
+    if (numQubits > MAX_QUBITS) {
+        throw std::invalid_argument("The quantum cost kernel supports circuits with at most 65536 qubits");
+    }
+
+    // the table only covers the numbers of effective controls up to the largest one of a gate, thus the histograms have as few bins as possible
+    std::uint16_t maxEffectiveControls = 0U;
+    effectiveControls.reserve(quantumComputation.getNops());
+    for (const auto& op: quantumComputation) {
+        const auto c = static_cast<std::uint16_t>(std::min(op->getNcontrols() + static_cast<std::size_t>(op->getType() == qc::OpType::SWAP), std::max<std::size_t>(numQubits, 1U) - 1U));
+        effectiveControls.emplace_back(c);
+        maxEffectiveControls = std::max(maxEffectiveControls, c);
+    }
+
+    costTable.resize(static_cast<std::size_t>(maxEffectiveControls) + 1U);
+    for (std::size_t c = 0U; c < costTable.size(); ++c) {
+        costTable[c] = AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(c, qc::OpType::X, numQubits);
+    }
+}
+
+void QuantumCostKernel::checkRange(const std::size_t begin, const std::size_t end) const {
+    if (begin > end || end > getNgates()) {
+        throw std::invalid_argument("Invalid range [" + std::to_string(begin) + ", " + std::to_string(end) + ") of gates, the circuit has " + std::to_string(getNgates()) + " gates");
+    }
+}
+
+std::vector<std::uint64_t> QuantumCostKernel::histogram(const std::size_t begin, const std::size_t end) const {
+    checkRange(begin, end);
+
+    const auto                 nBins = costTable.size();
+    const auto*                data  = effectiveControls.data();
+    std::vector<std::uint64_t> counts(nBins, 0U);
+    if (nBins <= MAX_VECTORIZED_BINS) {
+        for (std::size_t bin = 0U; bin < nBins; ++bin) {
+            counts[bin] = countEqual(data, begin, end, static_cast<std::uint16_t>(bin));
+        }
+        return counts;
+    }
+
+    auto& lanes = lanesOfHistogram;
+    lanes.assign(N_LANES * nBins, 0U);
+
+    auto i = begin;
+    for (; i + N_LANES <= end; i += N_LANES) {
+        ++lanes[data[i]];
+        ++lanes[nBins + data[i + 1U]];
+        ++lanes[(2U * nBins) + data[i + 2U]];
+        ++lanes[(3U * nBins) + data[i + 3U]];
+    }
+    for (; i < end; ++i) {
+        ++lanes[data[i]];
+    }
+
+    for (std::size_t lane = 0U; lane < N_LANES; ++lane) {
+        for (std::size_t bin = 0U; bin < nBins; ++bin) {
+            counts[bin] += lanes[(lane * nBins) + bin];
+        }
+    }
+    return counts;
+}
+
+QuantumCostKernel::Cost QuantumCostKernel::cost(const std::size_t begin, const std::size_t end) const {
+    checkRange(begin, end);
+
+    Cost cost = 0U;
+    // the histogram only pays off if the range is large compared to the number of its bins
+    if (end - begin < N_LANES * costTable.size()) {
+        for (auto i = begin; i < end; ++i) {
+            cost += costTable[effectiveControls[i]];
+        }
+        return cost;
+    }
+
+    if (costTable.size() <= MAX_VECTORIZED_BINS) {
+        for (std::size_t c = 0U; c < costTable.size(); ++c) {
+            cost += countEqual(effectiveControls.data(), begin, end, static_cast<std::uint16_t>(c)) * costTable[c];
+        }
+        return cost;
+    }
+
+    const auto counts = histogram(begin, end);
+    for (std::size_t c = 0U; c < counts.size(); ++c) {
+        cost += counts[c] * costTable[c];
+    }
+    return cost;
+}
+
+std::vector<QuantumCostKernel::Cost> QuantumCostKernel::costPerGroup(const std::vector<std::uint32_t>& groupOfGate, const std::size_t nGroups) const {
+    if (groupOfGate.size() != getNgates()) {
+        throw std::invalid_argument("Expected a group for each of the " + std::to_string(getNgates()) + " gates but got " + std::to_string(groupOfGate.size()));
+    }
+    if (std::any_of(groupOfGate.cbegin(), groupOfGate.cend(), [nGroups](const std::uint32_t group) { return group >= nGroups; })) {
+        throw std::invalid_argument("The group of a gate has to be smaller than the number of groups (" + std::to_string(nGroups) + ")");
+    }
+
+    std::vector<Cost> costs(nGroups, 0U);
+    for (std::size_t i = 0U; i < groupOfGate.size(); ++i) {
+        costs[groupOfGate[i]] += costTable[effectiveControls[i]];
+    }
+    return costs;
+}
+
+std::map<std::string, QuantumCostKernel::Cost> QuantumCostKernel::costPerAnnotation(const AnnotatableQuantumComputation& quantumComputation, const std::string_view annotationKey) const {
+    if (quantumComputation.getNops() != getNgates()) {
+        throw std::invalid_argument("The circuit has " + std::to_string(quantumComputation.getNops()) + " gates but the kernel was built for " + std::to_string(getNgates()) + " gates");
+    }
+
+    std::map<std::string, std::uint32_t> groupOfValue;
+    std::vector<std::string>             values;
+    std::vector<std::uint32_t>           groupOfGate;
+    groupOfGate.reserve(getNgates());
+    for (std::size_t i = 0U; i < getNgates(); ++i) {
+        const auto  annotations = quantumComputation.getAnnotationsOfQuantumOperation(i);
+        const auto  it          = annotations.find(annotationKey);
+        std::string value       = it != annotations.cend() ? it->second : std::string();
+
+        const auto [group, inserted] = groupOfValue.try_emplace(value, static_cast<std::uint32_t>(values.size()));
+        if (inserted) {
+            values.emplace_back(std::move(value));
+        }
+        groupOfGate.emplace_back(group->second);
+    }
+
+    const auto                  costs = costPerGroup(groupOfGate, values.size());
+    std::map<std::string, Cost> costPerValue;
+    for (std::size_t group = 0U; group < values.size(); ++group) {
+        costPerValue.emplace(values[group], costs[group]);
+    }
+    return costPerValue;
+}
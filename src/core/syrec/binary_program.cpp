@@ -0,0 +1,722 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/binary_program.hpp"
+
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace syrec {
+
+    namespace {
+        constexpr char          MAGIC[]        = "SYRECIR";
+        constexpr std::size_t   MAGIC_SIZE     = sizeof(MAGIC) - 1U;
+        constexpr std::uint8_t  FORMAT_VERSION = 2U;
+        constexpr std::size_t   HEADER_SIZE    = MAGIC_SIZE + 1U + sizeof(std::uint64_t);
+        constexpr std::uint64_t FNV_OFFSET     = 14695981039346656037ULL;
+        constexpr std::uint64_t FNV_PRIME      = 1099511628211ULL;
+
+        enum class NodeTag : std::uint8_t {
+            ModuleDeclaration,
+            ConstantNumber,
+            LoopVariableNumber,
+            Variable,
+            VariableAccess,
+            NumericExpression,
+            VariableExpression,
+            BinaryExpression,
+            ShiftExpression,
+            SkipStatement,
+            SwapStatement,
+            UnaryStatement,
+            AssignStatement,
+            IfStatement,
+            ForStatement,
+            CallStatement,
+            UncallStatement,
+            ModuleDefinition
+        };
+
+        // a module is declared (by its name) before it is referenced by a call statement and defined (parameters, variables and statements) after all of its children
+        class BinaryWriter {
+        public:
+            std::string write(const Program& program, const std::uint64_t hash) {
+                for (const auto& module: program.modules()) {
+                    declare(module);
+                }
+                // the list of declared modules grows while defining the modules if a module calls a module which is not part of the program
+                for (std::size_t i = 0U; i < declaredModules.size(); ++i) {
+                    define(declaredModules[i]);
+                }
+
+                std::string programSection;
+                appendVarint(programSection, program.modules().size());
+                for (const auto& module: program.modules()) {
+                    appendVarint(programSection, reference(module));
+                }
+
+                std::string result(MAGIC, MAGIC_SIZE);
+                result.push_back(static_cast<char>(FORMAT_VERSION));
+                for (std::size_t i = 0U; i < sizeof(std::uint64_t); ++i) {
+                    result.push_back(static_cast<char>((hash >> (8U * i)) & 0xFFU));
+                }
+                appendVarint(result, strings.size());
+                for (const auto& str: strings) {
+                    appendVarint(result, str.size());
+                    result += str;
+                }
+                appendVarint(result, nNodes);
+                result += nodes;
+                result += programSection;
+                return result;
+            }
+
+        private:
+            std::string                                  nodes;
+            std::size_t                                  nNodes = 0U;
+            std::unordered_map<const void*, std::size_t> nodeIndices;
+            std::vector<std::string>                     strings;
+            std::unordered_map<std::string, std::size_t> stringIndices;
+            Module::vec                                  declaredModules;
+
+            static void appendVarint(std::string& buffer, std::uint64_t value) {
+                while (value >= 0x80U) {
+                    buffer.push_back(static_cast<char>((value & 0x7FU) | 0x80U));
+                    value >>= 7U;
+                }
+                buffer.push_back(static_cast<char>(value));
+            }
+
+            void varint(const std::uint64_t value) {
+                appendVarint(nodes, value);
+            }
+
+            void string(const std::string& str) {
+                const auto [it, inserted] = stringIndices.try_emplace(str, strings.size());
+                if (inserted) {
+                    strings.emplace_back(str);
+                }
+                varint(it->second);
+            }
+
+            // references are shifted by one such that zero encodes a null pointer
+            template<typename T>
+            [[nodiscard]] std::size_t reference(const std::shared_ptr<T>& node) const {
+                return node == nullptr ? 0U : nodeIndices.at(node.get()) + 1U;
+            }
+
+            template<typename T>
+            void ref(const std::shared_ptr<T>& node) {
+                varint(reference(node));
+            }
+
+            template<typename T>
+            [[nodiscard]] bool visited(const std::shared_ptr<T>& node) const {
+                return node == nullptr || nodeIndices.find(node.get()) != nodeIndices.end();
+            }
+
+            template<typename T>
+            void begin(const std::shared_ptr<T>& node, const NodeTag tag) {
+                nodeIndices.emplace(node.get(), nNodes++);
+                nodes.push_back(static_cast<char>(tag));
+            }
+
+            void declare(const Module::ptr& module) {
+                if (visited(module)) {
+                    return;
+                }
+                begin(module, NodeTag::ModuleDeclaration);
+                string(module->name);
+                declaredModules.emplace_back(module);
+            }
+
+            void define(const Module::ptr& module) {
+                for (const auto& parameter: module->parameters) {
+                    add(parameter);
+                }
+                for (const auto& variable: module->variables) {
+                    add(variable);
+                }
+                add(module->statements);
+
+                nodes.push_back(static_cast<char>(NodeTag::ModuleDefinition));
+                ++nNodes;
+                ref(module);
+                refs(module->parameters);
+                refs(module->variables);
+                refs(module->statements);
+            }
+
+            template<typename T>
+            void refs(const std::vector<T>& vec) {
+                varint(vec.size());
+                for (const auto& node: vec) {
+                    ref(node);
+                }
+            }
+
+            void add(const Number::ptr& number) {
+                if (visited(number)) {
+                    return;
+                }
+                if (number->isLoopVariable()) {
+                    begin(number, NodeTag::LoopVariableNumber);
+                    string(number->variableName());
+                } else {
+                    begin(number, NodeTag::ConstantNumber);
+                    varint(number->evaluate({}));
+                }
+            }
+
+            void add(const Variable::ptr& variable) {
+                if (visited(variable)) {
+                    return;
+                }
+                add(variable->reference);
+
+                begin(variable, NodeTag::Variable);
+                varint(variable->type);
+                string(variable->name);
+                varint(variable->dimensions.size());
+                for (const auto dimension: variable->dimensions) {
+                    varint(dimension);
+                }
+                varint(variable->bitwidth);
+                ref(variable->reference);
+            }
+
+            void add(const VariableAccess::ptr& variableAccess) {
+                if (visited(variableAccess)) {
+                    return;
+                }
+                add(variableAccess->var);
+                if (variableAccess->range.has_value()) {
+                    add(variableAccess->range->first);
+                    add(variableAccess->range->second);
+                }
+                for (const auto& index: variableAccess->indexes) {
+                    add(index);
+                }
+
+                begin(variableAccess, NodeTag::VariableAccess);
+                ref(variableAccess->var);
+                varint(variableAccess->range.has_value() ? 1U : 0U);
+                if (variableAccess->range.has_value()) {
+                    ref(variableAccess->range->first);
+                    ref(variableAccess->range->second);
+                }
+                refs(variableAccess->indexes);
+            }
+
+            void add(const Expression::ptr& expression) {
+                if (visited(expression)) {
+                    return;
+                }
+
+                if (auto const* numeric = dynamic_cast<NumericExpression*>(expression.get())) {
+                    add(numeric->value);
+                    begin(expression, NodeTag::NumericExpression);
+                    ref(numeric->value);
+                    varint(numeric->bwidth);
+                } else if (auto const* variable = dynamic_cast<VariableExpression*>(expression.get())) {
+                    add(variable->var);
+                    begin(expression, NodeTag::VariableExpression);
+                    ref(variable->var);
+                } else if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
+                    add(binary->lhs);
+                    add(binary->rhs);
+                    begin(expression, NodeTag::BinaryExpression);
+                    ref(binary->lhs);
+                    varint(binary->op);
+                    ref(binary->rhs);
+                } else if (auto const* shift = dynamic_cast<ShiftExpression*>(expression.get())) {
+                    add(shift->lhs);
+                    add(shift->rhs);
+                    begin(expression, NodeTag::ShiftExpression);
+                    ref(shift->lhs);
+                    varint(shift->op);
+                    ref(shift->rhs);
+                } else {
+                    throw std::invalid_argument("Unsupported expression");
+                }
+            }
+
+            void add(const Statement::vec& statements) {
+                for (const auto& statement: statements) {
+                    add(statement);
+                }
+            }
+
+            void add(const Statement::ptr& statement) {
+                if (visited(statement)) {
+                    return;
+                }
+
+                if (auto const* swapStat = dynamic_cast<SwapStatement*>(statement.get())) {
+                    add(swapStat->lhs);
+                    add(swapStat->rhs);
+                    begin(statement, NodeTag::SwapStatement);
+                    varint(statement->lineNumber);
+                    ref(swapStat->lhs);
+                    ref(swapStat->rhs);
+                } else if (auto const* unaryStat = dynamic_cast<UnaryStatement*>(statement.get())) {
+                    add(unaryStat->var);
+                    begin(statement, NodeTag::UnaryStatement);
+                    varint(statement->lineNumber);
+                    varint(unaryStat->op);
+                    ref(unaryStat->var);
+                } else if (auto const* assignStat = dynamic_cast<AssignStatement*>(statement.get())) {
+                    add(assignStat->lhs);
+                    add(assignStat->rhs);
+                    begin(statement, NodeTag::AssignStatement);
+                    varint(statement->lineNumber);
+                    ref(assignStat->lhs);
+                    varint(assignStat->op);
+                    ref(assignStat->rhs);
+                } else if (auto const* ifStat = dynamic_cast<IfStatement*>(statement.get())) {
+                    add(ifStat->condition);
+                    add(ifStat->thenStatements);
+                    add(ifStat->elseStatements);
+                    add(ifStat->fiCondition);
+                    begin(statement, NodeTag::IfStatement);
+                    varint(statement->lineNumber);
+                    ref(ifStat->condition);
+                    refs(ifStat->thenStatements);
+                    refs(ifStat->elseStatements);
+                    ref(ifStat->fiCondition);
+                } else if (auto const* forStat = dynamic_cast<ForStatement*>(statement.get())) {
+                    add(forStat->range.first);
+                    add(forStat->range.second);
+                    add(forStat->step);
+                    add(forStat->statements);
+                    begin(statement, NodeTag::ForStatement);
+                    varint(statement->lineNumber);
+                    string(forStat->loopVariable);
+                    ref(forStat->range.first);
+                    ref(forStat->range.second);
+                    ref(forStat->step);
+                    refs(forStat->statements);
+                } else if (auto const* callStat = dynamic_cast<CallStatement*>(statement.get())) {
+                    declare(callStat->target);
+                    begin(statement, NodeTag::CallStatement);
+                    varint(statement->lineNumber);
+                    ref(callStat->target);
+                    parameters(callStat->parameters);
+                } else if (auto const* uncallStat = dynamic_cast<UncallStatement*>(statement.get())) {
+                    declare(uncallStat->target);
+                    begin(statement, NodeTag::UncallStatement);
+                    varint(statement->lineNumber);
+                    ref(uncallStat->target);
+                    parameters(uncallStat->parameters);
+                } else if (typeid(*statement) == typeid(SkipStatement)) {
+                    begin(statement, NodeTag::SkipStatement);
+                    varint(statement->lineNumber);
+                } else {
+                    throw std::invalid_argument("Unsupported statement");
+                }
+            }
+
+            void parameters(const std::vector<std::string>& params) {
+                varint(params.size());
+                for (const auto& parameter: params) {
+                    string(parameter);
+                }
+            }
+        };
+
+        class BinaryReader {
+        public:
+            explicit BinaryReader(const std::string& buffer):
+                buffer(buffer) {}
+
+            [[nodiscard]] std::uint64_t readHeader() {
+                if (buffer.size() < HEADER_SIZE || buffer.compare(0U, MAGIC_SIZE, MAGIC) != 0) {
+                    throw std::invalid_argument("not a binary SyReC program");
+                }
+                position = MAGIC_SIZE;
+                if (const auto version = static_cast<std::uint8_t>(buffer[position++]); version != FORMAT_VERSION) {
+                    throw std::invalid_argument("unsupported format version " + std::to_string(version));
+                }
+                std::uint64_t hash = 0U;
+                for (std::size_t i = 0U; i < sizeof(std::uint64_t); ++i) {
+                    hash |= static_cast<std::uint64_t>(static_cast<unsigned char>(buffer[position++])) << (8U * i);
+                }
+                return hash;
+            }
+
+            Module::vec read() {
+                const auto nStrings = count();
+                strings.reserve(nStrings);
+                for (std::size_t i = 0U; i < nStrings; ++i) {
+                    const auto length = count();
+                    strings.emplace_back(buffer, position, length);
+                    position += length;
+                }
+
+                const auto nNodes = count();
+                nodes.reserve(nNodes);
+                for (std::size_t i = 0U; i < nNodes; ++i) {
+                    readNode();
+                }
+
+                Module::vec modules(count());
+                for (auto& module: modules) {
+                    module = ref<Module::ptr>(false);
+                }
+                if (position != buffer.size()) {
+                    throw std::invalid_argument("unexpected data at the end of the file");
+                }
+                return modules;
+            }
+
+        private:
+            using Node = std::variant<std::monostate, Module::ptr, Number::ptr, Variable::ptr, VariableAccess::ptr, Expression::ptr, Statement::ptr>;
+
+            const std::string&       buffer;
+            std::size_t              position = 0U;
+            std::vector<std::string> strings;
+            std::vector<Node>        nodes;
+
+            [[nodiscard]] std::uint64_t varint() {
+                std::uint64_t value = 0U;
+                for (unsigned shift = 0U; shift < 64U; shift += 7U) {
+                    if (position >= buffer.size()) {
+                        throw std::invalid_argument("unexpected end of file");
+                    }
+                    const auto byte = static_cast<unsigned char>(buffer[position++]);
+                    value |= static_cast<std::uint64_t>(byte & 0x7FU) << shift;
+                    if ((byte & 0x80U) == 0U) {
+                        return value;
+                    }
+                }
+                throw std::invalid_argument("malformed integer");
+            }
+
+            [[nodiscard]] unsigned value() {
+                const auto v = varint();
+                if (v > std::numeric_limits<unsigned>::max()) {
+                    throw std::invalid_argument("integer out of range");
+                }
+                return static_cast<unsigned>(v);
+            }
+
+            // every element of a list occupies at least one byte, thus larger counts are rejected before allocating any memory
+            [[nodiscard]] std::size_t count() {
+                const auto n = varint();
+                if (n > buffer.size() - position) {
+                    throw std::invalid_argument("unexpected end of file");
+                }
+                return static_cast<std::size_t>(n);
+            }
+
+            [[nodiscard]] const std::string& string() {
+                const auto index = varint();
+                if (index >= strings.size()) {
+                    throw std::invalid_argument("invalid string reference");
+                }
+                return strings[static_cast<std::size_t>(index)];
+            }
+
+            // only nodes preceding the current one can be referenced
+            template<typename T>
+            [[nodiscard]] T ref(const bool nullable = true) {
+                const auto index = varint();
+                if (index == 0U) {
+                    if (!nullable) {
+                        throw std::invalid_argument("missing node reference");
+                    }
+                    return nullptr;
+                }
+                if (index > nodes.size()) {
+                    throw std::invalid_argument("invalid node reference");
+                }
+                auto const* node = std::get_if<T>(&nodes[static_cast<std::size_t>(index - 1U)]);
+                if (node == nullptr) {
+                    throw std::invalid_argument("node reference of unexpected kind");
+                }
+                return *node;
+            }
+
+            template<typename T>
+            [[nodiscard]] std::vector<T> refs() {
+                std::vector<T> vec(count());
+                for (auto& node: vec) {
+                    node = ref<T>(false);
+                }
+                return vec;
+            }
+
+            [[nodiscard]] std::vector<std::string> parameters() {
+                std::vector<std::string> params(count());
+                for (auto& parameter: params) {
+                    parameter = string();
+                }
+                return params;
+            }
+
+            template<typename T>
+            [[nodiscard]] static Statement::ptr withLineNumber(std::shared_ptr<T> statement, const unsigned lineNumber) {
+                statement->lineNumber = lineNumber;
+                return statement;
+            }
+
+            void readNode() {
+                if (position >= buffer.size()) {
+                    throw std::invalid_argument("unexpected end of file");
+                }
+
+                switch (static_cast<NodeTag>(buffer[position++])) {
+                    case NodeTag::ModuleDeclaration:
+                        nodes.emplace_back(std::make_shared<Module>(string()));
+                        break;
+                    case NodeTag::ConstantNumber:
+                        nodes.emplace_back(std::make_shared<Number>(value()));
+                        break;
+                    case NodeTag::LoopVariableNumber:
+                        nodes.emplace_back(std::make_shared<Number>(string()));
+                        break;
+                    case NodeTag::Variable: {
+                        const auto            type = value();
+                        const auto&           name = string();
+                        std::vector<unsigned> dimensions(count());
+                        for (auto& dimension: dimensions) {
+                            dimension = value();
+                        }
+                        const auto bitwidth = value();
+                        auto       variable = std::make_shared<Variable>(type, name, std::move(dimensions), bitwidth);
+                        variable->setReference(ref<Variable::ptr>());
+                        nodes.emplace_back(std::move(variable));
+                        break;
+                    }
+                    case NodeTag::VariableAccess: {
+                        auto variableAccess = std::make_shared<VariableAccess>();
+                        variableAccess->setVar(ref<Variable::ptr>(false));
+                        if (varint() != 0U) {
+                            auto first            = ref<Number::ptr>(false);
+                            variableAccess->range = std::make_pair(std::move(first), ref<Number::ptr>(false));
+                        }
+                        variableAccess->indexes = refs<Expression::ptr>();
+                        nodes.emplace_back(std::move(variableAccess));
+                        break;
+                    }
+                    case NodeTag::NumericExpression: {
+                        auto numberValue = ref<Number::ptr>(false);
+                        nodes.emplace_back(Expression::ptr(std::make_shared<NumericExpression>(std::move(numberValue), value())));
+                        break;
+                    }
+                    case NodeTag::VariableExpression:
+                        nodes.emplace_back(Expression::ptr(std::make_shared<VariableExpression>(ref<VariableAccess::ptr>(false))));
+                        break;
+                    case NodeTag::BinaryExpression: {
+                        auto       lhs = ref<Expression::ptr>(false);
+                        const auto op  = value();
+                        nodes.emplace_back(Expression::ptr(std::make_shared<BinaryExpression>(std::move(lhs), op, ref<Expression::ptr>(false))));
+                        break;
+                    }
+                    case NodeTag::ShiftExpression: {
+                        auto       lhs = ref<Expression::ptr>(false);
+                        const auto op  = value();
+                        nodes.emplace_back(Expression::ptr(std::make_shared<ShiftExpression>(std::move(lhs), op, ref<Number::ptr>(false))));
+                        break;
+                    }
+                    case NodeTag::SkipStatement:
+                        nodes.emplace_back(withLineNumber(std::make_shared<SkipStatement>(), value()));
+                        break;
+                    case NodeTag::SwapStatement: {
+                        const auto lineNumber = value();
+                        auto       lhs        = ref<VariableAccess::ptr>(false);
+                        nodes.emplace_back(withLineNumber(std::make_shared<SwapStatement>(std::move(lhs), ref<VariableAccess::ptr>(false)), lineNumber));
+                        break;
+                    }
+                    case NodeTag::UnaryStatement: {
+                        const auto lineNumber = value();
+                        const auto op         = value();
+                        nodes.emplace_back(withLineNumber(std::make_shared<UnaryStatement>(op, ref<VariableAccess::ptr>(false)), lineNumber));
+                        break;
+                    }
+                    case NodeTag::AssignStatement: {
+                        const auto lineNumber = value();
+                        auto       lhs        = ref<VariableAccess::ptr>(false);
+                        const auto op         = value();
+                        nodes.emplace_back(withLineNumber(std::make_shared<AssignStatement>(std::move(lhs), op, ref<Expression::ptr>(false)), lineNumber));
+                        break;
+                    }
+                    case NodeTag::IfStatement: {
+                        auto ifStat        = std::make_shared<IfStatement>();
+                        ifStat->lineNumber = value();
+                        ifStat->setCondition(ref<Expression::ptr>());
+                        ifStat->thenStatements = refs<Statement::ptr>();
+                        ifStat->elseStatements = refs<Statement::ptr>();
+                        ifStat->setFiCondition(ref<Expression::ptr>());
+                        nodes.emplace_back(Statement::ptr(std::move(ifStat)));
+                        break;
+                    }
+                    case NodeTag::ForStatement: {
+                        auto forStat          = std::make_shared<ForStatement>();
+                        forStat->lineNumber   = value();
+                        forStat->loopVariable = string();
+                        auto first            = ref<Number::ptr>();
+                        forStat->range        = std::make_pair(std::move(first), ref<Number::ptr>());
+                        forStat->step         = ref<Number::ptr>();
+                        forStat->statements   = refs<Statement::ptr>();
+                        nodes.emplace_back(Statement::ptr(std::move(forStat)));
+                        break;
+                    }
+                    case NodeTag::CallStatement: {
+                        const auto lineNumber = value();
+                        auto       target     = ref<Module::ptr>(false);
+                        nodes.emplace_back(withLineNumber(std::make_shared<CallStatement>(std::move(target), parameters()), lineNumber));
+                        break;
+                    }
+                    case NodeTag::UncallStatement: {
+                        const auto lineNumber = value();
+                        auto       target     = ref<Module::ptr>(false);
+                        nodes.emplace_back(withLineNumber(std::make_shared<UncallStatement>(std::move(target), parameters()), lineNumber));
+                        break;
+                    }
+                    case NodeTag::ModuleDefinition: {
+                        const auto module = ref<Module::ptr>(false);
+                        if (!module->parameters.empty() || !module->variables.empty() || !module->statements.empty()) {
+                            throw std::invalid_argument("module " + module->name + " is defined twice");
+                        }
+                        module->parameters = refs<Variable::ptr>();
+                        module->variables  = refs<Variable::ptr>();
+                        module->statements = refs<Statement::ptr>();
+                        // the definition is not referenced by any other node
+                        nodes.emplace_back(std::monostate{});
+                        break;
+                    }
+                    default:
+                        throw std::invalid_argument("unknown node kind");
+                }
+            }
+        };
+    } // namespace
+
+    std::uint64_t sourceHash(const std::string& content, const ReadProgramSettings& settings) {
+        // 64-bit FNV-1a
+        std::uint64_t hash      = FNV_OFFSET;
+        const auto    hashBytes = [&hash](const auto begin, const auto end) {
+            for (auto it = begin; it != end; ++it) {
+                hash ^= static_cast<unsigned char>(*it);
+                hash *= FNV_PRIME;
+            }
+        };
+        hashBytes(content.cbegin(), content.cend());
+
+        std::string bitwidth;
+        for (std::size_t i = 0U; i < sizeof(settings.defaultBitwidth); ++i) {
+            bitwidth.push_back(static_cast<char>((settings.defaultBitwidth >> (8U * i)) & 0xFFU));
+        }
+        hashBytes(bitwidth.cbegin(), bitwidth.cend());
+
+        // the lazy loading only keeps the modules reachable from its main module, the hash of other programs is not affected
+        if (settings.lazyLoading) {
+            const std::string mainModule = "lazy:" + settings.mainModule;
+            hashBytes(mainModule.cbegin(), mainModule.cend());
+        }
+        return hash;
+    }
+
+    bool writeBinaryProgram(const Program& program, const std::uint64_t hash, std::ostream& os) {
+        std::string binary;
+        try {
+            binary = BinaryWriter().write(program, hash);
+        } catch (const std::invalid_argument& e) {
+            std::cerr << "Cannot serialize program: " << e.what() << '\n';
+            return false;
+        }
+        os.write(binary.data(), static_cast<std::streamsize>(binary.size()));
+        return os.good();
+    }
+
+    bool writeBinaryProgram(const Program& program, const std::uint64_t hash, const std::string& filename) {
+        std::ofstream os(filename, std::ios::out | std::ios::binary);
+        if (!os.good()) {
+            std::cerr << "Cannot open " << filename << '\n';
+            return false;
+        }
+        return writeBinaryProgram(program, hash, os);
+    }
+
+    std::string readBinaryProgram(Program& program, std::istream& is, const std::optional<std::uint64_t> expectedHash) {
+        const std::string buffer{std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>()};
+
+        try {
+            BinaryReader reader(buffer);
+            if (const auto hash = reader.readHeader(); expectedHash.has_value() && hash != *expectedHash) {
+                return "Binary program is outdated: the source has changed since it was written";
+            }
+            for (const auto& module: reader.read()) {
+                program.addModule(module);
+            }
+        } catch (const std::invalid_argument& e) {
+            return std::string("Invalid binary program: ") + e.what();
+        }
+        return {};
+    }
+
+    std::string readBinaryProgram(Program& program, const std::string& filename, const std::optional<std::uint64_t> expectedHash) {
+        std::ifstream is(filename, std::ios::in | std::ios::binary);
+        if (!is.good()) {
+            return "Cannot open " + filename;
+        }
+        return readBinaryProgram(program, is, expectedHash);
+    }
+
+    std::string readProgramWithCache(Program& program, const std::string& sourceFilename, const std::string& cacheFilename, const ReadProgramSettings settings) {
+        std::ifstream source(sourceFilename, std::ios::in | std::ios::binary);
+        if (!source.good()) {
+            return program.read(sourceFilename, settings);
+        }
+        std::stringstream content;
+        content << source.rdbuf();
+        const auto hash = sourceHash(content.str(), settings);
+
+        if (readBinaryProgram(program, cacheFilename, hash).empty()) {
+            if (settings.lazyLoading) {
+                program.setMainModule(settings.mainModule);
+            }
+            return {};
+        }
+
+        if (auto errorMessage = program.read(sourceFilename, settings); !errorMessage.empty()) {
+            return errorMessage;
+        }
+        // the cache is an optimization only, thus a failure to write it is not an error
+        std::ofstream os(cacheFilename, std::ios::out | std::ios::binary);
+        if (os.good()) {
+            writeBinaryProgram(program, hash, os);
+        }
+        return {};
+    }
+
+} // namespace syrec
@@ -10,6 +10,7 @@
 
 #include "core/syrec/parser.hpp"
 
+#include "core/parallel_for.hpp"
 #include "core/syrec/expression.hpp"
 #include "core/syrec/grammar.hpp"
 #include "core/syrec/module.hpp"
@@ -20,13 +21,19 @@
 #include <algorithm>
 #include <boost/fusion/sequence/intrinsic/at.hpp>
 #include <boost/variant/detail/apply_visitor_unary.hpp>
+#include <boost/variant/get.hpp>
 #include <boost/variant/recursive_wrapper.hpp>
 #include <cassert>
+#include <cctype>
+#include <cstddef>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -584,7 +591,7 @@ namespace syrec {
 
         Statement::ptr operator()(const ast_call_statement& astCallStat) const {
             const auto& procName  = boost::fusion::at_c<1>(astCallStat);
-            const auto& otherProc = prog.findModule(procName);
+            const auto& otherProc = context.findModule ? context.findModule(procName) : prog.findModule(procName);
 
             // found no module
             if (!static_cast<bool>(otherProc.get())) {
@@ -637,7 +644,7 @@ namespace syrec {
 
     Statement::ptr parseStatement(const ast_statement& astStat, const Program& prog, const Module& proc, ParserContext& context) {
         if (auto stat = boost::apply_visitor(StatementVisitor(prog, proc, context), boost::fusion::at_c<1>(astStat))) {
-            context.currentLineNumber = static_cast<unsigned>(std::count(context.begin, boost::fusion::at_c<0>(astStat), '\n')) + 1U;
+            context.currentLineNumber = context.lineNumberOffset + static_cast<unsigned>(std::count(context.begin, boost::fusion::at_c<0>(astStat), '\n')) + 1U;
             stat->lineNumber          = context.currentLineNumber;
             return {stat};
         }
@@ -665,38 +672,339 @@ namespace syrec {
         return 0U;
     }
 
-    bool parseModule(Module& proc, const ast_module& astProc, const Program& prog, ParserContext& context) {
-        std::set<std::string> variableNames;
+    namespace {
+        bool parseModuleParameters(Module& proc, const ast_module& astProc, ParserContext& context) {
+            std::set<std::string> variableNames;
+
+            for (const ast_parameter& astParam: boost::fusion::at_c<1>(astProc)) {
+                const std::string& variableName = boost::fusion::at_c<0>(boost::fusion::at_c<1>(astParam));
+
+                if (variableNames.find(variableName) != variableNames.end()) {
+                    context.errorMessage = "Redefinition of variable " + variableName;
+                    return false;
+                }
+                variableNames.emplace(variableName);
+
+                const auto& type = parseVariableType(boost::fusion::at_c<0>(astParam));
+                proc.addParameter(std::make_shared<Variable>(
+                        type,
+                        variableName,
+                        boost::fusion::at_c<1>(boost::fusion::at_c<1>(astParam)),
+                        boost::fusion::at_c<2>(boost::fusion::at_c<1>(astParam)).get_value_or(context.settings.defaultBitwidth)));
+            }
 
-        for (const ast_parameter& astParam: boost::fusion::at_c<1>(astProc)) {
-            const std::string& variableName = boost::fusion::at_c<0>(boost::fusion::at_c<1>(astParam));
+            // state and wire variables share the namespace of the parameters
+            for (const ast_variable_declarations& astDeclarations: boost::fusion::at_c<2>(astProc)) {
+                const auto& type = parseVariableType(boost::fusion::at_c<0>(astDeclarations));
+                for (const ast_variable_declaration& astDeclaration: boost::fusion::at_c<1>(astDeclarations)) {
+                    const std::string& variableName = boost::fusion::at_c<0>(astDeclaration);
+
+                    if (variableNames.find(variableName) != variableNames.end()) {
+                        context.errorMessage = "Redefinition of variable " + variableName;
+                        return false;
+                    }
+                    variableNames.emplace(variableName);
+
+                    proc.addVariable(std::make_shared<Variable>(
+                            type,
+                            variableName,
+                            boost::fusion::at_c<1>(astDeclaration),
+                            boost::fusion::at_c<2>(astDeclaration).get_value_or(context.settings.defaultBitwidth)));
+                }
+            }
+            return true;
+        }
+
+        bool parseModuleStatements(Module& proc, const ast_module& astProc, const Program& prog, ParserContext& context) {
+            for (const ast_statement& astStat: boost::fusion::at_c<3>(astProc)) {
+                const auto& stat = parseStatement(astStat, prog, proc, context);
+                if (!stat) {
+                    return false;
+                }
+                proc.addStatement(stat);
+            }
+            return true;
+        }
+
+        bool isIdentifierCharacter(const char c) {
+            return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_';
+        }
 
-            if (variableNames.find(variableName) != variableNames.end()) {
-                context.errorMessage = "Redefinition of variable " + variableName;
+        // Positions of the module keywords, i.e. of every occurrence of "module" outside of comments which does not continue an identifier
+        std::vector<std::size_t> findModuleKeywords(const std::string& content) {
+            constexpr std::string_view keyword = "module";
+
+            std::vector<std::size_t> starts;
+            for (std::size_t i = 0U; i < content.size();) {
+                if (content.compare(i, 2U, "//") == 0) {
+                    const auto endOfLine = content.find('\n', i);
+                    i                    = endOfLine == std::string::npos ? content.size() : endOfLine + 1U;
+                } else if (content.compare(i, 2U, "/*") == 0) {
+                    const auto endOfComment = content.find("*/", i + 2U);
+                    i                       = endOfComment == std::string::npos ? content.size() : endOfComment + 2U;
+                } else if (content.compare(i, keyword.size(), keyword) == 0 && (i == 0U || !isIdentifierCharacter(content[i - 1U]))) {
+                    starts.emplace_back(i);
+                    i += keyword.size();
+                } else {
+                    ++i;
+                }
+            }
+            return starts;
+        }
+
+        // Splits the source in front of every module keyword, the first part additionally contains everything in front of the first module keyword
+        std::vector<std::pair<ast_iterator, ast_iterator>> splitAtModules(const std::string& content, const std::vector<std::size_t>& starts) {
+            std::vector<std::pair<ast_iterator, ast_iterator>> parts;
+            for (std::size_t i = 0U; i < starts.size(); ++i) {
+                const auto begin = content.cbegin() + static_cast<std::ptrdiff_t>(i == 0U ? 0U : starts[i]);
+                const auto end   = i + 1U < starts.size() ? content.cbegin() + static_cast<std::ptrdiff_t>(starts[i + 1U]) : content.cend();
+                parts.emplace_back(begin, end);
+            }
+            return parts;
+        }
+
+        // Name following the module keyword at position start, skipping what SyrecSkipParser skips. Empty if the keyword is not followed by an identifier.
+        std::string moduleNameAfterKeyword(const std::string& content, std::size_t start) {
+            auto i = start + std::string_view("module").size();
+            while (i < content.size()) {
+                if (std::isspace(static_cast<unsigned char>(content[i])) != 0 || content[i] == ';') {
+                    ++i;
+                } else if (content.compare(i, 2U, "//") == 0) {
+                    const auto endOfLine = content.find('\n', i);
+                    i                    = endOfLine == std::string::npos ? content.size() : endOfLine + 1U;
+                } else if (content.compare(i, 2U, "/*") == 0) {
+                    const auto endOfComment = content.find("*/", i + 2U);
+                    i                       = endOfComment == std::string::npos ? content.size() : endOfComment + 2U;
+                } else {
+                    break;
+                }
+            }
+
+            std::string name;
+            for (; i < content.size() && isIdentifierCharacter(content[i]); ++i) {
+                name.push_back(content[i]);
+            }
+            return name;
+        }
+
+        // A part which is not a sequence of modules on its own is rejected, even if the parser throws because an incorrectly split module keyword is not followed by a module
+        bool parseModules(ast_program& astProg, ast_iterator first, const ast_iterator last) {
+            SyrecParser<ast_iterator, SyrecSkipParser<ast_iterator>> parser;
+            SyrecSkipParser<ast_iterator>                            skipParser;
+            try {
+                return qi::phrase_parse(first, last, parser, skipParser, astProg) && first == last;
+            } catch (const qi::expectation_failure<ast_iterator>&) {
                 return false;
             }
-            variableNames.emplace(variableName);
+        }
+
+        /*
+         * Parses the modules of the source concurrently. The (un)call statements are linked to the first preceding module with the called name, as the sequential parser
+         * only knows the preceding modules. Since the checks of the arguments require the parameters of the called module, the parameters of all modules are converted before.
+         * Returns std::nullopt if the source cannot be split into syntactically correct parts, the sequential parser then determines the error.
+         */
+        std::optional<bool> readProgramFromStringInParallel(Program& program, const std::string& content, const ReadProgramSettings& settings, std::string& error) {
+            const auto parts = splitAtModules(content, findModuleKeywords(content));
+            if (parts.empty()) {
+                return std::nullopt;
+            }
+
+            std::vector<ast_program> astParts(parts.size());
+            std::vector<unsigned>    nLinesOfPart(parts.size());
+            // std::vector<bool> cannot be written concurrently
+            std::vector<char> isPartParsed(parts.size(), 0);
+            parallelFor(parts.size(), settings.nThreads, [&](const std::size_t i) {
+                isPartParsed[i] = static_cast<char>(parseModules(astParts[i], parts[i].first, parts[i].second));
+                nLinesOfPart[i] = static_cast<unsigned>(std::count(parts[i].first, parts[i].second, '\n'));
+            });
+            if (std::find(isPartParsed.cbegin(), isPartParsed.cend(), 0) != isPartParsed.cend()) {
+                return std::nullopt;
+            }
 
-            const auto& type = parseVariableType(boost::fusion::at_c<0>(astParam));
-            proc.addParameter(std::make_shared<Variable>(
-                    type,
-                    variableName,
-                    boost::fusion::at_c<1>(boost::fusion::at_c<1>(astParam)),
-                    boost::fusion::at_c<2>(boost::fusion::at_c<1>(astParam)).get_value_or(context.settings.defaultBitwidth)));
+            struct ModuleSource {
+                const ast_module* astModule;
+                ast_iterator      begin;
+                unsigned          lineNumberOffset;
+            };
+            std::vector<ModuleSource> moduleSources;
+            unsigned                  lineNumberOffset = 0U;
+            for (std::size_t i = 0U; i < parts.size(); ++i) {
+                for (const auto& astModule: astParts[i]) {
+                    moduleSources.push_back({&astModule, parts[i].first, lineNumberOffset});
+                }
+                lineNumberOffset += nLinesOfPart[i];
+            }
+
+            // The modules following a module with invalid parameters are not parsed, as the sequential parser stops there
+            Module::vec                                  modules;
+            std::unordered_map<std::string, std::size_t> firstModuleWithName;
+            std::optional<std::string>                   parameterError;
+            for (const auto& moduleSource: moduleSources) {
+                const auto    module = std::make_shared<Module>(boost::fusion::at_c<0>(*moduleSource.astModule));
+                ParserContext context(settings);
+                if (!parseModuleParameters(*module, *moduleSource.astModule, context)) {
+                    parameterError = context.errorMessage;
+                    break;
+                }
+                firstModuleWithName.try_emplace(module->name, modules.size());
+                modules.emplace_back(module);
+            }
+
+            struct ModuleResult {
+                bool        isParsed = false;
+                unsigned    lastLineNumber{0U};
+                std::string errorMessage;
+            };
+            std::vector<ModuleResult> results(modules.size());
+            parallelFor(modules.size(), settings.nThreads, [&](const std::size_t i) {
+                ParserContext context(settings);
+                context.begin            = moduleSources[i].begin;
+                context.lineNumberOffset = moduleSources[i].lineNumberOffset;
+                context.findModule       = [&, i](const std::string& name) {
+                    const auto it = firstModuleWithName.find(name);
+                    return it != firstModuleWithName.cend() && it->second < i ? modules[it->second] : Module::ptr();
+                };
+                results[i].isParsed       = parseModuleStatements(*modules[i], *moduleSources[i].astModule, program, context);
+                results[i].lastLineNumber = context.currentLineNumber;
+                results[i].errorMessage   = std::move(context.errorMessage);
+            });
+
+            // The line number of an error is the one of the last parsed statement, which can be part of a preceding module
+            unsigned lineNumber = 0U;
+            for (std::size_t i = 0U; i < modules.size(); ++i) {
+                if (!results[i].isParsed) {
+                    error = "In line " + std::to_string(results[i].lastLineNumber != 0U ? results[i].lastLineNumber : lineNumber) + ": " + results[i].errorMessage;
+                    return false;
+                }
+                program.addModule(modules[i]);
+                lineNumber = results[i].lastLineNumber;
+            }
+            if (parameterError.has_value()) {
+                error = "In line " + std::to_string(lineNumber) + ": " + *parameterError;
+                return false;
+            }
+            return true;
+        }
+
+        // Names of the modules (un)called by the statements, including the ones of nested statements
+        void collectCalledModules(const std::vector<ast_statement>& statements, std::vector<std::string>& calledModules) {
+            for (const ast_statement& astStat: statements) {
+                const auto& statement = boost::fusion::at_c<1>(astStat);
+                if (const auto* astCallStat = boost::get<ast_call_statement>(&statement); astCallStat != nullptr) {
+                    calledModules.emplace_back(boost::fusion::at_c<1>(*astCallStat));
+                } else if (const auto* astIfStat = boost::get<ast_if_statement>(&statement); astIfStat != nullptr) {
+                    collectCalledModules(astIfStat->ifStatement, calledModules);
+                    collectCalledModules(astIfStat->elseStatement, calledModules);
+                } else if (const auto* astForStat = boost::get<ast_for_statement>(&statement); astForStat != nullptr) {
+                    collectCalledModules(astForStat->doStatement, calledModules);
+                }
+            }
         }
 
-        for (const ast_statement& astStat: boost::fusion::at_c<3>(astProc)) {
-            const auto& stat = parseStatement(astStat, prog, proc, context);
-            if (!stat) {
+        /*
+         * Parses only the modules reachable from the main module via (un)call statements. The modules are indexed by the name following their module keyword and
+         * an (un)call statement is resolved like in the sequential parser, i.e. to the first module with the called name if it precedes the calling module.
+         * The reachable modules are converted in the order of the source, thus the errors are the ones of the sequential parser for a source only consisting of them
+         * (with the line numbers of the whole source). Returns std::nullopt if a reachable part of the source is not exactly the indexed module, the sequential parser then parses all modules.
+         */
+        std::optional<bool> readProgramFromStringLazily(Program& program, const std::string& content, const ReadProgramSettings& settings, std::string& error) {
+            const auto starts = findModuleKeywords(content);
+            const auto parts  = splitAtModules(content, starts);
+            if (parts.empty()) {
+                return std::nullopt;
+            }
+
+            std::vector<std::string>                     nameOfPart;
+            std::unordered_map<std::string, std::size_t> firstPartWithName;
+            for (const auto start: starts) {
+                nameOfPart.emplace_back(moduleNameAfterKeyword(content, start));
+                if (nameOfPart.back().empty()) {
+                    return std::nullopt;
+                }
+                firstPartWithName.try_emplace(nameOfPart.back(), nameOfPart.size() - 1U);
+            }
+
+            std::size_t mainPart       = 0U;
+            const auto  mainModuleName = settings.mainModule.empty() ? std::string("main") : settings.mainModule;
+            if (const auto it = firstPartWithName.find(mainModuleName); it != firstPartWithName.cend()) {
+                mainPart = it->second;
+            } else if (!settings.mainModule.empty()) {
+                error = "Unknown module " + settings.mainModule;
                 return false;
             }
-            proc.addStatement(stat);
+
+            // The parts are parsed in breadth-first order of the (un)calls, the parts of one level concurrently if parallel parsing is enabled
+            std::vector<ast_program> astParts(parts.size());
+            std::vector<char>        isReachable(parts.size(), 0);
+            std::vector<std::size_t> frontier{mainPart};
+            isReachable[mainPart] = 1;
+            while (!frontier.empty()) {
+                std::vector<char> isPartParsed(frontier.size(), 0);
+                parallelFor(frontier.size(), settings.parallelParsing ? settings.nThreads : 1U, [&](const std::size_t j) {
+                    const auto i    = frontier[j];
+                    isPartParsed[j] = static_cast<char>(parseModules(astParts[i], parts[i].first, parts[i].second) && astParts[i].size() == 1U && boost::fusion::at_c<0>(astParts[i].front()) == nameOfPart[i]);
+                });
+                if (std::find(isPartParsed.cbegin(), isPartParsed.cend(), 0) != isPartParsed.cend()) {
+                    return std::nullopt;
+                }
+
+                std::vector<std::size_t> nextFrontier;
+                for (const auto i: frontier) {
+                    std::vector<std::string> calledModules;
+                    collectCalledModules(boost::fusion::at_c<3>(astParts[i].front()), calledModules);
+                    for (const auto& name: calledModules) {
+                        if (const auto it = firstPartWithName.find(name); it != firstPartWithName.cend() && it->second < i && isReachable[it->second] == 0) {
+                            isReachable[it->second] = 1;
+                            nextFrontier.emplace_back(it->second);
+                        }
+                    }
+                }
+                frontier = std::move(nextFrontier);
+            }
+
+            Module::vec   moduleOfPart(parts.size());
+            ParserContext context(settings);
+            context.findModule = [&](const std::string& name) {
+                const auto it = firstPartWithName.find(name);
+                return it != firstPartWithName.cend() ? moduleOfPart[it->second] : Module::ptr();
+            };
+            unsigned lineNumberOffset = 0U;
+            for (std::size_t i = 0U; i < parts.size(); ++i) {
+                if (isReachable[i] != 0) {
+                    context.begin            = parts[i].first;
+                    context.lineNumberOffset = lineNumberOffset;
+                    const auto module        = std::make_shared<Module>(nameOfPart[i]);
+                    if (!parseModule(*module, astParts[i].front(), program, context)) {
+                        error = "In line " + std::to_string(context.currentLineNumber) + ": " + context.errorMessage;
+                        return false;
+                    }
+                    moduleOfPart[i] = module;
+                    program.addModule(module);
+                }
+                lineNumberOffset += static_cast<unsigned>(std::count(parts[i].first, parts[i].second, '\n'));
+            }
+            return true;
         }
+    } // namespace
 
-        return true;
+    bool parseModule(Module& proc, const ast_module& astProc, const Program& prog, ParserContext& context) {
+        return parseModuleParameters(proc, astProc, context) && parseModuleStatements(proc, astProc, prog, context);
     }
 
     bool Program::readProgramFromString(const std::string& content, const ReadProgramSettings& settings, std::string& error) {
+        if (settings.lazyLoading) {
+            // the synthesis and simulation of the program start at the module the program was loaded for
+            setMainModule(settings.mainModule);
+            if (const auto parsed = readProgramFromStringLazily(*this, content, settings, error); parsed.has_value()) {
+                return *parsed;
+            }
+        }
+        if (settings.parallelParsing) {
+            if (const auto parsed = readProgramFromStringInParallel(*this, content, settings, error); parsed.has_value()) {
+                return *parsed;
+            }
+        }
+
         ast_program astProg;
         if (!parseString(astProg, content)) {
             error = "PARSE_STRING_FAILED";
@@ -10,8 +10,165 @@
 
 #include "core/syrec/program.hpp"
 
+#include "core/memory_report.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/number.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
 namespace syrec {
 
+    namespace {
+        class IrMemoryAccountant {
+        public:
+            explicit IrMemoryAccountant(MemoryReport& report):
+                report(report) {}
+
+            void account(const Module::ptr& module) {
+                if (!firstVisit(module)) {
+                    return;
+                }
+                report.add("ir.modules", sizeof(Module) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + MemoryReport::dynamicBytes(module->name) + vectorBytes(module->parameters) + vectorBytes(module->variables) + vectorBytes(module->statements));
+                for (const auto& parameter: module->parameters) {
+                    account(parameter);
+                }
+                for (const auto& variable: module->variables) {
+                    account(variable);
+                }
+                for (const auto& statement: module->statements) {
+                    account(statement);
+                }
+            }
+
+        private:
+            MemoryReport&                   report;
+            std::unordered_set<const void*> visited;
+
+            template<typename T>
+            [[nodiscard]] bool firstVisit(const std::shared_ptr<T>& node) {
+                return node != nullptr && visited.emplace(node.get()).second;
+            }
+
+            template<typename T>
+            [[nodiscard]] static std::size_t vectorBytes(const std::vector<T>& vec) {
+                return vec.capacity() * sizeof(T);
+            }
+
+            void account(const Variable::ptr& variable) {
+                if (!firstVisit(variable)) {
+                    return;
+                }
+                report.add("ir.variables", sizeof(Variable) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + MemoryReport::dynamicBytes(variable->name) + vectorBytes(variable->dimensions));
+                account(variable->reference);
+            }
+
+            void account(const Number::ptr& number) {
+                if (!firstVisit(number)) {
+                    return;
+                }
+                const auto loopVariableBytes = number->isLoopVariable() ? MemoryReport::dynamicBytes(number->variableName()) : 0U;
+                report.add("ir.numbers", sizeof(Number) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + loopVariableBytes);
+            }
+
+            void account(const VariableAccess::ptr& variableAccess) {
+                if (!firstVisit(variableAccess)) {
+                    return;
+                }
+                report.add("ir.variable_accesses", sizeof(VariableAccess) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + vectorBytes(variableAccess->indexes));
+                account(variableAccess->var);
+                if (variableAccess->range.has_value()) {
+                    account(variableAccess->range->first);
+                    account(variableAccess->range->second);
+                }
+                for (const auto& index: variableAccess->indexes) {
+                    account(index);
+                }
+            }
+
+            void account(const Expression::ptr& expression) {
+                if (!firstVisit(expression)) {
+                    return;
+                }
+
+                if (auto const* numeric = dynamic_cast<NumericExpression*>(expression.get())) {
+                    report.add("ir.expressions", sizeof(NumericExpression) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(numeric->value);
+                } else if (auto const* variable = dynamic_cast<VariableExpression*>(expression.get())) {
+                    report.add("ir.expressions", sizeof(VariableExpression) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(variable->var);
+                } else if (auto const* binary = dynamic_cast<BinaryExpression*>(expression.get())) {
+                    report.add("ir.expressions", sizeof(BinaryExpression) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(binary->lhs);
+                    account(binary->rhs);
+                } else if (auto const* shift = dynamic_cast<ShiftExpression*>(expression.get())) {
+                    report.add("ir.expressions", sizeof(ShiftExpression) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(shift->lhs);
+                    account(shift->rhs);
+                } else {
+                    report.add("ir.expressions", sizeof(Expression) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                }
+            }
+
+            void account(const Statement::vec& statements) {
+                for (const auto& statement: statements) {
+                    account(statement);
+                }
+            }
+
+            void account(const Statement::ptr& statement) {
+                if (!firstVisit(statement)) {
+                    return;
+                }
+
+                if (auto const* swapStat = dynamic_cast<SwapStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(SwapStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(swapStat->lhs);
+                    account(swapStat->rhs);
+                } else if (auto const* unaryStat = dynamic_cast<UnaryStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(UnaryStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(unaryStat->var);
+                } else if (auto const* assignStat = dynamic_cast<AssignStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(AssignStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                    account(assignStat->lhs);
+                    account(assignStat->rhs);
+                } else if (auto const* ifStat = dynamic_cast<IfStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(IfStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + vectorBytes(ifStat->thenStatements) + vectorBytes(ifStat->elseStatements));
+                    account(ifStat->condition);
+                    account(ifStat->thenStatements);
+                    account(ifStat->elseStatements);
+                    account(ifStat->fiCondition);
+                } else if (auto const* forStat = dynamic_cast<ForStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(ForStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + MemoryReport::dynamicBytes(forStat->loopVariable) + vectorBytes(forStat->statements));
+                    account(forStat->range.first);
+                    account(forStat->range.second);
+                    account(forStat->step);
+                    account(forStat->statements);
+                } else if (auto const* callStat = dynamic_cast<CallStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(CallStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + parameterBytes(callStat->parameters));
+                } else if (auto const* uncallStat = dynamic_cast<UncallStatement*>(statement.get())) {
+                    report.add("ir.statements", sizeof(UncallStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE + parameterBytes(uncallStat->parameters));
+                } else {
+                    report.add("ir.statements", sizeof(SkipStatement) + MemoryReport::SHARED_POINTER_CONTROL_BLOCK_SIZE);
+                }
+            }
+
+            [[nodiscard]] static std::size_t parameterBytes(const std::vector<std::string>& parameters) {
+                std::size_t bytes = vectorBytes(parameters);
+                for (const auto& parameter: parameters) {
+                    bytes += MemoryReport::dynamicBytes(parameter);
+                }
+                return bytes;
+            }
+        };
+    } // namespace
+
     bool Program::readFile(const std::string& filename, const ReadProgramSettings settings, std::string& error) {
         std::string content;
         std::string line;
@@ -33,4 +190,23 @@ namespace syrec {
         return {};
     }
 
+    std::string Program::readFromString(const std::string& content, const ReadProgramSettings& settings) {
+        if (std::string errorMessage; !(readProgramFromString(content, settings, errorMessage))) {
+            return errorMessage;
+        }
+        return {};
+    }
+
+    MemoryReport Program::memoryReport() const {
+        MemoryReport report;
+        report.add("ir.program", sizeof(Program) + modulesVec.capacity() * sizeof(Module::ptr));
+
+        // the modules called by a call statement are part of the program, thus they are accounted when the program modules are
+        IrMemoryAccountant accountant(report);
+        for (const auto& module: modulesVec) {
+            accountant.account(module);
+        }
+        return report;
+    }
+
 } // namespace syrec
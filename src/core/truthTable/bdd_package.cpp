@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/truthTable/bdd_package.hpp"
+
+#include "core/memory_report.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+
+namespace syrec {
+
+    BddPackage::BddPackage() {
+        nodes.push_back({TERMINAL_VARIABLE, ZERO, ZERO});
+        nodes.push_back({TERMINAL_VARIABLE, ONE, ONE});
+    }
+
+    auto BddPackage::makeNode(const std::size_t variable, const Node low, const Node high) -> Node {
+        assert(variable < this->variable(low) && variable < this->variable(high));
+        if (low == high) {
+            return low;
+        }
+
+        const Key key{variable, low, high};
+        if (const auto it = uniqueTable.find(key); it != uniqueTable.end()) {
+            return it->second;
+        }
+
+        const auto node = static_cast<Node>(nodes.size());
+        nodes.push_back({variable, low, high});
+        uniqueTable.emplace(key, node);
+        return node;
+    }
+
+    auto BddPackage::topCofactor(const Node f, const std::size_t topVariable, const bool value) const -> Node {
+        if (variable(f) != topVariable) {
+            return f;
+        }
+        return value ? high(f) : low(f);
+    }
+
+    auto BddPackage::ite(const Node f, const Node g, const Node h) -> Node {
+        // terminal cases
+        if (f == ONE) {
+            return g;
+        }
+        if (f == ZERO) {
+            return h;
+        }
+        if (g == h) {
+            return g;
+        }
+        if (g == ONE && h == ZERO) {
+            return f;
+        }
+
+        const Key key{f, g, h};
+        if (const auto it = iteComputeTable.find(key); it != iteComputeTable.end()) {
+            return it->second;
+        }
+
+        const auto topVariable = std::min({variable(f), variable(g), variable(h)});
+        const auto thenNode    = ite(topCofactor(f, topVariable, true), topCofactor(g, topVariable, true), topCofactor(h, topVariable, true));
+        const auto elseNode    = ite(topCofactor(f, topVariable, false), topCofactor(g, topVariable, false), topCofactor(h, topVariable, false));
+        const auto result      = makeNode(topVariable, elseNode, thenNode);
+        iteComputeTable.emplace(key, result);
+        return result;
+    }
+
+    auto BddPackage::cofactor(const Node f, const std::size_t variable, const bool value) -> Node {
+        std::unordered_map<Node, Node> computed;
+
+        const std::function<Node(Node)> restrict = [&](const Node node) -> Node {
+            if (this->variable(node) > variable) {
+                return node;
+            }
+            if (this->variable(node) == variable) {
+                return value ? high(node) : low(node);
+            }
+            if (const auto it = computed.find(node); it != computed.end()) {
+                return it->second;
+            }
+            const auto lowNode  = restrict(low(node));
+            const auto highNode = restrict(high(node));
+            const auto result   = makeNode(this->variable(node), lowNode, highNode);
+            computed.emplace(node, result);
+            return result;
+        };
+        return restrict(f);
+    }
+
+    auto BddPackage::fromCube(const TruthTable::Cube& cube, const std::size_t firstVariable) -> Node {
+        Node result = ONE;
+        for (std::size_t i = cube.size(); i > 0; --i) {
+            const auto& literal = cube[i - 1];
+            if (!literal.has_value()) {
+                continue;
+            }
+            result = *literal ? makeNode(firstVariable + i - 1, ZERO, result) : makeNode(firstVariable + i - 1, result, ZERO);
+        }
+        return result;
+    }
+
+    auto BddPackage::shiftVariables(const Node f, const std::size_t offset) -> Node {
+        std::unordered_map<Node, Node> computed;
+
+        const std::function<Node(Node)> shift = [&](const Node node) -> Node {
+            if (isTerminal(node)) {
+                return node;
+            }
+            if (const auto it = computed.find(node); it != computed.end()) {
+                return it->second;
+            }
+            const auto lowNode  = shift(low(node));
+            const auto highNode = shift(high(node));
+            const auto result   = makeNode(variable(node) + offset, lowNode, highNode);
+            computed.emplace(node, result);
+            return result;
+        };
+        return shift(f);
+    }
+
+    auto BddPackage::import(const BddPackage& other, const Node f) -> Node {
+        if (&other == this) {
+            return f;
+        }
+
+        std::unordered_map<Node, Node> computed;
+
+        const std::function<Node(Node)> copy = [&](const Node node) -> Node {
+            if (isTerminal(node)) {
+                return node;
+            }
+            if (const auto it = computed.find(node); it != computed.end()) {
+                return it->second;
+            }
+            const auto lowNode  = copy(other.low(node));
+            const auto highNode = copy(other.high(node));
+            const auto result   = makeNode(other.variable(node), lowNode, highNode);
+            computed.emplace(node, result);
+            return result;
+        };
+        return copy(f);
+    }
+
+    auto BddPackage::memoryReport() const -> MemoryReport {
+        using TableEntry = std::unordered_map<Key, Node, KeyHash>::value_type;
+
+        MemoryReport report;
+        report.add("bdd.nodes", nodes.capacity() * sizeof(BddNode), nodes.size());
+        report.add("bdd.unique_table", uniqueTable.size() * (sizeof(TableEntry) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD) + uniqueTable.bucket_count() * sizeof(void*), uniqueTable.size());
+        report.add("bdd.compute_table", iteComputeTable.size() * (sizeof(TableEntry) + MemoryReport::UNORDERED_CONTAINER_NODE_OVERHEAD) + iteComputeTable.bucket_count() * sizeof(void*), iteComputeTable.size());
+        return report;
+    }
+
+} // namespace syrec
@@ -0,0 +1,332 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/truthTable/bdd_truth_table.hpp"
+
+#include "core/memory_report.hpp"
+#include "core/truthTable/bdd_package.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace syrec {
+
+    namespace {
+        // unsigned integer of arbitrary width (least significant word first), the number of inputs mapped to an output pattern of a table with
+        // 64 or more inputs does not necessarily fit into 64 bits
+        class InputCount {
+        public:
+            explicit InputCount(const std::uint64_t value = 0U) {
+                if (value != 0U) {
+                    words.emplace_back(value);
+                }
+            }
+
+            auto operator+=(const InputCount& other) -> InputCount& {
+                if (words.size() < other.words.size()) {
+                    words.resize(other.words.size(), 0U);
+                }
+                std::uint64_t carry = 0U;
+                for (std::size_t i = 0U; i < words.size(); ++i) {
+                    const auto summand = i < other.words.size() ? other.words[i] : 0U;
+                    const auto partial = words[i] + summand;
+                    words[i]           = partial + carry;
+                    carry              = (partial < summand || words[i] < partial) ? 1U : 0U;
+                }
+                if (carry != 0U) {
+                    words.emplace_back(carry);
+                }
+                return *this;
+            }
+
+            // the most significant word is never zero, thus a longer count is a larger one
+            auto operator<(const InputCount& other) const -> bool {
+                if (words.size() != other.words.size()) {
+                    return words.size() < other.words.size();
+                }
+                return std::lexicographical_compare(words.crbegin(), words.crend(), other.words.crbegin(), other.words.crend());
+            }
+
+            [[nodiscard]] auto toUint64() const -> std::optional<std::uint64_t> {
+                if (words.size() > 1U) {
+                    return std::nullopt;
+                }
+                return words.empty() ? 0U : words.front();
+            }
+
+            // smallest k with 2^k >= count (0 for a count of zero or one)
+            [[nodiscard]] auto ceilLog2() const -> std::size_t {
+                if (words.empty()) {
+                    return 0U;
+                }
+                const auto  top        = words.back();
+                std::size_t highestBit = 64U * (words.size() - 1U);
+                for (auto rest = top >> 1U; rest != 0U; rest >>= 1U) {
+                    ++highestBit;
+                }
+                const auto isPowerOfTwo = (top & (top - 1U)) == 0U && std::all_of(words.cbegin(), words.cend() - 1, [](const std::uint64_t word) { return word == 0U; });
+                return isPowerOfTwo ? highestBit : highestBit + 1U;
+            }
+
+        private:
+            std::vector<std::uint64_t> words;
+        };
+
+        auto countOutputPatterns(const BddTruthTable& tt) -> std::map<TruthTable::Cube, InputCount> {
+            const auto& package = *tt.getPackage();
+            const auto  nIn     = tt.nInputs();
+            const auto  nOut    = tt.nOutputs();
+
+            // a state consists of the domain followed by the on-sets and the don't care sets of all outputs restricted to the inputs that have not been assigned yet
+            using State = std::vector<BddPackage::Node>;
+            State initial{tt.domain()};
+            for (std::size_t i = 0U; i < nOut; ++i) {
+                initial.emplace_back(tt.onSet(i));
+            }
+            for (std::size_t i = 0U; i < nOut; ++i) {
+                initial.emplace_back(tt.dontCareSet(i));
+            }
+
+            std::map<std::pair<std::size_t, State>, std::map<TruthTable::Cube, InputCount>> computed;
+
+            const std::function<const std::map<TruthTable::Cube, InputCount>&(std::size_t, const State&)> count = [&](const std::size_t level, const State& state) -> const std::map<TruthTable::Cube, InputCount>& {
+                auto key = std::make_pair(level, state);
+                if (const auto it = computed.find(key); it != computed.end()) {
+                    return it->second;
+                }
+
+                std::map<TruthTable::Cube, InputCount> frequencies;
+                if (state.front() == BddPackage::ZERO) {
+                    // no input of the domain is left
+                } else if (level == nIn) {
+                    // all functions are constant now
+                    TruthTable::Cube pattern{};
+                    pattern.reserve(nOut);
+                    for (std::size_t i = 0U; i < nOut; ++i) {
+                        if (state[1U + i] == BddPackage::ONE) {
+                            pattern.emplace_back(true);
+                        } else if (state[1U + nOut + i] == BddPackage::ONE) {
+                            pattern.emplace_back(TruthTable::Cube::Value{});
+                        } else {
+                            pattern.emplace_back(false);
+                        }
+                    }
+                    frequencies.emplace(std::move(pattern), InputCount(1U));
+                } else {
+                    for (const auto value: {false, true}) {
+                        State child{};
+                        child.reserve(state.size());
+                        for (const auto f: state) {
+                            if (package.variable(f) != level) {
+                                child.emplace_back(f);
+                            } else {
+                                child.emplace_back(value ? package.high(f) : package.low(f));
+                            }
+                        }
+                        for (const auto& [pattern, frequency]: count(level + 1U, child)) {
+                            frequencies[pattern] += frequency;
+                        }
+                    }
+                }
+                return computed.emplace(std::move(key), std::move(frequencies)).first->second;
+            };
+
+            return count(0U, initial);
+        }
+    } // namespace
+
+    auto BddTruthTable::resize(const std::size_t nInputs, const std::size_t nOutputs) -> void {
+        inputs      = nInputs;
+        inputDomain = BddPackage::ONE;
+        onSets.assign(nOutputs, BddPackage::ZERO);
+        dontCareSets.assign(nOutputs, BddPackage::ZERO);
+    }
+
+    auto BddTruthTable::try_emplace(const TruthTable::Cube& input, const TruthTable::Cube& output) -> void {
+        if (empty()) {
+            resize(input.size(), output.size());
+        }
+        assert(input.size() == nInputs() && output.size() == nOutputs());
+
+        const auto cube = package->fromCube(input);
+        for (std::size_t i = 0U; i < output.size(); ++i) {
+            if (!output[i].has_value()) {
+                dontCareSets[i] = package->disjunction(dontCareSets[i], cube);
+            } else if (*output[i]) {
+                onSets[i] = package->disjunction(onSets[i], cube);
+            }
+        }
+    }
+
+    auto BddTruthTable::careSet(const std::size_t output) -> BddPackage::Node {
+        return package->disjunction(onSets[output], package->negate(dontCareSets[output]));
+    }
+
+    auto BddTruthTable::addConstantInputs(const std::size_t n, const bool append) -> void {
+        if (append) {
+            for (std::size_t i = 0U; i < n; ++i) {
+                inputDomain = package->conjunction(inputDomain, package->negate(package->makeVariable(inputs + i)));
+            }
+        } else {
+            // the existing inputs move towards the least significant positions
+            for (auto& f: onSets) {
+                f = package->shiftVariables(f, n);
+            }
+            for (auto& f: dontCareSets) {
+                f = package->shiftVariables(f, n);
+            }
+            inputDomain = package->shiftVariables(inputDomain, n);
+            for (std::size_t i = 0U; i < n; ++i) {
+                inputDomain = package->conjunction(inputDomain, package->negate(package->makeVariable(i)));
+            }
+        }
+        inputs += n;
+    }
+
+    auto BddTruthTable::addConstantOutputs(const std::size_t n, const bool append) -> void {
+        const auto position = append ? onSets.size() : 0U;
+        onSets.insert(onSets.begin() + static_cast<std::ptrdiff_t>(position), n, BddPackage::ZERO);
+        dontCareSets.insert(dontCareSets.begin() + static_cast<std::ptrdiff_t>(position), n, BddPackage::ZERO);
+    }
+
+    auto BddTruthTable::outputPatternFrequencies() const -> std::map<TruthTable::Cube, std::uint64_t> {
+        std::map<TruthTable::Cube, std::uint64_t> frequencies;
+        for (const auto& [pattern, count]: countOutputPatterns(*this)) {
+            const auto frequency = count.toUint64();
+            if (!frequency.has_value()) {
+                throw std::invalid_argument("Overflow!, Number of inputs mapped to an output pattern is greater than maximum capacity (64 bits)");
+            }
+            frequencies.emplace(pattern, *frequency);
+        }
+        return frequencies;
+    }
+
+    auto BddTruthTable::minimumAdditionalLinesRequired() const -> std::size_t {
+        const auto outputFreq = countOutputPatterns(*this);
+        if (outputFreq.empty()) {
+            return 0U;
+        }
+
+        const auto maxPair = std::max_element(outputFreq.begin(), outputFreq.end(), [](const auto& p1, const auto& p2) { return p1.second < p2.second; });
+
+        return maxPair->second.ceilLog2();
+    }
+
+    auto BddTruthTable::memoryReport() const -> MemoryReport {
+        MemoryReport report = package->memoryReport();
+        report.add("truth_table.bdd_roots", (onSets.capacity() + dontCareSets.capacity()) * sizeof(BddPackage::Node), onSets.size() + dontCareSets.size());
+        // std::vector<bool> stores the flags as bits
+        report.add("truth_table.flags", (constants.size() + garbage.size() + 7U) / 8U, constants.size() + garbage.size());
+        return report;
+    }
+
+    auto BddTruthTable::equal(BddTruthTable const& tt1, BddTruthTable const& tt2, const bool equalityUpToDontCare) -> bool {
+        if (tt1.nInputs() != tt2.nInputs() || tt1.nOutputs() != tt2.nOutputs()) {
+            return false;
+        }
+
+        // the comparison builds new nodes, thus it is done in a package of its own instead of the (possibly shared) packages of the tables
+        BddPackage package;
+        const auto fromFirst  = [&](const BddPackage::Node f) { return package.import(*tt1.package, f); };
+        const auto fromSecond = [&](const BddPackage::Node f) { return package.import(*tt2.package, f); };
+
+        const auto domain = fromFirst(tt1.inputDomain);
+        if (domain != fromSecond(tt2.inputDomain)) {
+            return false;
+        }
+
+        // the garbage vector is stored in reversed order (as for the TruthTable)
+        const auto isGarbage = [](BddTruthTable const& tt, const std::size_t output) {
+            const auto& garbage = tt.getGarbage();
+            return garbage.size() == tt.nOutputs() && garbage[garbage.size() - 1U - output];
+        };
+
+        for (std::size_t i = 0U; i < tt1.nOutputs(); ++i) {
+            const auto on1 = fromFirst(tt1.onSets[i]);
+            const auto on2 = fromSecond(tt2.onSets[i]);
+            const auto dc1 = package.conjunction(fromFirst(tt1.dontCareSets[i]), package.negate(on1));
+            const auto dc2 = package.conjunction(fromSecond(tt2.dontCareSets[i]), package.negate(on2));
+
+            if (equalityUpToDontCare) {
+                if (isGarbage(tt1, i) || isGarbage(tt2, i)) {
+                    continue;
+                }
+                // both outputs have to be specified and different for an input to be a mismatch
+                const auto care     = package.conjunction(package.negate(dc1), package.negate(dc2));
+                const auto mismatch = package.conjunction(domain, package.conjunction(care, package.exclusiveOr(on1, on2)));
+                if (mismatch != BddPackage::ZERO) {
+                    return false;
+                }
+            } else {
+                const auto mismatch = package.disjunction(package.exclusiveOr(on1, on2), package.exclusiveOr(dc1, dc2));
+                if (package.conjunction(domain, mismatch) != BddPackage::ZERO) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    auto augmentWithConstants(BddTruthTable& tt, std::size_t const& nBits, bool appendZero) -> void {
+        if (tt.empty()) {
+            return;
+        }
+
+        const auto requiredOutConstants = nBits - tt.nOutputs();
+        const auto requiredInConstants  = nBits - tt.nInputs();
+
+        if (appendZero) {
+            // based on the requiredOutConstants, zeros are appended to the outputs.
+            if (tt.getGarbage().size() != nBits) {
+                // add garbage at the LSB.
+                tt.getGarbage().insert(tt.getGarbage().begin(), requiredOutConstants, true);
+            }
+            tt.addConstantOutputs(requiredOutConstants, true);
+        } else {
+            // based on the requiredOutConstants, zeros are inserted to the outputs.
+            if (tt.getGarbage().size() != nBits) {
+                tt.getGarbage().resize(tt.getGarbage().size() + requiredOutConstants);
+            }
+            tt.addConstantOutputs(requiredOutConstants, false);
+        }
+
+        if (tt.nInputs() >= tt.nOutputs()) {
+            return;
+        }
+
+        if (appendZero) {
+            // based on the requiredInConstants, zeros are appended to the inputs.
+            if (tt.getConstants().size() != nBits) {
+                // add constants at the LSB.
+                tt.getConstants().insert(tt.getConstants().begin(), requiredInConstants, true);
+            }
+            tt.addConstantInputs(requiredInConstants, true);
+        } else {
+            // based on the requiredConstants, zeros are inserted to the inputs.
+            const auto requiredConstants = tt.nOutputs() - tt.nInputs();
+            if (tt.getConstants().size() != nBits) {
+                // add constants at the MSB.
+                tt.getConstants().insert(tt.getConstants().end(), requiredConstants, true);
+            }
+            tt.addConstantInputs(requiredConstants, false);
+        }
+    }
+
+} // namespace syrec
@@ -10,6 +10,8 @@
 
 #include "core/truthTable/truth_table.hpp"
 
+#include "core/memory_report.hpp"
+
 #include <algorithm>
 #include <cassert>
 #include <cmath>
@@ -115,4 +117,14 @@ namespace syrec {
 
         return static_cast<std::size_t>(std::ceil(std::log2(maxPair->second)));
     }
+
+    auto TruthTable::memoryReport() const -> MemoryReport {
+        MemoryReport report;
+        for (const auto& [input, output]: cubeMap) {
+            report.add("truth_table.cubes", sizeof(CubeMap::value_type) + MemoryReport::ORDERED_CONTAINER_NODE_OVERHEAD + (input.size() + output.size()) * sizeof(Cube::Value));
+        }
+        // std::vector<bool> stores the flags as bits
+        report.add("truth_table.flags", (constants.size() + garbage.size() + 7U) / 8U, constants.size() + garbage.size());
+        return report;
+    }
 } // namespace syrec
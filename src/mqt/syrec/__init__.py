@@ -34,23 +34,43 @@ if sys.platform == "win32":
 from ._version import version as __version__
 from .pysyrec import (
     annotatable_quantum_computation,
+    build_truth_table,
     cost_aware_synthesis,
+    dd_batch_settings,
+    dd_synthesizer,
+    encode_with_additional_line,
+    extend,
     line_aware_synthesis,
+    memory_report,
+    minimize_boolean,
     n_bit_values_container,
+    parse_pla,
     program,
     properties,
+    read_pla,
     read_program_settings,
     simple_simulation,
+    truth_table,
 )
 
 __all__ = [
     "__version__",
     "annotatable_quantum_computation",
+    "build_truth_table",
     "cost_aware_synthesis",
+    "dd_batch_settings",
+    "dd_synthesizer",
+    "encode_with_additional_line",
+    "extend",
     "line_aware_synthesis",
+    "memory_report",
+    "minimize_boolean",
     "n_bit_values_container",
+    "parse_pla",
     "program",
     "properties",
+    "read_pla",
     "read_program_settings",
     "simple_simulation",
+    "truth_table",
 ]
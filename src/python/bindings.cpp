@@ -8,22 +8,159 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/optimization/esop_minimization.hpp"
+#include "algorithms/optimization/loop_invariant_code_motion.hpp"
+#include "algorithms/optimization/statement_hoisting.hpp"
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/simulation/sequential_simulation.hpp"
 #include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/dd_package_tuning.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/encoding.hpp"
+#include "algorithms/synthesis/functional_decomposition.hpp"
 #include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
 #include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/circuit_layout.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/io/pla_writer.hpp"
+#include "core/memory_report.hpp"
 #include "core/properties.hpp"
 #include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
 #include "ir/QuantumComputation.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <optional>
+#include <pybind11/numpy.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace py = pybind11;
 using namespace pybind11::literals;
 using namespace syrec;
 
+namespace {
+    using BitMatrix = py::array_t<std::uint8_t, py::array::c_style | py::array::forcecast>;
+
+    // a row of a (n_rows x n_columns) 0/1 matrix as cube, the columns whose care mask is zero are don't cares
+    TruthTable::Cube rowToCube(const std::uint8_t* values, const std::uint8_t* care, const std::size_t nColumns) {
+        TruthTable::Cube cube{};
+        cube.reserve(nColumns);
+        for (std::size_t column = 0U; column < nColumns; ++column) {
+            if (care != nullptr && care[column] == 0U) {
+                cube.emplace_back(TruthTable::Cube::Value{});
+            } else {
+                cube.emplace_back(values[column] != 0U);
+            }
+        }
+        return cube;
+    }
+
+    void checkShape(const BitMatrix& matrix, const std::size_t nRows, const std::size_t nColumns, const std::string& name) {
+        if (matrix.ndim() != 2 || static_cast<std::size_t>(matrix.shape(0)) != nRows || static_cast<std::size_t>(matrix.shape(1)) != nColumns) {
+            throw std::invalid_argument("The " + name + " must be a matrix of shape (" + std::to_string(nRows) + ", " + std::to_string(nColumns) + ")");
+        }
+    }
+
+    TruthTable truthTableFromArrays(const BitMatrix& inputs, const BitMatrix& outputs, const std::optional<BitMatrix>& inputCare, const std::optional<BitMatrix>& outputCare) {
+        if (inputs.ndim() != 2 || outputs.ndim() != 2) {
+            throw std::invalid_argument("The inputs and outputs must be matrices with one row per cube");
+        }
+        const auto nRows    = static_cast<std::size_t>(inputs.shape(0));
+        const auto nInputs  = static_cast<std::size_t>(inputs.shape(1));
+        const auto nOutputs = static_cast<std::size_t>(outputs.shape(1));
+        checkShape(outputs, nRows, nOutputs, "outputs");
+        if (inputCare.has_value()) {
+            checkShape(*inputCare, nRows, nInputs, "input care mask");
+        }
+        if (outputCare.has_value()) {
+            checkShape(*outputCare, nRows, nOutputs, "output care mask");
+        }
+
+        // the arrays are kept alive by the caller, thus their buffers can be read without holding the GIL
+        const auto* in        = inputs.data();
+        const auto* out       = outputs.data();
+        const auto* inCare    = inputCare.has_value() ? inputCare->data() : nullptr;
+        const auto* outCare   = outputCare.has_value() ? outputCare->data() : nullptr;
+        const auto  rowOffset = [](const std::uint8_t* matrix, const std::size_t row, const std::size_t nColumns) {
+            return matrix == nullptr ? nullptr : matrix + (row * nColumns);
+        };
+
+        const py::gil_scoped_release release;
+        TruthTable                   tt{};
+        for (std::size_t row = 0U; row < nRows; ++row) {
+            tt.try_emplace(rowToCube(rowOffset(in, row, nInputs), rowOffset(inCare, row, nInputs), nInputs),
+                           rowToCube(rowOffset(out, row, nOutputs), rowOffset(outCare, row, nOutputs), nOutputs));
+        }
+        return tt;
+    }
+
+    std::tuple<BitMatrix, BitMatrix, BitMatrix, BitMatrix> truthTableToArrays(const TruthTable& tt) {
+        const auto nRows    = static_cast<py::ssize_t>(tt.size());
+        const auto nInputs  = static_cast<py::ssize_t>(tt.nInputs());
+        const auto nOutputs = static_cast<py::ssize_t>(tt.nOutputs());
+
+        BitMatrix inputs({nRows, nInputs});
+        BitMatrix inputCare({nRows, nInputs});
+        BitMatrix outputs({nRows, nOutputs});
+        BitMatrix outputCare({nRows, nOutputs});
+
+        auto* in      = inputs.mutable_data();
+        auto* inCare  = inputCare.mutable_data();
+        auto* out     = outputs.mutable_data();
+        auto* outCare = outputCare.mutable_data();
+        {
+            const py::gil_scoped_release release;
+            const auto                   fill = [](const TruthTable::Cube& cube, std::uint8_t*& values, std::uint8_t*& care) {
+                for (const auto& value: cube) {
+                    *values++ = value.has_value() && *value ? 1U : 0U;
+                    *care++   = value.has_value() ? 1U : 0U;
+                }
+            };
+            for (const auto& [input, output]: tt) {
+                fill(input, in, inCare);
+                fill(output, out, outCare);
+            }
+        }
+        return {inputs, outputs, inputCare, outputCare};
+    }
+
+    // copy a vector into a new NumPy array of the given shape (the vector is stored row-major)
+    template<typename T>
+    py::array_t<T> toArray(const std::vector<T>& values, const std::vector<py::ssize_t>& shape) {
+        py::array_t<T> array(shape);
+        std::copy(values.cbegin(), values.cend(), array.mutable_data());
+        return array;
+    }
+
+    std::tuple<py::array_t<std::uint32_t>, py::array_t<std::int64_t>> tileToArrays(const CircuitLayout& layout, const std::size_t columnBegin, const std::size_t columnEnd, const std::size_t columnResolution,
+                                                                                  const std::size_t lineBegin, const std::optional<std::size_t>& lineEnd, const std::size_t lineResolution) {
+        CircuitLayout::Tile tile;
+        {
+            const py::gil_scoped_release release;
+            tile = layout.tile(columnBegin, columnEnd, columnResolution, lineBegin, lineEnd.value_or(layout.getNqubits()), lineResolution);
+        }
+        const std::vector shape{static_cast<py::ssize_t>(tile.nLineBuckets), static_cast<py::ssize_t>(tile.nColumnBuckets)};
+        return {toArray(tile.counts, shape), toArray(tile.representatives, shape)};
+    }
+
+    // the synthesized circuits are moved into a new Python object instead of exporting and re-importing them
+    qc::QuantumComputation releaseCircuit(const std::shared_ptr<qc::QuantumComputation>& qc) {
+        return qc == nullptr ? qc::QuantumComputation() : std::move(*qc);
+    }
+} // namespace
+
 PYBIND11_MODULE(pysyrec, m) {
     py::module::import("mqt.core.ir");
     m.doc() = "Python interface for the SyReC programming language for the synthesis of reversible circuits";
@@ -33,7 +170,24 @@ PYBIND11_MODULE(pysyrec, m) {
             .def_property_readonly("qubit_labels", &AnnotatableQuantumComputation::getQubitLabels, "Get the label of each qubit in the quantum computation")
             .def("get_quantum_cost_for_synthesis", &AnnotatableQuantumComputation::getQuantumCostForSynthesis, "Get the quantum cost to synthesis the quantum computation")
             .def("get_transistor_cost_for_synthesis", &AnnotatableQuantumComputation::getTransistorCostForSynthesis, "Get the transistor cost to synthesis the quantum computation")
-            .def("get_annotations_of_quantum_operation", &AnnotatableQuantumComputation::getAnnotationsOfQuantumOperation, "quantum_operation_index_in_quantum_operation"_a, "Get the annotations of a specific quantum operation in the quantum computation");
+            .def("get_annotations_of_quantum_operation", &AnnotatableQuantumComputation::getAnnotationsOfQuantumOperation, "quantum_operation_index_in_quantum_operation"_a, "Get the annotations of a specific quantum operation in the quantum computation")
+            .def("memory_report", &AnnotatableQuantumComputation::memoryReport, "Get the memory used by the quantum computation per category");
+
+    py::class_<MemoryReport>(m, "memory_report")
+            .def(py::init<>(), "Constructs an empty memory report.")
+            .def_property_readonly(
+                    "categories", [](const MemoryReport& report) {
+                        std::map<std::string, std::pair<std::size_t, std::size_t>> categories;
+                        for (const auto& [category, usage]: report.getCategories()) {
+                            categories.emplace(category, std::make_pair(usage.bytes, usage.objects));
+                        }
+                        return categories;
+                    },
+                    "Get the pair of bytes and number of objects per category")
+            .def_property_readonly("peak_bytes_per_phase", &MemoryReport::getPeakBytesPerPhase, "Get the peak number of bytes of each recorded phase")
+            .def_property_readonly("total_bytes", &MemoryReport::totalBytes, "Get the number of bytes of all categories")
+            .def_property_readonly("total_objects", &MemoryReport::totalObjects, "Get the number of objects of all categories")
+            .def("__str__", &MemoryReport::toString, "Returns a table of the bytes and objects per category.");
 
     py::class_<NBitValuesContainer>(m, "n_bit_values_container")
             .def(py::init<>(), "Constructs an empty container of size zero.")
@@ -61,18 +215,217 @@ PYBIND11_MODULE(pysyrec, m) {
             .def("set_unsigned", &Properties::set<unsigned>)
             .def("set_double", &Properties::set<double>)
             .def("get_string", py::overload_cast<const std::string&>(&Properties::get<std::string>, py::const_))
-            .def("get_double", py::overload_cast<const std::string&>(&Properties::get<double>, py::const_));
+            .def("get_double", py::overload_cast<const std::string&>(&Properties::get<double>, py::const_))
+            .def("get_memory_report", py::overload_cast<const std::string&>(&Properties::get<MemoryReport>, py::const_));
 
     py::class_<ReadProgramSettings>(m, "read_program_settings")
             .def(py::init<>(), "Constructs ReadProgramSettings object.")
-            .def_readwrite("default_bitwidth", &ReadProgramSettings::defaultBitwidth);
+            .def_readwrite("default_bitwidth", &ReadProgramSettings::defaultBitwidth)
+            .def_readwrite("parallel_parsing", &ReadProgramSettings::parallelParsing)
+            .def_readwrite("n_threads", &ReadProgramSettings::nThreads)
+            .def_readwrite("lazy_loading", &ReadProgramSettings::lazyLoading)
+            .def_readwrite("main_module", &ReadProgramSettings::mainModule);
 
     py::class_<Program>(m, "program")
             .def(py::init<>(), "Constructs SyReC program object.")
             .def("add_module", &Program::addModule)
-            .def("read", &Program::read, "filename"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a file.");
+            .def("read", &Program::read, "filename"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a file.")
+            .def("read_from_string", &Program::readFromString, "content"_a, "settings"_a = ReadProgramSettings{}, "Read a SyReC program from a string.")
+            .def("memory_report", &Program::memoryReport, "Get the memory used by the IR of the program per kind of IR node.")
+            .def_property_readonly("main_module", &Program::mainModule, "Main module the program was loaded for by the lazy loading, empty if it defaults to the module 'main' or the first module.");
 
+    py::class_<TruthTable>(m, "truth_table")
+            .def(py::init<>(), "Constructs an empty truth table.")
+            .def(py::init(&truthTableFromArrays), "inputs"_a, "outputs"_a, "input_care"_a = std::nullopt, "output_care"_a = std::nullopt,
+                 "Constructs a truth table from 0/1 matrices with one row per cube. The entries whose care mask is zero are don't cares. If multiple rows share the same input cube, the first one is kept.")
+            .def_property_readonly("n_inputs", &TruthTable::nInputs, "Get the number of inputs")
+            .def_property_readonly("n_outputs", &TruthTable::nOutputs, "Get the number of outputs")
+            .def_property("constants", py::overload_cast<>(&TruthTable::getConstants, py::const_), &TruthTable::setConstants, "Get or set the constant flags of the inputs")
+            .def_property("garbage", py::overload_cast<>(&TruthTable::getGarbage, py::const_), py::overload_cast<const std::vector<bool>&>(&TruthTable::setGarbage), "Get or set the garbage flags of the outputs")
+            .def("__len__", &TruthTable::size, "Get the number of cubes")
+            .def(
+                    "try_emplace", [](TruthTable& tt, const std::string& input, const std::string& output) {
+                        tt.try_emplace(TruthTable::Cube::fromString(input), TruthTable::Cube::fromString(output));
+                    },
+                    "input"_a, "output"_a, "Add a cube given as strings over 0, 1 and - unless the input cube is already present")
+            .def(
+                    "__getitem__", [](TruthTable& tt, const std::string& input) {
+                        const auto it = tt.find(input);
+                        if (it == tt.end()) {
+                            throw py::key_error(input);
+                        }
+                        return it->second.toString();
+                    },
+                    "input"_a)
+            .def("to_arrays", &truthTableToArrays, "Returns the inputs, outputs, input care mask and output care mask as 0/1 matrices with one row per cube")
+            .def("minimum_additional_lines_required", &TruthTable::minimumAdditionalLinesRequired, py::call_guard<py::gil_scoped_release>(), "Get the number of additional lines required to make the function reversible")
+            .def("memory_report", &TruthTable::memoryReport, "Get the memory used by the truth table per category")
+            .def("__eq__", &TruthTable::operator==)
+            .def_static("equal", &TruthTable::equal, "tt1"_a, "tt2"_a, "equality_up_to_dont_care"_a = true, py::call_guard<py::gil_scoped_release>(), "Check whether two truth tables describe the same function");
+
+    py::class_<CircuitLayout>(m, "circuit_layout")
+            .def(py::init<const qc::QuantumComputation&>(), "quantum_computation"_a, py::call_guard<py::gil_scoped_release>(),
+                 "Place the gates of the quantum computation in columns as soon as possible. A gate occupies all lines between its first and its last qubit.")
+            .def_property_readonly("n_columns", &CircuitLayout::getNcolumns, "Get the number of columns")
+            .def_property_readonly("n_qubits", &CircuitLayout::getNqubits, "Get the number of lines")
+            .def_property_readonly("n_gates", &CircuitLayout::getNgates, "Get the number of gates")
+            .def(
+                    "columns", [](const CircuitLayout& layout) { return toArray(layout.getColumns(), {static_cast<py::ssize_t>(layout.getNgates())}); },
+                    "Get the column of every gate as array")
+            .def("gates_in_column", &CircuitLayout::gatesInColumn, "column"_a, "Get the indices of the gates placed in the column")
+            .def("tile", &tileToArrays, "column_begin"_a, "column_end"_a, "column_resolution"_a = 1U, "line_begin"_a = 0U, "line_end"_a = std::nullopt, "line_resolution"_a = 1U,
+                 "Aggregate the columns [column_begin, column_end) and lines [line_begin, line_end) of the layout into cells of column_resolution columns and line_resolution lines. "
+                 "Returns the number of gates covering each cell and the index of the first gate covering it (-1 for empty cells) as matrices with one row per line bucket.");
+
+    m.def("read_pla", py::overload_cast<TruthTable&, const std::string&>(&readPla), "tt"_a, "filename"_a, py::call_guard<py::gil_scoped_release>(), "Read (and extend) a truth table from a PLA file.");
+    m.def(
+            "parse_pla", [](TruthTable& tt, const std::string& content) {
+                std::istringstream is(content);
+                parsePla(tt, is);
+            },
+            "tt"_a, "content"_a, py::call_guard<py::gil_scoped_release>(), "Parse a truth table from the content of a PLA file (without extending it).");
+    m.def("write_pla", py::overload_cast<const TruthTable&, const std::string&, const PlaWriterSettings&, const Properties::ptr&>(&writePla), "tt"_a, "filename"_a, "settings"_a = PlaWriterSettings{}, "statistics"_a = Properties::ptr(), py::call_guard<py::gil_scoped_release>(), "Write a truth table to a PLA file, merging the cubes with the same output.");
+    m.def(
+            "pla_string", [](const TruthTable& tt, const PlaWriterSettings& settings) {
+                std::ostringstream os;
+                writePla(tt, os, settings);
+                return os.str();
+            },
+            "tt"_a, "settings"_a = PlaWriterSettings{}, py::call_guard<py::gil_scoped_release>(), "Get the content of the PLA file a truth table is written to by write_pla.");
+    m.def("extend", &extend, "tt"_a, py::call_guard<py::gil_scoped_release>(), "Expand the don't care inputs of the truth table and assign the zero output to all missing inputs.");
+    m.def("build_truth_table", &buildTruthTable, "quantum_computation"_a, "tt"_a, py::call_guard<py::gil_scoped_release>(), "Simulate all inputs of a quantum computation to obtain its truth table.");
+    m.def(
+            "encode_with_additional_line", [](TruthTable& tt) {
+                std::map<std::string, std::string> codewords;
+                for (const auto& [pattern, codeword]: encodeWithAdditionalLine(tt)) {
+                    codewords.emplace(pattern.toString(), codeword.toString());
+                }
+                return codewords;
+            },
+            "tt"_a, py::call_guard<py::gil_scoped_release>(), "Huffman-encode the output patterns of the truth table (using an additional line) and return the codeword of each output pattern.");
+    m.def(
+            "minimize_boolean", [](const std::vector<std::string>& cubes) {
+                TruthTable::Cube::Set sigVec;
+                for (const auto& cube: cubes) {
+                    sigVec.emplace(TruthTable::Cube::fromString(cube));
+                }
+                std::vector<std::string> minimized;
+                for (const auto& cube: minbool::minimizeBoolean(sigVec)) {
+                    minimized.emplace_back(cube.toString());
+                }
+                return minimized;
+            },
+            "cubes"_a, py::call_guard<py::gil_scoped_release>(), "Minimize the disjunction of the given (completely specified) cubes.");
+
+    py::class_<PlaWriterSettings>(m, "pla_writer_settings")
+            .def(py::init<>(), "Constructs the default settings of the PLA writer.")
+            .def_readwrite("merge_cubes", &PlaWriterSettings::mergeCubes)
+            .def_readwrite("omit_zero_outputs", &PlaWriterSettings::omitZeroOutputs)
+            .def_readwrite("n_threads", &PlaWriterSettings::nThreads)
+            .def_readwrite("chunk_size", &PlaWriterSettings::chunkSize);
+
+    py::class_<DDPackageTuning>(m, "dd_package_tuning")
+            .def(py::init<>(), "Constructs the default tuning of the DD packages of the synthesis.")
+            .def_readwrite("adaptive_sizing", &DDPackageTuning::adaptiveSizing)
+            .def_readwrite("adaptive_garbage_collection", &DDPackageTuning::adaptiveGarbageCollection)
+            .def_readwrite("min_garbage_collection_interval", &DDPackageTuning::minGarbageCollectionInterval)
+            .def_readwrite("max_garbage_collection_interval", &DDPackageTuning::maxGarbageCollectionInterval)
+            .def_readwrite("min_freed_share", &DDPackageTuning::minFreedShare);
+
+    py::class_<DDBatchSettings>(m, "dd_batch_settings")
+            .def(py::init<>(), "Constructs the default settings of a batch synthesis.")
+            .def_readwrite("coding_techniques", &DDBatchSettings::codingTechniques)
+            .def_readwrite("with_additional_line", &DDBatchSettings::withAdditionalLine)
+            .def_readwrite("garbage_collection_interval", &DDBatchSettings::garbageCollectionInterval)
+            .def_readwrite("n_threads", &DDBatchSettings::nThreads)
+            .def_readwrite("tuning", &DDBatchSettings::tuning);
+
+    py::class_<FunctionalDecompositionSettings>(m, "functional_decomposition_settings")
+            .def(py::init<>(), "Constructs the default settings of the functional decomposition.")
+            .def_readwrite("max_leaf_inputs", &FunctionalDecompositionSettings::maxLeafInputs)
+            .def_readwrite("max_bound_set_size", &FunctionalDecompositionSettings::maxBoundSetSize)
+            .def_readwrite("max_bound_set_candidates", &FunctionalDecompositionSettings::maxBoundSetCandidates)
+            .def_readwrite("max_bound_set_evaluations", &FunctionalDecompositionSettings::maxBoundSetEvaluations)
+            .def_readwrite("n_threads", &FunctionalDecompositionSettings::nThreads)
+            .def_readwrite("verify", &FunctionalDecompositionSettings::verify);
+
+    py::class_<LoopInvariantCodeMotionSettings>(m, "loop_invariant_code_motion_settings")
+            .def(py::init<>(), "Constructs the default settings of the loop-invariant code motion.")
+            .def_readwrite("min_evaluations", &LoopInvariantCodeMotionSettings::minEvaluations)
+            .def_readwrite("measure_savings", &LoopInvariantCodeMotionSettings::measureSavings)
+            .def_readwrite("synthesis_settings", &LoopInvariantCodeMotionSettings::synthesisSettings);
+
+    py::class_<DDSynthesizer>(m, "dd_synthesizer")
+            .def_static(
+                    "synthesize_one_pass", [](const TruthTable& tt, const Properties::ptr& settings, const Properties::ptr& statistics) { return releaseCircuit(DDSynthesizer::synthesizeOnePass(tt, settings, statistics)); },
+                    "tt"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), py::call_guard<py::gil_scoped_release>(), "Synthesize the truth table with the one-pass DD-based synthesis.")
+            .def_static(
+                    "synthesize_coding_techniques", [](const TruthTable& tt, const bool withAdditionalLine, const Properties::ptr& settings, const Properties::ptr& statistics) { return releaseCircuit(DDSynthesizer::synthesizeCodingTechniques(tt, withAdditionalLine, settings, statistics)); },
+                    "tt"_a, "with_additional_line"_a = true, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), py::call_guard<py::gil_scoped_release>(), "Synthesize the truth table with the DD-based synthesis using coding techniques.")
+            .def_static(
+                    "synthesize_batch", [](const std::vector<TruthTable>& tts, const DDBatchSettings& settings) {
+                        std::vector<std::pair<qc::QuantumComputation, double>> results;
+                        for (const auto& result: DDSynthesizer::synthesizeBatch(tts, settings)) {
+                            results.emplace_back(releaseCircuit(result.qc), result.runtime);
+                        }
+                        return results;
+                    },
+                    "tts"_a, "settings"_a = DDBatchSettings{}, py::call_guard<py::gil_scoped_release>(), "Synthesize many truth tables reusing the DD packages and return the circuit and the run-time of each truth table.");
+
+    m.def(
+            "synthesize_decomposed", [](const TruthTable& tt, const FunctionalDecompositionSettings& settings, const Properties::ptr& statistics) -> std::optional<std::tuple<qc::QuantumComputation, std::vector<qc::Qubit>, std::vector<qc::Qubit>>> {
+                auto decomposed = synthesizeDecomposed(tt, settings, statistics);
+                if (!decomposed) {
+                    return std::nullopt;
+                }
+                return std::make_tuple(releaseCircuit(decomposed->qc), std::move(decomposed->inputQubits), std::move(decomposed->outputQubits));
+            },
+            "tt"_a, "settings"_a = FunctionalDecompositionSettings{}, "statistics"_a = Properties::ptr(), py::call_guard<py::gil_scoped_release>(), "Synthesize the truth table by decomposing it into smaller truth tables and return the circuit with the qubits of the inputs and outputs or None.");
     m.def("cost_aware_synthesis", &CostAwareSynthesis::synthesize, "annotated_quantum_computation"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Cost-aware synthesis of the SyReC program.");
     m.def("line_aware_synthesis", &LineAwareSynthesis::synthesize, "annotated_quantum_computation"_a, "program"_a, "settings"_a = Properties::ptr(), "statistics"_a = Properties::ptr(), "Line-aware synthesis of the SyReC program.");
+    m.def("hoist_branch_common_statements", &hoistBranchCommonStatements, "program"_a, "Hoist the statements executed by both branches of the if statements out of the if statements and return the number of hoisted statements.");
+    m.def("hoist_loop_invariant_expressions", &hoistLoopInvariantExpressions, "program"_a, "settings"_a = LoopInvariantCodeMotionSettings{}, "statistics"_a = Properties::ptr(), "Move the loop-invariant expressions out of the for statements and return the number of moved expressions.");
+    m.def(
+            "sequential_simulation", [](const qc::QuantumComputation& quantumComputation, const Program& program, const std::map<std::string, py::array_t<std::uint64_t, py::array::c_style | py::array::forcecast>>& stimuli, const std::size_t nCycles, const std::size_t nStreams, const std::vector<std::string>& recordedSignals, std::string mainModule, const std::size_t nThreads) {
+                if (mainModule.empty()) {
+                    mainModule = program.mainModule();
+                }
+                auto main = program.findModule(mainModule.empty() ? "main" : mainModule);
+                if (!main && mainModule.empty() && !program.modules().empty()) {
+                    main = program.modules().front();
+                }
+                if (!main) {
+                    throw std::invalid_argument("Unknown main module " + mainModule);
+                }
+
+                std::vector<SequentialStimulus> sequentialStimuli;
+                for (const auto& [signal, values]: stimuli) {
+                    if (values.ndim() != 2 || static_cast<std::size_t>(values.shape(1)) != nStreams) {
+                        throw std::invalid_argument("The stimulus of signal " + signal + " must have the shape (cycles, n_streams)");
+                    }
+                    sequentialStimuli.emplace_back(SequentialStimulus{signal, std::vector<std::uint64_t>(values.data(), values.data() + values.size())});
+                }
+                SequentialSimulationSettings settings;
+                settings.nCycles         = nCycles;
+                settings.nStreams        = nStreams;
+                settings.recordedSignals = recordedSignals;
+                settings.nThreads        = nThreads;
+
+                std::optional<SequentialSimulationTrace> trace;
+                {
+                    const py::gil_scoped_release release;
+                    trace = sequentialSimulation(quantumComputation, *main, sequentialStimuli, settings);
+                }
+                if (!trace.has_value()) {
+                    throw std::invalid_argument("The circuit cannot be simulated sequentially with the given signals");
+                }
+                std::map<std::string, py::array_t<std::uint64_t>> values;
+                for (std::size_t i = 0U; i < trace->signals.size(); ++i) {
+                    values.emplace(trace->signals[i], toArray(trace->values[i], {static_cast<py::ssize_t>(nCycles), static_cast<py::ssize_t>(nStreams)}));
+                }
+                return values;
+            },
+            "quantum_computation"_a, "program"_a, "stimuli"_a, "n_cycles"_a, "n_streams"_a = 64U, "recorded_signals"_a = std::vector<std::string>{}, "main_module"_a = "", "n_threads"_a = 0U,
+            "Simulate the circuit synthesized for a program with state variables for several cycles of independent streams and return the values of the recorded signals per cycle and stream.");
     m.def("simple_simulation", &simpleSimulation, "output"_a, "quantum_computation"_a, "input"_a, "statistics"_a = Properties::ptr(), "Simulation of a synthesized SyReC program");
 }
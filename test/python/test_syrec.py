@@ -12,6 +12,7 @@ import json
 from pathlib import Path
 from typing import Any
 
+import numpy as np
 import pytest
 
 from mqt import syrec
@@ -53,6 +54,80 @@ def test_parser(data_line_aware_synthesis: dict[str, Any]) -> None:
         assert not error
 
 
+def test_parallel_parser(data_line_aware_synthesis: dict[str, Any]) -> None:
+    settings = syrec.read_program_settings()
+    settings.parallel_parsing = True
+    settings.n_threads = 2
+    for file_name in data_line_aware_synthesis:
+        sequential = syrec.program()
+        assert not sequential.read(str(circuit_dir / (file_name + ".src")))
+        parallel = syrec.program()
+        assert not parallel.read(str(circuit_dir / (file_name + ".src")), settings)
+
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, parallel)
+        assert annotatable_quantum_computation.num_ops == data_line_aware_synthesis[file_name]["num_gates"]
+
+
+def test_lazy_loading(data_line_aware_synthesis: dict[str, Any]) -> None:
+    settings = syrec.read_program_settings()
+    settings.lazy_loading = True
+    for file_name in data_line_aware_synthesis:
+        prog = syrec.program()
+        assert not prog.read(str(circuit_dir / (file_name + ".src")), settings)
+
+        annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+        assert syrec.line_aware_synthesis(annotatable_quantum_computation, prog)
+        assert annotatable_quantum_computation.num_ops == data_line_aware_synthesis[file_name]["num_gates"]
+
+
+def test_read_from_string() -> None:
+    settings = syrec.read_program_settings()
+    settings.lazy_loading = True
+    settings.main_module = "inc"
+    prog = syrec.program()
+    assert not prog.read_from_string("module inc(inout a(2))\n  ++= a\nmodule dec(inout b(2))\n  --= b\n", settings)
+    assert prog.main_module == "inc"
+    assert "Unknown module" in syrec.program().read_from_string("module main(inout a(2))\n  call f(a)\n")
+
+
+def test_hoist_branch_common_statements() -> None:
+    original = syrec.program()
+    assert not original.read(str(circuit_dir / "if_common_statements_4.src"))
+    hoisted = syrec.program()
+    assert not hoisted.read(str(circuit_dir / "if_common_statements_4.src"))
+    assert syrec.hoist_branch_common_statements(hoisted) == 2
+
+    original_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(original_quantum_computation, original)
+    hoisted_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(hoisted_quantum_computation, hoisted)
+    assert (
+        hoisted_quantum_computation.get_quantum_cost_for_synthesis()
+        < original_quantum_computation.get_quantum_cost_for_synthesis()
+    )
+
+
+def test_hoist_loop_invariant_expressions() -> None:
+    original = syrec.program()
+    assert not original.read(str(circuit_dir / "for_invariant_4.src"))
+    moved = syrec.program()
+    assert not moved.read(str(circuit_dir / "for_invariant_4.src"))
+    settings = syrec.loop_invariant_code_motion_settings()
+    statistics = syrec.properties()
+    assert syrec.hoist_loop_invariant_expressions(moved, settings, statistics) == 2
+    assert statistics.get_double("runtime") >= 0
+
+    original_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(original_quantum_computation, original)
+    moved_quantum_computation = syrec.annotatable_quantum_computation()
+    assert syrec.cost_aware_synthesis(moved_quantum_computation, moved)
+    assert (
+        moved_quantum_computation.get_quantum_cost_for_synthesis()
+        < original_quantum_computation.get_quantum_cost_for_synthesis()
+    )
+
+
 def test_synthesis_no_lines(data_line_aware_synthesis: dict[str, Any]) -> None:
     for file_name in data_line_aware_synthesis:
         annotatable_quantum_computation = syrec.annotatable_quantum_computation()
@@ -155,3 +230,170 @@ def test_no_lines_to_qasm(data_line_aware_synthesis: dict[str, Any]) -> None:
 
         annotatable_quantum_computation.qasm3(str(expected_qasm_file_path))
         assert Path.is_file(expected_qasm_file_path)
+
+
+def test_memory_report() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    error = prog.read(str(circuit_dir / "alu_2.src"))
+    assert not error
+
+    settings = syrec.properties()
+    settings.set_bool("memory_report", True)
+    statistics = syrec.properties()
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog, settings, statistics)
+
+    report = statistics.get_memory_report("memory_report")
+    assert report.categories["qc.operations"][1] == annotatable_quantum_computation.num_ops
+    assert report.total_bytes >= prog.memory_report().total_bytes
+    assert [phase for phase, _ in report.peak_bytes_per_phase] == ["variables", "statements"]
+    assert "qc.operations" in str(annotatable_quantum_computation.memory_report())
+
+
+def test_truth_table_synthesis() -> None:
+    tt = syrec.truth_table()
+    assert syrec.read_pla(tt, str(circuit_dir / "hwb4_12.pla"))
+    assert (tt.n_inputs, tt.n_outputs, len(tt)) == (4, 4, 16)
+
+    qc = syrec.dd_synthesizer.synthesize_one_pass(tt)
+    assert qc.num_qubits == 4
+    simulated = syrec.truth_table()
+    syrec.build_truth_table(qc, simulated)
+    assert syrec.truth_table.equal(tt, simulated)
+
+    inputs, outputs, input_care, output_care = tt.to_arrays()
+    assert inputs.shape == outputs.shape == (16, 4)
+    assert input_care.all()
+    assert output_care.all()
+    assert syrec.truth_table(inputs, outputs) == tt
+
+    settings = syrec.dd_batch_settings()
+    settings.n_threads = 2
+    settings.tuning.adaptive_garbage_collection = True
+    settings.tuning.max_garbage_collection_interval = 16
+    results = syrec.dd_synthesizer.synthesize_batch([tt, simulated], settings)
+    assert [circuit.num_ops for circuit, _ in results] == [qc.num_ops, qc.num_ops]
+
+
+def test_dd_package_tuning() -> None:
+    tt = syrec.truth_table()
+    assert syrec.read_pla(tt, str(circuit_dir / "hwb4_12.pla"))
+
+    settings = syrec.properties()
+    settings.set_bool("dd_adaptive_sizing", False)
+    settings.set_bool("dd_adaptive_garbage_collection", True)
+    settings.set_unsigned("dd_max_garbage_collection_interval", 8)
+    statistics = syrec.properties()
+    qc = syrec.dd_synthesizer.synthesize_one_pass(tt, settings, statistics)
+    assert statistics.get_double("runtime") >= 0
+    assert 0 <= statistics.get_double("dd_multiplication_hit_ratio") <= 1
+
+    # the tuning does not change the synthesized circuit
+    assert qc.num_ops == syrec.dd_synthesizer.synthesize_one_pass(tt).num_ops
+    simulated = syrec.truth_table()
+    syrec.build_truth_table(qc, simulated)
+    assert syrec.truth_table.equal(tt, simulated)
+
+
+def test_decomposed_synthesis() -> None:
+    tt = syrec.truth_table()
+    assert syrec.read_pla(tt, str(circuit_dir / "hwb4_12.pla"))
+
+    settings = syrec.functional_decomposition_settings()
+    settings.max_leaf_inputs = 2
+    settings.n_threads = 2
+    statistics = syrec.properties()
+    result = syrec.synthesize_decomposed(tt, settings, statistics)
+    assert result is not None
+    qc, input_qubits, output_qubits = result
+    assert len(input_qubits) == len(output_qubits) == 4
+    assert qc.num_qubits >= 4
+    assert statistics.get_double("runtime") >= 0
+
+
+def test_write_pla(tmp_path: Path) -> None:
+    tt = syrec.truth_table()
+    assert syrec.read_pla(tt, str(circuit_dir / "and.pla"))
+    assert syrec.pla_string(tt) == ".i 2\n.o 1\n.p 3\n-0 0\n01 0\n11 1\n.e\n"
+
+    settings = syrec.pla_writer_settings()
+    settings.omit_zero_outputs = True
+    settings.n_threads = 2
+    filename = str(tmp_path / "and.pla")
+    assert syrec.write_pla(tt, filename, settings)
+    read_back = syrec.truth_table()
+    assert syrec.read_pla(read_back, filename)
+    assert read_back == tt
+
+
+def test_truth_table_from_arrays() -> None:
+    # the second input of the first row is a don't care, the output of the second row is unspecified
+    inputs = np.array([[0, 0], [1, 1]], dtype=bool)
+    input_care = np.array([[1, 0], [1, 1]], dtype=np.uint8)
+    outputs = np.array([[1], [0]], dtype=np.uint8)
+    output_care = np.array([[1], [0]], dtype=np.uint8)
+    tt = syrec.truth_table(inputs, outputs, input_care=input_care, output_care=output_care)
+    assert tt["0-"] == "1"
+    assert tt["11"] == "-"
+
+    syrec.extend(tt)
+    assert len(tt) == 4
+    assert tt["01"] == "1"
+    assert tt["10"] == "0"
+
+    with pytest.raises(ValueError, match="output care mask"):
+        syrec.truth_table(inputs, outputs, output_care=np.ones((3, 1), dtype=np.uint8))
+
+    # the function is not reversible, thus the output patterns are encoded
+    codewords = syrec.encode_with_additional_line(tt)
+    assert "1" in codewords
+    assert syrec.minimize_boolean(["00", "01"]) == ["0-"]
+
+
+def test_circuit_layout() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read(str(circuit_dir / "alu_2.src"))
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    layout = syrec.circuit_layout(annotatable_quantum_computation)
+    assert layout.n_gates == annotatable_quantum_computation.num_ops
+    assert layout.n_qubits == annotatable_quantum_computation.num_qubits
+    assert 0 < layout.n_columns <= layout.n_gates
+    columns = layout.columns()
+    assert columns.shape == (layout.n_gates,)
+    assert sorted(gate for column in range(layout.n_columns) for gate in layout.gates_in_column(column)) == list(
+        range(layout.n_gates)
+    )
+
+    counts, representatives = layout.tile(0, layout.n_columns)
+    assert counts.shape == representatives.shape == (layout.n_qubits, layout.n_columns)
+    assert counts.max() == 1
+    assert ((counts == 0) == (representatives == -1)).all()
+
+    # aggregating all columns of a line yields the number of gates covering the line
+    aggregated, _ = layout.tile(0, layout.n_columns, column_resolution=layout.n_columns)
+    assert aggregated.shape == (layout.n_qubits, 1)
+    assert (aggregated[:, 0] == counts.sum(axis=1)).all()
+
+    with pytest.raises(ValueError, match="resolution"):
+        layout.tile(0, layout.n_columns, column_resolution=0)
+
+
+def test_sequential_simulation() -> None:
+    annotatable_quantum_computation = syrec.annotatable_quantum_computation()
+    prog = syrec.program()
+    assert not prog.read(str(circuit_dir / "accumulator_4.src"))
+    assert syrec.cost_aware_synthesis(annotatable_quantum_computation, prog)
+
+    # the state variable s accumulates the inputs of all cycles
+    inputs = np.arange(10 * 3, dtype=np.uint64).reshape(10, 3) % 16
+    values = syrec.sequential_simulation(
+        annotatable_quantum_computation, prog, {"a": inputs}, n_cycles=10, n_streams=3, recorded_signals=["y", "s"]
+    )
+    expected = np.cumsum(inputs, axis=0) % 16
+    assert (values["s"] == expected).all()
+    assert (values["y"] == expected).all()
+
+    with pytest.raises(ValueError, match="shape"):
+        syrec.sequential_simulation(annotatable_quantum_computation, prog, {"a": inputs}, n_cycles=10, n_streams=4)
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "algorithms/simulation/sharded_verification.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+
+// Helpers shared by the tests of the circuit optimizations
+namespace syrec::optimization_test {
+    // quantum cost of the gates of an (optimized) circuit, computed like AnnotatableQuantumComputation::getQuantumCostForSynthesis
+    inline std::uint64_t quantumCost(const qc::QuantumComputation& quantumComputation) {
+        std::uint64_t cost = 0U;
+        for (const auto& op: quantumComputation) {
+            cost += AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(op->getNcontrols(), op->getType(), quantumComputation.getNqubits());
+        }
+        return cost;
+    }
+
+    // exhaustive verification of the optimized circuit against the original one, the shards are written to (and removed from) the given directory
+    inline bool equivalent(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference, const std::string& directory) {
+        ShardedVerificationSettings settings;
+        settings.directory = directory;
+        const auto report  = verifyExhaustively(circuit, reference, settings);
+        std::filesystem::remove_all(settings.directory);
+        return report.equivalent();
+    }
+} // namespace syrec::optimization_test
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/encoding.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/bdd_package.hpp"
+#include "core/truthTable/bdd_truth_table.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "dd/Package.hpp"
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace syrec;
+
+// all of the following pla files consist of non-overlapping cubes only, i.e., the TruthTable and the BddTruthTable describe the same function.
+class TestBddTruthTable: public testing::TestWithParam<std::string> {
+protected:
+    TruthTable    tt{};
+    BddTruthTable bddTT{};
+    TruthTable    ttqc{};
+    std::string   testCircuitsDir = "./circuits/";
+    std::string   fileName;
+
+    void SetUp() override {
+        fileName = testCircuitsDir + GetParam() + ".pla";
+        ASSERT_TRUE(readPla(tt, fileName));
+        ASSERT_TRUE(readPla(bddTT, fileName));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(BddTruthTable, TestBddTruthTable,
+                         testing::Values(
+                                 "3_17_6",
+                                 "4_49_7",
+                                 "hwb4_12",
+                                 "hwb5_13",
+                                 "graycode",
+                                 "urf2",
+                                 "rd84",
+                                 "life",
+                                 "dc3bit",
+                                 "dcX4bit",
+                                 "huff_31",
+                                 "sym6_32",
+                                 "counter",
+                                 "4gt10",
+                                 "4mod5",
+                                 "aludc",
+                                 "minialu",
+                                 "decode24"),
+                         [](const testing::TestParamInfo<TestBddTruthTable::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(TestBddTruthTable, Dimensions) {
+    EXPECT_EQ(bddTT.nInputs(), tt.nInputs());
+    EXPECT_EQ(bddTT.nOutputs(), tt.nOutputs());
+    EXPECT_EQ(bddTT.getConstants(), tt.getConstants());
+    EXPECT_EQ(bddTT.getGarbage(), tt.getGarbage());
+}
+
+TEST_P(TestBddTruthTable, MinimumAdditionalLines) {
+    EXPECT_EQ(bddTT.minimumAdditionalLinesRequired(), tt.minimumAdditionalLinesRequired());
+}
+
+TEST_P(TestBddTruthTable, SameDDAsExtendedTruthTable) {
+    const auto nBits = std::max(tt.nInputs(), tt.nOutputs());
+    augmentWithConstants(tt, nBits, true);
+    augmentWithConstants(bddTT, nBits, true);
+
+    EXPECT_EQ(bddTT.getConstants(), tt.getConstants());
+    EXPECT_EQ(bddTT.getGarbage(), tt.getGarbage());
+
+    auto       dd    = std::make_unique<dd::Package>(nBits);
+    const auto ttDD  = buildDD(tt, dd);
+    const auto bddDD = buildDD(bddTT, dd);
+    EXPECT_TRUE(ttDD == bddDD);
+}
+
+TEST_P(TestBddTruthTable, OnePassSynthesis) {
+    const auto& qc = DDSynthesizer::synthesizeOnePass(bddTT);
+
+    buildTruthTable(*qc, ttqc);
+
+    EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+    EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+}
+
+TEST_P(TestBddTruthTable, EqualAcrossPackages) {
+    BddTruthTable other{std::make_shared<BddPackage>()};
+    ASSERT_TRUE(readPla(other, fileName));
+
+    const auto packageSize = bddTT.getPackage()->size();
+    const auto otherSize   = other.getPackage()->size();
+    EXPECT_TRUE(BddTruthTable::equal(bddTT, other));
+    EXPECT_TRUE(BddTruthTable::equal(other, bddTT, false));
+    EXPECT_EQ(bddTT.getPackage()->size(), packageSize);
+    EXPECT_EQ(other.getPackage()->size(), otherSize);
+
+    // setting the first output for the all-zero input (before the cubes of the pla) changes the function unless it is a don't care there
+    TruthTable::Cube zeroInput(bddTT.nInputs(), false);
+    const auto&      expected = tt.find(zeroInput)->second;
+    TruthTable::Cube output   = expected;
+    output[0]                 = true;
+    BddTruthTable flipped{};
+    flipped.try_emplace(zeroInput, output);
+    ASSERT_TRUE(readPla(flipped, fileName));
+    if (expected[0].has_value() && !*expected[0]) {
+        EXPECT_FALSE(BddTruthTable::equal(bddTT, flipped));
+    } else {
+        EXPECT_TRUE(BddTruthTable::equal(bddTT, flipped));
+    }
+}
+
+TEST(BddTruthTableOverlap, OutputsOfOverlappingCubesAreOred) {
+    BddTruthTable bddTT{};
+    bddTT.try_emplace(TruthTable::Cube::fromString("1-"), TruthTable::Cube::fromString("10"));
+    bddTT.try_emplace(TruthTable::Cube::fromString("11"), TruthTable::Cube::fromString("01"));
+    bddTT.try_emplace(TruthTable::Cube::fromString("-1"), TruthTable::Cube::fromString("-1"));
+
+    // the input 11 is covered by all cubes and the second output of the input 01 is left unspecified by the only cube covering it
+    const auto frequencies = bddTT.outputPatternFrequencies();
+    ASSERT_EQ(frequencies.size(), 4U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("10")), 1U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("11")), 1U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("-1")), 1U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("00")), 1U);
+}
+
+TEST(BddTruthTableOverlap, SameDDAsExtendedTruthTable) {
+    // the complete cubes overlap the preceding cubes with don't care inputs
+    const auto         input = std::string(".i 2\n.o 2\n1- 10\n11 01\n0- 01\n01 10\n.e\n");
+    TruthTable         tt{};
+    std::istringstream ttStream(input);
+    parsePla(tt, ttStream);
+    extend(tt);
+    EXPECT_EQ(tt.find(TruthTable::Cube::fromString("11"))->second, TruthTable::Cube::fromString("11"));
+    EXPECT_EQ(tt.find(TruthTable::Cube::fromString("01"))->second, TruthTable::Cube::fromString("11"));
+
+    BddTruthTable      bddTT{};
+    std::istringstream bddStream(input);
+    parsePla(bddTT, bddStream);
+
+    augmentWithConstants(tt, 2U, true);
+    augmentWithConstants(bddTT, 2U, true);
+    auto       dd    = std::make_unique<dd::Package>(2U);
+    const auto ttDD  = buildDD(tt, dd);
+    const auto bddDD = buildDD(bddTT, dd);
+    EXPECT_TRUE(ttDD == bddDD);
+}
+
+TEST(BddTruthTableLarge, Max) {
+    // the max.pla consists of 64 inputs, which cannot be stored in an extended TruthTable.
+    BddTruthTable bddTT{};
+    EXPECT_TRUE(readPla(bddTT, "./circuits/max.pla"));
+    EXPECT_EQ(bddTT.nInputs(), 64U);
+    EXPECT_EQ(bddTT.nOutputs(), 1U);
+
+    // a single cube is represented by one node per specified input
+    const auto& package = bddTT.getPackage();
+    EXPECT_EQ(package->size(), 2U + 64U);
+    EXPECT_EQ(bddTT.onSet(0), package->fromCube(TruthTable::Cube::fromString("1111111111111111000000000000000000000000000000001111111111111111")));
+    EXPECT_EQ(bddTT.dontCareSet(0), BddPackage::ZERO);
+
+    // all but one of the 2^64 inputs are mapped to zero
+    const auto frequencies = bddTT.outputPatternFrequencies();
+    ASSERT_EQ(frequencies.size(), 2U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("0")), ~0ULL);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("1")), 1U);
+    EXPECT_EQ(bddTT.minimumAdditionalLinesRequired(), 64U);
+
+    // with another input, the number of inputs mapped to zero does not fit into 64 bits anymore
+    BddTruthTable wide{};
+    wide.try_emplace(TruthTable::Cube::fromString(std::string(65U, '1')), TruthTable::Cube::fromString("1"));
+    EXPECT_THROW(static_cast<void>(wide.outputPatternFrequencies()), std::invalid_argument);
+    EXPECT_EQ(wide.minimumAdditionalLinesRequired(), 65U);
+}
+
+TEST(BddTruthTableLarge, ManyInputs) {
+    // 40 inputs and a single don't care cube
+    BddTruthTable bddTT{};
+    bddTT.try_emplace(TruthTable::Cube::fromString("1---------------------------------------"), TruthTable::Cube::fromString("1-"));
+    bddTT.try_emplace(TruthTable::Cube::fromString("01--------------------------------------"), TruthTable::Cube::fromString("01"));
+
+    const auto frequencies = bddTT.outputPatternFrequencies();
+    ASSERT_EQ(frequencies.size(), 3U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("1-")), 1ULL << 39U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("01")), 1ULL << 38U);
+    EXPECT_EQ(frequencies.at(TruthTable::Cube::fromString("00")), 1ULL << 38U);
+    EXPECT_EQ(bddTT.minimumAdditionalLinesRequired(), 39U);
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/syrec/binary_program.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    std::vector<unsigned> lineNumbers(const Program& program) {
+        std::vector<unsigned> lines;
+        for (const auto& module: program.modules()) {
+            for (const auto& statement: module->statements) {
+                lines.emplace_back(statement->lineNumber);
+            }
+        }
+        return lines;
+    }
+} // namespace
+
+class BinaryProgramTest: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+    std::string fileName;
+    Program     program;
+
+    void SetUp() override {
+        fileName                       = testCircuitsDir + GetParam() + ".src";
+        const std::string errorMessage = program.read(fileName);
+        ASSERT_TRUE(errorMessage.empty()) << errorMessage;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecBinaryProgram, BinaryProgramTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "call_8",
+                                 "divide_2",
+                                 "for_4",
+                                 "gray_binary_conversion_16",
+                                 "input_repeated_2",
+                                 "logical_and_1",
+                                 "modulo_2",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "parity_check_16",
+                                 "shift_4",
+                                 "skip",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<BinaryProgramTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(BinaryProgramTest, RoundTrip) {
+    std::stringstream binary;
+    ASSERT_TRUE(writeBinaryProgram(program, 42U, binary));
+
+    Program           loaded;
+    const std::string errorMessage = readBinaryProgram(loaded, binary, 42U);
+    ASSERT_TRUE(errorMessage.empty()) << errorMessage;
+    ASSERT_EQ(loaded.modules().size(), program.modules().size());
+    for (std::size_t i = 0U; i < program.modules().size(); ++i) {
+        EXPECT_EQ(loaded.modules()[i]->name, program.modules()[i]->name);
+        EXPECT_EQ(loaded.modules()[i]->parameters.size(), program.modules()[i]->parameters.size());
+    }
+    EXPECT_EQ(lineNumbers(loaded), lineNumbers(program));
+
+    // the loaded IR is serialized to the very same binary
+    std::stringstream reserialized;
+    ASSERT_TRUE(writeBinaryProgram(loaded, 42U, reserialized));
+    EXPECT_EQ(reserialized.str(), binary.str());
+
+    AnnotatableQuantumComputation expected;
+    AnnotatableQuantumComputation actual;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(expected, program));
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(actual, loaded));
+    EXPECT_EQ(actual.getNops(), expected.getNops());
+    EXPECT_EQ(actual.getNqubits(), expected.getNqubits());
+    EXPECT_EQ(actual.getQuantumCostForSynthesis(), expected.getQuantumCostForSynthesis());
+    EXPECT_EQ(actual.getTransistorCostForSynthesis(), expected.getTransistorCostForSynthesis());
+}
+
+TEST_P(BinaryProgramTest, RejectsCorruptedBinaries) {
+    std::stringstream binary;
+    ASSERT_TRUE(writeBinaryProgram(program, 42U, binary));
+    const auto content = binary.str();
+
+    std::stringstream outdated(content);
+    Program           outdatedProgram;
+    EXPECT_FALSE(readBinaryProgram(outdatedProgram, outdated, 43U).empty());
+    EXPECT_TRUE(outdatedProgram.modules().empty());
+
+    for (std::size_t length = 0U; length < content.size(); ++length) {
+        std::stringstream truncated(content.substr(0U, length));
+        Program           truncatedProgram;
+        EXPECT_FALSE(readBinaryProgram(truncatedProgram, truncated).empty()) << "accepted a binary truncated to " << length << " bytes";
+        EXPECT_TRUE(truncatedProgram.modules().empty());
+    }
+}
+
+TEST(BinaryProgramCacheTest, ParsesOnlyIfSourceChanged) {
+    const std::string sourceFileName = "./binary_program_cache_test.src";
+    const std::string cacheFileName  = "./binary_program_cache_test.ir";
+    std::remove(cacheFileName.c_str());
+
+    std::ofstream source(sourceFileName);
+    source << "module main(inout a(4), in b(4))\n"
+              "  a += b;\n"
+              "  skip\n";
+    source.close();
+
+    Program parsed;
+    ASSERT_TRUE(readProgramWithCache(parsed, sourceFileName, cacheFileName).empty());
+    EXPECT_EQ(lineNumbers(parsed), (std::vector<unsigned>{2U, 3U}));
+    EXPECT_TRUE(std::ifstream(cacheFileName).good());
+
+    Program cached;
+    ASSERT_TRUE(readBinaryProgram(cached, cacheFileName).empty());
+    EXPECT_EQ(lineNumbers(cached), (std::vector<unsigned>{2U, 3U}));
+
+    // a different default bit-width results in a different IR, thus the cache must not be used
+    std::ifstream     sourceContent(sourceFileName);
+    std::stringstream content;
+    content << sourceContent.rdbuf();
+    Program stale;
+    EXPECT_FALSE(readBinaryProgram(stale, cacheFileName, sourceHash(content.str(), ReadProgramSettings{16U})).empty());
+    Program current;
+    EXPECT_TRUE(readBinaryProgram(current, cacheFileName, sourceHash(content.str())).empty());
+
+    // changing the source invalidates the cache
+    source.open(sourceFileName);
+    source << "module main(inout a(4), in b(4))\n"
+              "  skip;\n"
+              "  a ^= b\n";
+    source.close();
+
+    Program reparsed;
+    ASSERT_TRUE(readProgramWithCache(reparsed, sourceFileName, cacheFileName).empty());
+    ASSERT_EQ(reparsed.modules().size(), 1U);
+    ASSERT_EQ(reparsed.modules().front()->statements.size(), 2U);
+    EXPECT_NE(std::dynamic_pointer_cast<AssignStatement>(reparsed.modules().front()->statements.back()), nullptr);
+
+    Program recached;
+    ASSERT_TRUE(readProgramWithCache(recached, sourceFileName, cacheFileName).empty());
+    ASSERT_EQ(recached.modules().size(), 1U);
+    EXPECT_EQ(lineNumbers(recached), lineNumbers(reparsed));
+
+    std::remove(sourceFileName.c_str());
+    std::remove(cacheFileName.c_str());
+}
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "algorithms/simulation/circuit_compression.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <variant>
+#include <vector>
+
+using namespace syrec;
+using namespace qc::literals;
+
+namespace {
+    // simulate the circuit and the compressed circuit for random assignments of all qubits
+    void expectSameSimulation(const qc::QuantumComputation& quantumComputation, const CompressedCircuit& compressed) {
+        const auto gates = compileBitParallel(quantumComputation);
+        ASSERT_TRUE(gates.has_value());
+
+        std::mt19937_64 rng(0U);
+        for (std::size_t block = 0U; block < 16U; ++block) {
+            std::vector<std::uint64_t> state(quantumComputation.getNqubits());
+            std::generate(state.begin(), state.end(), rng);
+            auto compressedState = state;
+            simulateBitParallel(*gates, state);
+            simulateBitParallel(compressed, compressedState);
+            EXPECT_EQ(compressedState, state);
+        }
+    }
+} // namespace
+
+TEST(CircuitCompressionTest, SharesSequencesOnShiftedQubits) {
+    qc::QuantumComputation quantumComputation(8U);
+    for (qc::Qubit offset = 0U; offset < 6U; offset += 2U) {
+        quantumComputation.cx(qc::Control{offset}, offset + 1U);
+        quantumComputation.mcx({qc::Control{offset}, qc::Control{offset + 1U, qc::Control::Type::Neg}}, offset + 2U);
+        quantumComputation.swap(offset, offset + 2U);
+        quantumComputation.x(offset + 1U);
+        // separates the repetitions
+        quantumComputation.x(7U);
+    }
+
+    CircuitCompressionSettings settings;
+    settings.minSequenceLength = 4U;
+    settings.maxSequenceLength = 4U;
+    const auto statistics      = std::make_shared<Properties>();
+    const auto compressed      = compressCircuit(quantumComputation, settings, statistics);
+    ASSERT_TRUE(compressed.has_value());
+
+    ASSERT_EQ(compressed->subroutines.size(), 1U);
+    EXPECT_EQ(compressed->subroutines.front().nQubits, 3U);
+    EXPECT_EQ(compressed->subroutines.front().gates.size(), 4U);
+    ASSERT_EQ(compressed->body.size(), 6U);
+    for (std::size_t i = 0U; i < compressed->body.size(); i += 2U) {
+        ASSERT_TRUE(std::holds_alternative<CompressedCircuit::Call>(compressed->body[i]));
+        const auto offset = static_cast<qc::Qubit>(i);
+        EXPECT_EQ(std::get<CompressedCircuit::Call>(compressed->body[i]).remap, (std::vector<qc::Qubit>{offset, offset + 1U, offset + 2U}));
+    }
+
+    EXPECT_EQ(statistics->get<std::size_t>("subroutines"), 1U);
+    EXPECT_EQ(statistics->get<std::size_t>("calls"), 3U);
+    EXPECT_DOUBLE_EQ(statistics->get<double>("compression_ratio"), 15. / 10.);
+    EXPECT_EQ(compressed->expandedSize(), quantumComputation.getNops());
+    EXPECT_EQ(compressed->compressedSize(), 10U);
+    EXPECT_EQ(compressed->expand(), *compileBitParallel(quantumComputation));
+    expectSameSimulation(quantumComputation, *compressed);
+}
+
+TEST(CircuitCompressionTest, WritesAndReadsCompressedCircuits) {
+    qc::QuantumComputation quantumComputation(6U);
+    for (qc::Qubit offset = 0U; offset < 4U; ++offset) {
+        quantumComputation.mcx({qc::Control{offset}, qc::Control{offset + 1U, qc::Control::Type::Neg}}, offset + 2U);
+        quantumComputation.cx(qc::Control{offset + 2U}, offset);
+    }
+    const auto compressed = compressCircuit(quantumComputation);
+    ASSERT_TRUE(compressed.has_value());
+    ASSERT_FALSE(compressed->subroutines.empty());
+
+    std::stringstream stream;
+    ASSERT_TRUE(writeCompressedCircuit(*compressed, stream));
+    CompressedCircuit read;
+    ASSERT_EQ(readCompressedCircuit(read, stream), "");
+    EXPECT_EQ(read.nQubits, compressed->nQubits);
+    EXPECT_EQ(read.compressedSize(), compressed->compressedSize());
+    EXPECT_EQ(read.expand(), compressed->expand());
+
+    std::stringstream invalidCall("syrec-compressed-circuit 1\nqubits 2\nsubroutines 1\nsubroutine 2 1\nx 0 1+\nbody 1\ncall 0 1 1\n");
+    EXPECT_NE(readCompressedCircuit(read, invalidCall), "");
+    std::stringstream invalidGate("syrec-compressed-circuit 1\nqubits 2\nsubroutines 0\nbody 1\ngate x 2\n");
+    EXPECT_NE(readCompressedCircuit(read, invalidGate), "");
+    std::stringstream invalidHeader("syrec-compressed-circuit 2\n");
+    EXPECT_NE(readCompressedCircuit(read, invalidHeader), "");
+    // a failed read does not modify the circuit
+    EXPECT_EQ(read.expand(), compressed->expand());
+}
+
+TEST(CircuitCompressionTest, RejectsUnsupportedGates) {
+    qc::QuantumComputation quantumComputation(1U);
+    quantumComputation.h(0U);
+    EXPECT_FALSE(compressCircuit(quantumComputation).has_value());
+}
+
+class CircuitCompressionSynthesisTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(CircuitCompression, CircuitCompressionSynthesisTest,
+                         testing::Values(
+                                 "call_8",
+                                 "for_4",
+                                 "for_32",
+                                 "gray_binary_conversion_16",
+                                 "parity_check_16"),
+                         [](const testing::TestParamInfo<CircuitCompressionSynthesisTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(CircuitCompressionSynthesisTest, PreservesFunctionality) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/" + GetParam() + ".src").empty());
+    AnnotatableQuantumComputation synthesized;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesized, program));
+
+    const auto statistics = std::make_shared<Properties>();
+    const auto compressed = compressCircuit(synthesized, CircuitCompressionSettings{}, statistics);
+    ASSERT_TRUE(compressed.has_value());
+    EXPECT_GE(statistics->get<double>("compression_ratio"), 1.);
+    EXPECT_EQ(compressed->expand(), *compileBitParallel(synthesized));
+    expectSameSimulation(synthesized, *compressed);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/circuit_layout.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+
+using namespace syrec;
+using namespace qc::literals;
+
+class CircuitLayoutTest: public testing::Test {
+protected:
+    qc::QuantumComputation quantumComputation{4U};
+
+    void SetUp() override {
+        quantumComputation.x(0U);
+        quantumComputation.cx(2_pc, 3U);
+        quantumComputation.mcx({0_pc, 2_pc}, 1U);
+        quantumComputation.x(3U);
+        quantumComputation.swap(0U, 1U);
+        quantumComputation.x(2U);
+    }
+};
+
+TEST_F(CircuitLayoutTest, PlacesGatesAsSoonAsPossible) {
+    const CircuitLayout layout(quantumComputation);
+    EXPECT_EQ(layout.getNqubits(), 4U);
+    EXPECT_EQ(layout.getNgates(), 6U);
+    EXPECT_EQ(layout.getNcolumns(), 3U);
+    EXPECT_EQ(layout.getColumns(), (std::vector<std::size_t>{0U, 0U, 1U, 1U, 2U, 2U}));
+    EXPECT_EQ(layout.getFirstLines(), (std::vector<qc::Qubit>{0U, 2U, 0U, 3U, 0U, 2U}));
+    EXPECT_EQ(layout.getLastLines(), (std::vector<qc::Qubit>{0U, 3U, 2U, 3U, 1U, 2U}));
+    EXPECT_EQ(layout.gatesInColumn(1U), (std::vector<std::size_t>{2U, 3U}));
+    EXPECT_TRUE(layout.gatesInColumn(3U).empty());
+}
+
+TEST_F(CircuitLayoutTest, TileAtFullResolution) {
+    const CircuitLayout layout(quantumComputation);
+    const auto          tile = layout.tile(0U, layout.getNcolumns());
+    EXPECT_EQ(tile.nColumnBuckets, 3U);
+    EXPECT_EQ(tile.nLineBuckets, 4U);
+    EXPECT_EQ(tile.counts, (std::vector<std::uint32_t>{1U, 1U, 1U, 0U, 1U, 1U, 1U, 1U, 1U, 1U, 1U, 0U}));
+    EXPECT_EQ(tile.representatives, (std::vector<std::int64_t>{0, 2, 4, CircuitLayout::NO_GATE, 2, 4, 1, 2, 5, 1, 3, CircuitLayout::NO_GATE}));
+}
+
+TEST_F(CircuitLayoutTest, AggregatesColumnsAndLines) {
+    const CircuitLayout layout(quantumComputation);
+    const auto          tile = layout.tile(0U, layout.getNcolumns(), 2U, 0U, layout.getNqubits(), 2U);
+    EXPECT_EQ(tile.nColumnBuckets, 2U);
+    EXPECT_EQ(tile.nLineBuckets, 2U);
+    // a gate covering several lines of a cell is only counted once
+    EXPECT_EQ(tile.counts, (std::vector<std::uint32_t>{2U, 1U, 3U, 1U}));
+    EXPECT_EQ(tile.representatives, (std::vector<std::int64_t>{0, 4, 1, 5}));
+}
+
+TEST_F(CircuitLayoutTest, ClipsAndValidatesRanges) {
+    const CircuitLayout layout(quantumComputation);
+    const auto          tile = layout.tile(2U, 100U, 1U, 3U);
+    EXPECT_EQ(tile.nColumnBuckets, 1U);
+    EXPECT_EQ(tile.nLineBuckets, 1U);
+    EXPECT_EQ(tile.counts, std::vector<std::uint32_t>{0U});
+    EXPECT_EQ(tile.representatives, std::vector<std::int64_t>{CircuitLayout::NO_GATE});
+
+    EXPECT_TRUE(layout.tile(5U, 10U).counts.empty());
+    EXPECT_THROW(static_cast<void>(layout.tile(1U, 1U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(layout.tile(0U, 1U, 0U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(layout.tile(0U, 1U, 1U, 0U, 4U, 0U)), std::invalid_argument);
+}
+
+TEST(CircuitLayoutSynthesisTest, GatesOfAColumnDoNotOverlap) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/alu_2.src").empty());
+    AnnotatableQuantumComputation synthesized;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesized, program));
+
+    const CircuitLayout layout(synthesized);
+    ASSERT_EQ(layout.getNgates(), synthesized.getNops());
+    EXPECT_LT(layout.getNcolumns(), synthesized.getNops());
+
+    std::size_t coveredLines = 0U;
+    for (std::size_t column = 0U; column < layout.getNcolumns(); ++column) {
+        std::vector<bool> occupied(layout.getNqubits(), false);
+        for (const auto gate: layout.gatesInColumn(column)) {
+            for (auto line = layout.getFirstLines()[gate]; line <= layout.getLastLines()[gate]; ++line) {
+                EXPECT_FALSE(occupied[line]);
+                occupied[line] = true;
+                ++coveredLines;
+            }
+        }
+    }
+
+    // at full resolution every cell is covered by at most one gate
+    const auto tile = layout.tile(0U, layout.getNcolumns());
+    EXPECT_EQ(std::accumulate(tile.counts.cbegin(), tile.counts.cend(), std::size_t{0U}), coveredLines);
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <tuple>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t   OPERAND_BITWIDTH           = 3;
+
+    // Qubit indices of the parameters of the main module in ./circuits/comparators_3.src
+    constexpr std::size_t   LHS_OPERAND_OFFSET         = 0;
+    constexpr std::size_t   RHS_OPERAND_OFFSET         = 3;
+    constexpr std::size_t   LESS_THAN_RESULT           = 6;
+    constexpr std::size_t   GREATER_THAN_RESULT        = 7;
+    constexpr std::size_t   LESS_EQUALS_RESULT         = 8;
+    constexpr std::size_t   GREATER_EQUALS_RESULT      = 9;
+    constexpr std::size_t   EQUALS_RESULT              = 10;
+    constexpr std::size_t   NOT_EQUALS_RESULT          = 11;
+    constexpr std::size_t   EQUALS_CONSTANT_RESULT     = 12;
+    constexpr std::size_t   NOT_EQUALS_CONSTANT_RESULT = 13;
+    constexpr std::uint64_t EQUALS_CONSTANT_VALUE      = 5;
+    constexpr std::uint64_t NOT_EQUALS_CONSTANT_VALUE  = 2;
+} // namespace
+
+class SyrecComparatorSynthesisTest: public testing::TestWithParam<std::tuple<std::string, bool>> {
+protected:
+    std::string     fileName = "./circuits/comparators_3.src";
+    Program         prog;
+    Properties::ptr settings = std::make_shared<Properties>();
+
+    void SetUp() override {
+        const auto& [comparatorImplementation, useMctForEqualityWithConstant] = GetParam();
+        settings->set("comparator_implementation", comparatorImplementation);
+        settings->set("equality_with_constant_using_mct", useMctForEqualityWithConstant);
+
+        const ReadProgramSettings readProgramSettings;
+        const std::string         errorString = prog.read(fileName, readProgramSettings);
+        ASSERT_TRUE(errorString.empty()) << errorString;
+    }
+
+    static void assertComparisonResultsForAllInputs(const AnnotatableQuantumComputation& annotatableQuantumComputation) {
+        for (std::uint64_t a = 0; a < (1U << OPERAND_BITWIDTH); ++a) {
+            for (std::uint64_t b = 0; b < (1U << OPERAND_BITWIDTH); ++b) {
+                const NBitValuesContainer inputState(annotatableQuantumComputation.getNqubits(), (a << LHS_OPERAND_OFFSET) | (b << RHS_OPERAND_OFFSET));
+                NBitValuesContainer       outputState;
+                ASSERT_NO_FATAL_FAILURE(simpleSimulation(outputState, annotatableQuantumComputation, inputState));
+
+                for (std::size_t i = 0; i < OPERAND_BITWIDTH; ++i) {
+                    ASSERT_EQ(inputState[LHS_OPERAND_OFFSET + i], outputState[LHS_OPERAND_OFFSET + i]) << "Left operand was modified for a=" << a << ", b=" << b;
+                    ASSERT_EQ(inputState[RHS_OPERAND_OFFSET + i], outputState[RHS_OPERAND_OFFSET + i]) << "Right operand was modified for a=" << a << ", b=" << b;
+                }
+                ASSERT_EQ(a < b, outputState[LESS_THAN_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a > b, outputState[GREATER_THAN_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a <= b, outputState[LESS_EQUALS_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a >= b, outputState[GREATER_EQUALS_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a == b, outputState[EQUALS_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a != b, outputState[NOT_EQUALS_RESULT]) << "a=" << a << ", b=" << b;
+                ASSERT_EQ(a == EQUALS_CONSTANT_VALUE, outputState[EQUALS_CONSTANT_RESULT]) << "a=" << a;
+                ASSERT_EQ(a != NOT_EQUALS_CONSTANT_VALUE, outputState[NOT_EQUALS_CONSTANT_RESULT]) << "a=" << a;
+            }
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecComparatorSynthesisTest, SyrecComparatorSynthesisTest,
+                         testing::Combine(
+                                 testing::Values("subtract_and_restore", "carry_chain", "log_depth_tree"),
+                                 testing::Bool()),
+                         [](const testing::TestParamInfo<SyrecComparatorSynthesisTest::ParamType>& info) {
+                             return std::get<0>(info.param) + (std::get<1>(info.param) ? "_with_mct_for_constants" : ""); });
+
+TEST_P(SyrecComparatorSynthesisTest, ExhaustiveSimulationUsingCostAwareSynthesis) {
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+    ASSERT_NO_FATAL_FAILURE(assertComparisonResultsForAllInputs(annotatableQuantumComputation));
+}
+
+TEST_P(SyrecComparatorSynthesisTest, ExhaustiveSimulationUsingLineAwareSynthesis) {
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+    ASSERT_NO_FATAL_FAILURE(assertComparisonResultsForAllInputs(annotatableQuantumComputation));
+}
+
+TEST(SyrecComparatorSynthesisCostTest, CarryChainComparatorIsCheaperThanSubtractAndRestore) {
+    Program                   prog;
+    const ReadProgramSettings readProgramSettings;
+    ASSERT_TRUE(prog.read("./circuits/comparators_3.src", readProgramSettings).empty());
+
+    AnnotatableQuantumComputation defaultComparators;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(defaultComparators, prog));
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("comparator_implementation", std::string("carry_chain"));
+    AnnotatableQuantumComputation carryChainComparators;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(carryChainComparators, prog, settings));
+    ASSERT_LT(carryChainComparators.getQuantumCostForSynthesis(), defaultComparators.getQuantumCostForSynthesis());
+}
+
+TEST(SyrecComparatorSynthesisCostTest, EqualityWithConstantUsingMctRequiresNoConstantLines) {
+    Program                   prog;
+    const ReadProgramSettings readProgramSettings;
+    ASSERT_TRUE(prog.read("./circuits/comparators_3.src", readProgramSettings).empty());
+
+    AnnotatableQuantumComputation defaultEqualityChecks;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(defaultEqualityChecks, prog));
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("equality_with_constant_using_mct", true);
+    AnnotatableQuantumComputation mctEqualityChecks;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(mctEqualityChecks, prog, settings));
+    ASSERT_LT(mctEqualityChecks.getNqubits(), defaultEqualityChecks.getNqubits());
+    ASSERT_LT(mctEqualityChecks.getQuantumCostForSynthesis(), defaultEqualityChecks.getQuantumCostForSynthesis());
+}
+
+TEST(SyrecComparatorSynthesisCostTest, UnknownComparatorImplementationIsRejected) {
+    Program                   prog;
+    const ReadProgramSettings readProgramSettings;
+    ASSERT_TRUE(prog.read("./circuits/comparators_3.src", readProgramSettings).empty());
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("comparator_implementation", std::string("ripple"));
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_FALSE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+}
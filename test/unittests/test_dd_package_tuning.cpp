@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_package_tuning.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "dd/DDpackageConfig.hpp"
+#include "dd/Operations.hpp"
+#include "dd/Package.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    bool isPowerOfTwo(const std::size_t value) {
+        return value != 0U && (value & (value - 1U)) == 0U;
+    }
+} // namespace
+
+class TestDDPackageTuning: public testing::Test {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+
+    static void checkRealizes(const std::shared_ptr<qc::QuantumComputation>& qc, const TruthTable& tt) {
+        ASSERT_NE(qc, nullptr);
+        TruthTable ttqc{};
+        buildTruthTable(*qc, ttqc);
+        EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+        EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+    }
+};
+
+class TestDDPackageTuningSynthesis: public TestDDPackageTuning, public testing::WithParamInterface<std::string> {
+protected:
+    TruthTable tt{};
+
+    void SetUp() override {
+        ASSERT_TRUE(readPla(tt, testCircuitsDir + GetParam() + ".pla"));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestDDPackageTuningSynthesis, TestDDPackageTuningSynthesis,
+                         testing::Values("3_17_6", "adder3Bit", "hwb4_12", "hwb7_15", "graycode", "dc3bit", "4mod5"),
+                         [](const testing::TestParamInfo<TestDDPackageTuningSynthesis::ParamType>& info) { return info.param; });
+
+TEST_P(TestDDPackageTuningSynthesis, TunedSynthesisRealizesTruthTable) {
+    const auto statistics = std::make_shared<Properties>();
+    const auto qc         = DDSynthesizer::synthesizeOnePass(tt, Properties::ptr(), statistics);
+    checkRealizes(qc, tt);
+
+    EXPECT_EQ(statistics->get<std::uint64_t>("gates"), qc->getNops());
+    EXPECT_GE(statistics->get<std::uint64_t>("dd_operations"), qc->getNops());
+    EXPECT_GE(statistics->get<std::uint64_t>("dd_peak_nodes"), statistics->get<std::uint64_t>("dd_nodes"));
+    const auto hitRatio = statistics->get<double>("dd_multiplication_hit_ratio");
+    EXPECT_GE(hitRatio, 0.);
+    EXPECT_LE(hitRatio, 1.);
+    EXPECT_GE(statistics->get<double>("runtime"), 0.);
+
+    const auto codingStatistics = std::make_shared<Properties>();
+    checkRealizes(DDSynthesizer::synthesizeCodingTechniques(tt, true, Properties::ptr(), codingStatistics), tt);
+    EXPECT_GT(codingStatistics->get<std::uint64_t>("gates"), 0U);
+}
+
+TEST_P(TestDDPackageTuningSynthesis, TuningDoesNotChangeSmallCircuits) {
+    // the tables of these truth tables never grow large enough to be collected, thus only the table sizes differ
+    const auto untunedSettings = std::make_shared<Properties>();
+    untunedSettings->set("dd_adaptive_sizing", false);
+    const auto tunedSettings = std::make_shared<Properties>();
+    tunedSettings->set("dd_adaptive_garbage_collection", true);
+    const auto untuned = DDSynthesizer::synthesizeOnePass(tt, untunedSettings, Properties::ptr());
+    const auto tuned   = DDSynthesizer::synthesizeOnePass(tt, tunedSettings, Properties::ptr());
+    checkRealizes(untuned, tt);
+    EXPECT_EQ(tuned->getNops(), untuned->getNops());
+}
+
+TEST_F(TestDDPackageTuning, SynthesisConfigGrowsWithTheTruthTable) {
+    const auto small = synthesisPackageConfig(4U, 16U);
+    const auto large = synthesisPackageConfig(20U, 1U << 20U);
+
+    // the buckets of the matrix unique table determine the synthesized circuit
+    EXPECT_EQ(small.utMatNumBucket, dd::DDPackageConfig{}.utMatNumBucket);
+    EXPECT_EQ(large.utMatNumBucket, dd::DDPackageConfig{}.utMatNumBucket);
+
+    for (const auto& config: {small, large}) {
+        EXPECT_TRUE(isPowerOfTwo(config.utMatInitialAllocationSize));
+        EXPECT_TRUE(isPowerOfTwo(config.ctMatMatMultNumBucket));
+        EXPECT_TRUE(isPowerOfTwo(config.ctMatAddNumBucket));
+        EXPECT_TRUE(isPowerOfTwo(config.utVecNumBucket));
+        EXPECT_LT(config.utVecNumBucket, dd::DDPackageConfig{}.utVecNumBucket);
+    }
+    EXPECT_LT(small.ctMatMatMultNumBucket, large.ctMatMatMultNumBucket);
+    EXPECT_LT(small.utMatInitialAllocationSize, large.utMatInitialAllocationSize);
+}
+
+TEST_F(TestDDPackageTuning, SimulationConfigGrowsWithTheCircuit) {
+    const auto small = simulationPackageConfig(4U, 10U);
+    const auto large = simulationPackageConfig(30U, 1U << 20U);
+
+    for (const auto& config: {small, large}) {
+        EXPECT_TRUE(isPowerOfTwo(config.utVecNumBucket));
+        EXPECT_TRUE(isPowerOfTwo(config.utMatNumBucket));
+        EXPECT_TRUE(isPowerOfTwo(config.ctMatVecMultNumBucket));
+        EXPECT_LE(config.utVecNumBucket, dd::DDPackageConfig{}.utVecNumBucket);
+    }
+    EXPECT_LT(small.utVecNumBucket, large.utVecNumBucket);
+    EXPECT_LT(small.ctMatVecMultNumBucket, large.ctMatVecMultNumBucket);
+}
+
+TEST_F(TestDDPackageTuning, TuningFromProperties) {
+    const auto defaults = DDPackageTuning::fromProperties(Properties::ptr());
+    EXPECT_TRUE(defaults.adaptiveSizing);
+    EXPECT_FALSE(defaults.adaptiveGarbageCollection);
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("dd_adaptive_sizing", false);
+    settings->set("dd_adaptive_garbage_collection", true);
+    settings->set("dd_min_garbage_collection_interval", 0U);
+    settings->set("dd_max_garbage_collection_interval", 16U);
+    settings->set("dd_min_freed_share", 0.5);
+    const auto tuning = DDPackageTuning::fromProperties(settings);
+    EXPECT_FALSE(tuning.adaptiveSizing);
+    EXPECT_TRUE(tuning.adaptiveGarbageCollection);
+    EXPECT_EQ(tuning.minGarbageCollectionInterval, 1U);
+    EXPECT_EQ(tuning.maxGarbageCollectionInterval, 16U);
+    EXPECT_EQ(tuning.minFreedShare, 0.5);
+
+    DDPackageMonitor monitor(tuning);
+    dd::Package      dd(2U);
+    for (std::size_t i = 0U; i < 100U; ++i) {
+        monitor.afterOperation(dd);
+    }
+    EXPECT_EQ(monitor.getOperations(), 100U);
+    EXPECT_GE(monitor.getGarbageCollectionInterval(), tuning.minGarbageCollectionInterval);
+    EXPECT_LE(monitor.getGarbageCollectionInterval(), tuning.maxGarbageCollectionInterval);
+    monitor.reset();
+    EXPECT_EQ(monitor.getOperations(), 0U);
+    EXPECT_EQ(monitor.getTuning().maxGarbageCollectionInterval, 16U);
+}
+
+TEST_F(TestDDPackageTuning, PeakNodesAreSampledWithoutAdaptiveGarbageCollection) {
+    // the DDs of the gates are released and collected before the statistics are written, thus only the sampled peak still counts their nodes
+    DDPackageMonitor       monitor;
+    dd::Package            dd(4U);
+    qc::QuantumComputation quantumComputation(4U);
+    quantumComputation.cx(0U, 1U);
+    quantumComputation.mcx(qc::Controls{0U, 1U}, 2U);
+    quantumComputation.mcx(qc::Controls{0U, 1U, 2U}, 3U);
+    for (const auto& operation: quantumComputation) {
+        const auto gate = dd::getDD(*operation, dd);
+        dd.incRef(gate);
+        monitor.afterOperation(dd);
+        dd.decRef(gate);
+    }
+    dd.garbageCollect(true);
+
+    const auto statistics = std::make_shared<Properties>();
+    monitor.writeStatistics(dd, statistics);
+    EXPECT_FALSE(monitor.getTuning().adaptiveGarbageCollection);
+    EXPECT_EQ(statistics->get<std::uint64_t>("dd_operations"), 3U);
+    EXPECT_GT(monitor.getPeakNodes(), 0U);
+    EXPECT_GT(statistics->get<std::uint64_t>("dd_peak_nodes"), statistics->get<std::uint64_t>("dd_nodes"));
+}
+
+TEST_F(TestDDPackageTuning, BatchWithTuning) {
+    std::vector<TruthTable> tts;
+    for (const auto* fileName: {"hwb4_12", "4mod5", "hwb7_15", "dc3bit"}) {
+        TruthTable table{};
+        ASSERT_TRUE(readPla(table, testCircuitsDir + fileName + ".pla"));
+        tts.emplace_back(table);
+    }
+
+    DDBatchSettings settings{};
+    settings.nThreads                            = 2U;
+    settings.tuning.adaptiveGarbageCollection    = true;
+    settings.tuning.maxGarbageCollectionInterval = 8U;
+    const auto results                           = DDSynthesizer::synthesizeBatch(tts, settings);
+    ASSERT_EQ(results.size(), tts.size());
+    for (std::size_t i = 0U; i < tts.size(); ++i) {
+        checkRealizes(results[i].qc, tts[i]);
+    }
+}
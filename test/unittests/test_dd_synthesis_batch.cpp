@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class TestDDSynthBatch: public testing::TestWithParam<std::size_t> {
+protected:
+    std::string             testCircuitsDir = "./circuits/";
+    std::vector<TruthTable> tts;
+
+    void SetUp() override {
+        // tables of different sizes (and with don't cares), thus the shared packages have to be enlarged
+        for (const auto* fileName: {"huff_1", "dc3bit", "4mod5", "sym6_32", "dcX2bit", "aludc", "rd32_19", "huff_31", "counter", "minialu", "4gt10", "z4"}) {
+            TruthTable tt{};
+            ASSERT_TRUE(readPla(tt, testCircuitsDir + fileName + ".pla"));
+            tts.emplace_back(tt);
+        }
+    }
+
+    void checkResults(const std::vector<DDBatchResult>& results) const {
+        ASSERT_EQ(results.size(), tts.size());
+        for (std::size_t i = 0U; i < tts.size(); ++i) {
+            ASSERT_NE(results[i].qc, nullptr);
+            TruthTable ttqc{};
+            buildTruthTable(*results[i].qc, ttqc);
+            EXPECT_TRUE(TruthTable::equal(ttqc, tts[i])) << "truth table " << i;
+            EXPECT_TRUE(TruthTable::equal(tts[i], ttqc)) << "truth table " << i;
+            EXPECT_GT(results[i].runtime, 0.);
+        }
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestDDSynthBatch, TestDDSynthBatch,
+                         testing::Values(1U, 2U, 4U),
+                         [](const testing::TestParamInfo<TestDDSynthBatch::ParamType>& info) { return "threads_" + std::to_string(info.param); });
+
+TEST_P(TestDDSynthBatch, OnePass) {
+    DDBatchSettings settings{};
+    settings.nThreads = GetParam();
+    // collect garbage more often than once per batch
+    settings.garbageCollectionInterval = 3U;
+    checkResults(DDSynthesizer::synthesizeBatch(tts, settings));
+}
+
+TEST_P(TestDDSynthBatch, CodingTechniques) {
+    DDBatchSettings settings{};
+    settings.nThreads         = GetParam();
+    settings.codingTechniques = true;
+    checkResults(DDSynthesizer::synthesizeBatch(tts, settings));
+
+    settings.withAdditionalLine        = false;
+    settings.garbageCollectionInterval = 0U;
+    checkResults(DDSynthesizer::synthesizeBatch(tts, settings));
+}
+
+TEST_P(TestDDSynthBatch, SameGateCountAsSeparateSynthesis) {
+    DDBatchSettings settings{};
+    settings.nThreads  = GetParam();
+    const auto results = DDSynthesizer::synthesizeBatch(tts, settings);
+    ASSERT_EQ(results.size(), tts.size());
+    for (std::size_t i = 0U; i < tts.size(); ++i) {
+        EXPECT_EQ(results[i].qc->getNops(), DDSynthesizer::synthesizeOnePass(tts[i])->getNops()) << "truth table " << i;
+    }
+}
+
+TEST(TestDDSynthBatchNodes, SameTableDoesNotAccumulateNodes) {
+    TruthTable tt{};
+    ASSERT_TRUE(readPla(tt, "./circuits/sym6_32.pla"));
+    const std::vector<TruthTable> tts(8U, tt);
+
+    DDBatchSettings settings{};
+    settings.garbageCollectionInterval = 1U;
+    const auto results                 = DDSynthesizer::synthesizeBatch(tts, settings);
+    ASSERT_EQ(results.size(), tts.size());
+
+    // no DD outlives the synthesis of its truth table, thus every collection frees all nodes
+    for (std::size_t i = 0U; i < tts.size(); ++i) {
+        EXPECT_EQ(results[i].nodes, 0U) << "truth table " << i;
+        EXPECT_EQ(results[i].qc->getNops(), results.front().qc->getNops()) << "truth table " << i;
+    }
+}
+
+TEST(TestDDSynthBatchEmpty, EmptyBatch) {
+    EXPECT_TRUE(DDSynthesizer::synthesizeBatch({}).empty());
+}
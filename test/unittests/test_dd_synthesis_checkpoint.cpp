@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/circuit_to_truthtable.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/QuantumComputation.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+using namespace syrec;
+
+class TestDDSynthCheckpoint: public testing::TestWithParam<std::string> {
+protected:
+    std::string          testCircuitsDir = "./circuits/";
+    TruthTable           tt{};
+    DDCheckpointSettings checkpoint{};
+
+    void SetUp() override {
+        ASSERT_TRUE(readPla(tt, testCircuitsDir + GetParam() + ".pla"));
+        checkpoint.filename = "./dd_synthesis_checkpoint_" + GetParam() + ".ckpt";
+        checkpoint.interval = 1U;
+        std::remove(checkpoint.filename.c_str());
+    }
+
+    void TearDown() override {
+        std::remove(checkpoint.filename.c_str());
+    }
+
+    // resuming from the last checkpoint written during the synthesis has to yield the same gates as the uninterrupted synthesis
+    void checkResumed(const qc::QuantumComputation& expected) const {
+        EXPECT_FALSE(std::filesystem::exists(checkpoint.filename + ".tmp"));
+        if (!std::filesystem::exists(checkpoint.filename)) {
+            // the DD has been synthesized without processing a single node
+            return;
+        }
+        const auto resumed = DDSynthesizer::resume(checkpoint);
+        ASSERT_NE(resumed, nullptr);
+        EXPECT_EQ(resumed->getNqubits(), expected.getNqubits());
+        EXPECT_EQ(resumed->getAncillary(), expected.getAncillary());
+        EXPECT_EQ(resumed->getGarbage(), expected.getGarbage());
+        ASSERT_EQ(resumed->getNops(), expected.getNops());
+        for (std::size_t i = 0U; i < expected.getNops(); ++i) {
+            EXPECT_TRUE(resumed->at(i)->equals(*expected.at(i))) << "operation " << i;
+        }
+
+        TruthTable ttqc{};
+        buildTruthTable(*resumed, ttqc);
+        EXPECT_TRUE(TruthTable::equal(ttqc, tt));
+        EXPECT_TRUE(TruthTable::equal(tt, ttqc));
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestDDSynthCheckpoint, TestDDSynthCheckpoint,
+                         testing::Values("3_17_6", "4mod5", "aludc", "dc3bit", "hwb4_12", "rd32_19", "z4"),
+                         [](const testing::TestParamInfo<TestDDSynthCheckpoint::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(TestDDSynthCheckpoint, OnePass) {
+    const auto uninterrupted = DDSynthesizer::synthesizeOnePass(tt);
+    const auto checkpointed  = DDSynthesizer::synthesizeOnePass(tt, checkpoint);
+    ASSERT_NE(checkpointed, nullptr);
+    EXPECT_EQ(checkpointed->getNops(), uninterrupted->getNops());
+    checkResumed(*uninterrupted);
+}
+
+TEST_P(TestDDSynthCheckpoint, CodingTechniques) {
+    for (const auto withAdditionalLine: {true, false}) {
+        std::remove(checkpoint.filename.c_str());
+        const auto uninterrupted = DDSynthesizer::synthesizeCodingTechniques(tt, withAdditionalLine);
+        const auto checkpointed  = DDSynthesizer::synthesizeCodingTechniques(tt, withAdditionalLine, checkpoint);
+        ASSERT_NE(checkpointed, nullptr);
+        EXPECT_EQ(checkpointed->getNops(), uninterrupted->getNops());
+        checkResumed(*uninterrupted);
+    }
+}
+
+TEST_P(TestDDSynthCheckpoint, ResumesFromEarlyCheckpoints) {
+    // with an interval of at least half the number of processed nodes, the only checkpoint is written in the first half of the synthesis
+    const auto uninterrupted = DDSynthesizer::synthesizeOnePass(tt);
+    for (checkpoint.interval = 1U;; checkpoint.interval *= 2U) {
+        std::remove(checkpoint.filename.c_str());
+        const auto checkpointed = DDSynthesizer::synthesizeOnePass(tt, checkpoint);
+        ASSERT_NE(checkpointed, nullptr);
+        if (!std::filesystem::exists(checkpoint.filename)) {
+            break;
+        }
+        checkResumed(*uninterrupted);
+    }
+
+    const auto uninterruptedCoding = DDSynthesizer::synthesizeCodingTechniques(tt, true);
+    for (checkpoint.interval = 1U;; checkpoint.interval *= 2U) {
+        std::remove(checkpoint.filename.c_str());
+        const auto checkpointed = DDSynthesizer::synthesizeCodingTechniques(tt, true, checkpoint);
+        ASSERT_NE(checkpointed, nullptr);
+        if (!std::filesystem::exists(checkpoint.filename)) {
+            break;
+        }
+        checkResumed(*uninterruptedCoding);
+    }
+}
+
+TEST_P(TestDDSynthCheckpoint, ResumesWithTunedPackage) {
+    const auto uninterrupted = DDSynthesizer::synthesizeOnePass(tt);
+    ASSERT_NE(DDSynthesizer::synthesizeOnePass(tt, checkpoint), nullptr);
+    if (!std::filesystem::exists(checkpoint.filename)) {
+        GTEST_SKIP() << "the DD has been synthesized without processing a single node";
+    }
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("dd_adaptive_sizing", false);
+    settings->set("dd_adaptive_garbage_collection", true);
+    const auto statistics = std::make_shared<Properties>();
+    const auto resumed    = DDSynthesizer::resume(checkpoint, settings, statistics);
+    ASSERT_NE(resumed, nullptr);
+    ASSERT_EQ(resumed->getNops(), uninterrupted->getNops());
+    for (std::size_t i = 0U; i < uninterrupted->getNops(); ++i) {
+        EXPECT_TRUE(resumed->at(i)->equals(*uninterrupted->at(i))) << "operation " << i;
+    }
+    EXPECT_EQ(statistics->get<std::uint64_t>("gates"), uninterrupted->getNops());
+}
+
+TEST(TestDDSynthCheckpointErrors, RejectsInvalidCheckpoints) {
+    DDCheckpointSettings checkpoint{};
+    checkpoint.filename = "./dd_synthesis_checkpoint_invalid.ckpt";
+    std::remove(checkpoint.filename.c_str());
+    EXPECT_THROW(DDSynthesizer::resume(checkpoint), std::invalid_argument);
+
+    std::ofstream os(checkpoint.filename);
+    os << "syrec-dd-synthesis-checkpoint 1\ncounters 3 3 3 0 1 0\n";
+    os.close();
+    EXPECT_THROW(DDSynthesizer::resume(checkpoint), std::invalid_argument);
+    std::remove(checkpoint.filename.c_str());
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/syrec/program.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <utility>
+
+using namespace syrec;
+
+namespace {
+    constexpr std::size_t   ELEMENT_BITWIDTH = 2;
+    constexpr std::uint64_t ELEMENT_MASK     = (1U << ELEMENT_BITWIDTH) - 1U;
+
+    // Qubit offsets of the parameters of the main module in ./circuits/dynamic_index_2.src
+    constexpr std::size_t A_OFFSET = 0;
+    constexpr std::size_t I_OFFSET = 8;
+    constexpr std::size_t X_OFFSET = 10;
+    constexpr std::size_t B_OFFSET = 12;
+    constexpr std::size_t J_OFFSET = 18;
+    constexpr std::size_t C_OFFSET = 20;
+
+    constexpr std::array<std::uint64_t, 4> INITIAL_A = {1, 2, 3, 0};
+    constexpr std::array<std::uint64_t, 3> INITIAL_B = {3, 1, 2};
+
+    std::uint64_t readValue(const NBitValuesContainer& state, const std::size_t offset) {
+        std::uint64_t value = 0;
+        for (std::size_t k = 0; k < ELEMENT_BITWIDTH; ++k) {
+            value |= static_cast<std::uint64_t>(state[offset + k]) << k;
+        }
+        return value;
+    }
+
+    // Quantum cost of the cost-aware synthesis of the read x ^= a[i] of an array with nElements elements of the given bitwidth
+    std::uint64_t quantumCostOfDynamicRead(const std::size_t nElements, const std::size_t nIndexBits, const std::size_t bitwidth) {
+        std::ostringstream source;
+        source << "module main(in a[" << nElements << "](" << bitwidth << "), in i(" << nIndexBits << "), out x(" << bitwidth << "))\n"
+               << "  x ^= a[i]\n";
+
+        Program           prog;
+        const std::string errorString = prog.readFromString(source.str());
+        EXPECT_TRUE(errorString.empty()) << errorString;
+
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+        EXPECT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog));
+        return annotatableQuantumComputation.getQuantumCostForSynthesis();
+    }
+} // namespace
+
+class SyrecDynamicArrayIndexingTest: public testing::TestWithParam<bool> {
+protected:
+    Program prog;
+
+    void SetUp() override {
+        const ReadProgramSettings settings;
+        const std::string         errorString = prog.read("./circuits/dynamic_index_2.src", settings);
+        ASSERT_TRUE(errorString.empty()) << errorString;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecDynamicArrayIndexingTest, SyrecDynamicArrayIndexingTest, testing::Bool(),
+                         [](const testing::TestParamInfo<SyrecDynamicArrayIndexingTest::ParamType>& info) {
+                             return info.param ? "LineAwareSynthesis" : "CostAwareSynthesis"; });
+
+TEST_P(SyrecDynamicArrayIndexingTest, ExhaustiveSimulationOverAllIndexValues) {
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    if (GetParam()) {
+        ASSERT_TRUE(LineAwareSynthesis::synthesize(annotatableQuantumComputation, prog));
+    } else {
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog));
+    }
+
+    for (std::uint64_t i = 0; i < 4; ++i) {
+        for (std::uint64_t j = 0; j < 4; ++j) {
+            for (std::uint64_t c = 0; c < 4; ++c) {
+                std::uint64_t initialStateValue = (i << I_OFFSET) | (j << J_OFFSET) | (c << C_OFFSET);
+                for (std::size_t e = 0; e < INITIAL_A.size(); ++e) {
+                    initialStateValue |= INITIAL_A[e] << (A_OFFSET + e * ELEMENT_BITWIDTH);
+                }
+                for (std::size_t e = 0; e < INITIAL_B.size(); ++e) {
+                    initialStateValue |= INITIAL_B[e] << (B_OFFSET + e * ELEMENT_BITWIDTH);
+                }
+
+                const NBitValuesContainer inputState(annotatableQuantumComputation.getNqubits(), initialStateValue);
+                NBitValuesContainer       outputState;
+                ASSERT_NO_FATAL_FAILURE(simpleSimulation(outputState, annotatableQuantumComputation, inputState));
+
+                // Reference model of the SyReC program
+                auto          expectedA = INITIAL_A;
+                auto          expectedB = INITIAL_B;
+                std::uint64_t expectedC = c;
+                const auto    expectedX = expectedA[i];
+                if (j < expectedB.size()) {
+                    expectedB[j] = (expectedB[j] + 1 + c) & ELEMENT_MASK;
+                    if (expectedX == 1) {
+                        expectedB[j] = (expectedB[j] - 1) & ELEMENT_MASK;
+                    }
+                }
+                std::swap(expectedA[i], expectedC);
+
+                const std::string context = "i=" + std::to_string(i) + ", j=" + std::to_string(j) + ", c=" + std::to_string(c);
+                ASSERT_EQ(i, readValue(outputState, I_OFFSET)) << context;
+                ASSERT_EQ(j, readValue(outputState, J_OFFSET)) << context;
+                ASSERT_EQ(expectedX, readValue(outputState, X_OFFSET)) << context;
+                ASSERT_EQ(expectedC, readValue(outputState, C_OFFSET)) << context;
+                for (std::size_t e = 0; e < expectedA.size(); ++e) {
+                    ASSERT_EQ(expectedA[e], readValue(outputState, A_OFFSET + e * ELEMENT_BITWIDTH)) << context << ", a[" << e << "]";
+                }
+                for (std::size_t e = 0; e < expectedB.size(); ++e) {
+                    ASSERT_EQ(expectedB[e], readValue(outputState, B_OFFSET + e * ELEMENT_BITWIDTH)) << context << ", b[" << e << "]";
+                }
+            }
+        }
+    }
+}
+
+TEST(SyrecDynamicArrayIndexingCostTest, CostGrowsLinearlyWithBitwidth) {
+    // Every additional bit of the elements adds one controlled copy per element, independent of the bitwidth
+    const auto cost2 = quantumCostOfDynamicRead(4, 2, 2);
+    const auto cost4 = quantumCostOfDynamicRead(4, 2, 4);
+    const auto cost8 = quantumCostOfDynamicRead(4, 2, 8);
+    ASSERT_LT(cost2, cost4);
+    EXPECT_EQ((cost8 - cost4) / 4, (cost4 - cost2) / 2);
+    EXPECT_EQ((cost8 - cost4) % 4, 0U);
+    EXPECT_EQ((cost4 - cost2) % 2, 0U);
+}
+
+TEST(SyrecDynamicArrayIndexingCostTest, CostGrowsLinearlyWithNumberOfElements) {
+    // The decoding tree of the index has one node with a shared select qubit per element, i.e. there is no comparator per element
+    const auto cost4  = quantumCostOfDynamicRead(4, 2, 2);
+    const auto cost8  = quantumCostOfDynamicRead(8, 3, 2);
+    const auto cost16 = quantumCostOfDynamicRead(16, 4, 2);
+    ASSERT_LT(cost4, cost8);
+    EXPECT_EQ(cost16 - cost8, 2 * (cost8 - cost4));
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "algorithms/synthesis/functional_decomposition.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace syrec;
+
+class TestFunctionalDecomposition: public testing::TestWithParam<std::string> {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+
+    // simulate the circuit for every input cube of the (extended) truth table and compare the specified outputs
+    static void checkRealizes(const TruthTable& tt, const DecomposedCircuit& decomposed) {
+        ASSERT_NE(decomposed.qc, nullptr);
+        ASSERT_EQ(decomposed.inputQubits.size(), tt.nInputs());
+        ASSERT_EQ(decomposed.outputQubits.size(), tt.nOutputs());
+        for (const auto qubit: decomposed.inputQubits) {
+            EXPECT_FALSE(decomposed.qc->getAncillary()[qubit]);
+        }
+        for (const auto qubit: decomposed.outputQubits) {
+            EXPECT_FALSE(decomposed.qc->getGarbage()[qubit]);
+        }
+
+        const auto gates = compileBitParallel(*decomposed.qc);
+        ASSERT_TRUE(gates.has_value());
+        for (const auto& [input, output]: tt) {
+            std::vector<std::uint64_t> state(decomposed.qc->getNqubits(), 0U);
+            for (std::size_t i = 0U; i < input.size(); ++i) {
+                state[decomposed.inputQubits[i]] = *input[i] ? 1U : 0U;
+            }
+            simulateBitParallel(*gates, state);
+            for (std::size_t o = 0U; o < output.size(); ++o) {
+                if (output[o].has_value()) {
+                    EXPECT_EQ((state[decomposed.outputQubits[o]] & 1U) != 0U, *output[o]) << "input " << input.toString() << ", output " << o;
+                }
+            }
+        }
+    }
+
+    static TruthTable fromFunction(const std::size_t nInputs, const std::size_t nOutputs, std::uint64_t (*function)(std::uint64_t)) {
+        TruthTable tt;
+        for (std::uint64_t input = 0U; input < (1ULL << nInputs); ++input) {
+            tt.try_emplace(TruthTable::Cube::fromInteger(input, nInputs), TruthTable::Cube::fromInteger(function(input), nOutputs));
+        }
+        return tt;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestFunctionalDecomposition, TestFunctionalDecomposition,
+                         testing::Values("4mod5", "aludc", "dc3bit", "rd32_19", "sym6_32", "adder3Bit", "hwb4_12", "life", "max10"),
+                         [](const testing::TestParamInfo<TestFunctionalDecomposition::ParamType>& info) { return info.param; });
+
+TEST_P(TestFunctionalDecomposition, ComposedCircuitRealizesTruthTable) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, testCircuitsDir + GetParam() + ".pla"));
+    extend(tt);
+
+    for (const std::size_t maxLeafInputs: {2U, 4U, 8U}) {
+        FunctionalDecompositionSettings settings;
+        settings.maxLeafInputs = maxLeafInputs;
+        settings.nThreads      = 2U;
+        const auto decomposed  = synthesizeDecomposed(tt, settings);
+        ASSERT_TRUE(decomposed.has_value()) << "max leaf inputs " << maxLeafInputs;
+        checkRealizes(tt, *decomposed);
+    }
+}
+
+TEST_F(TestFunctionalDecomposition, SharedBoundSetFunctionIsComputedOnce) {
+    // both outputs depend on the parity of the first six inputs, which is computed on one line by a Curtis decomposition
+    const auto tt = fromFunction(12U, 2U, [](const std::uint64_t input) -> std::uint64_t {
+        const auto bit    = [input](const unsigned i) { return (input >> i) & 1U; };
+        const auto parity = bit(0U) ^ bit(1U) ^ bit(2U) ^ bit(3U) ^ bit(4U) ^ bit(5U);
+        const auto first  = parity != 0U ? bit(6U) & bit(7U) : bit(8U) | bit(9U);
+        const auto second = parity ^ (bit(10U) & bit(11U) & bit(6U));
+        return first | (second << 1U);
+    });
+
+    FunctionalDecompositionSettings settings;
+    settings.maxLeafInputs = 4U;
+    const auto statistics  = std::make_shared<Properties>();
+    const auto decomposed  = synthesizeDecomposed(tt, settings, statistics);
+    ASSERT_TRUE(decomposed.has_value());
+    checkRealizes(tt, *decomposed);
+    EXPECT_GT(statistics->get<std::uint64_t>("curtis_decompositions"), 0U);
+    EXPECT_LE(statistics->get<std::uint64_t>("max_sub_table_inputs"), 4U);
+    EXPECT_GE(statistics->get<double>("runtime"), 0.);
+}
+
+TEST_F(TestFunctionalDecomposition, TrivialOutputsAreCopied) {
+    // a constant one, the third input, the negated second input and twice the same function of the first three inputs
+    const auto tt = fromFunction(4U, 5U, [](const std::uint64_t input) -> std::uint64_t {
+        const auto bit      = [input](const unsigned i) { return (input >> i) & 1U; };
+        const auto function = (bit(0U) & bit(1U)) | bit(2U);
+        return 1U | (bit(3U) << 1U) | ((1U - bit(1U)) << 2U) | (function << 3U) | (function << 4U);
+    });
+
+    const auto statistics = std::make_shared<Properties>();
+    const auto decomposed = synthesizeDecomposed(tt, FunctionalDecompositionSettings{}, statistics);
+    ASSERT_TRUE(decomposed.has_value());
+    checkRealizes(tt, *decomposed);
+    EXPECT_EQ(statistics->get<std::uint64_t>("copied_outputs"), 4U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("sub_tables"), 1U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("max_sub_table_inputs"), 3U);
+}
+
+TEST_F(TestFunctionalDecomposition, DisjointOutputsAreSynthesizedSeparately) {
+    // the first output depends on the first two inputs only, the second one on the remaining inputs
+    const auto tt = fromFunction(7U, 2U, [](const std::uint64_t input) -> std::uint64_t {
+        const auto first  = static_cast<std::uint64_t>((input & 3U) == 3U);
+        const auto second = static_cast<std::uint64_t>(((input >> 2U) & 31U) % 3U == 0U);
+        return first | (second << 1U);
+    });
+
+    const auto statistics = std::make_shared<Properties>();
+    const auto decomposed = synthesizeDecomposed(tt, FunctionalDecompositionSettings{}, statistics);
+    ASSERT_TRUE(decomposed.has_value());
+    checkRealizes(tt, *decomposed);
+    EXPECT_GT(statistics->get<std::uint64_t>("components"), 0U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("sub_tables"), 2U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("max_sub_table_inputs"), 5U);
+}
+
+TEST_F(TestFunctionalDecomposition, WideTableWithDisjointOutputsIsDecomposed) {
+    // 30 inputs, but the conjunction of the inputs 0 to 7, the disjunction of the inputs 8 to 15, x16 & !x29 and a constant one depend on at most 8 of them
+    constexpr std::size_t nInputs  = 30U;
+    constexpr std::size_t nOutputs = 4U;
+    const auto            cubeOf   = [](const std::vector<std::pair<std::size_t, bool>>& literals) {
+        TruthTable::Cube cube(nInputs, std::nullopt);
+        for (const auto& [input, value]: literals) {
+            cube[input] = value;
+        }
+        return cube;
+    };
+    const auto outputOf = [](const std::size_t o) {
+        TruthTable::Cube output(nOutputs, std::nullopt);
+        output[o] = true;
+        return output;
+    };
+    TruthTable tt;
+    tt.try_emplace(cubeOf({{0U, true}, {1U, true}, {2U, true}, {3U, true}, {4U, true}, {5U, true}, {6U, true}, {7U, true}}), outputOf(0U));
+    for (std::size_t i = 8U; i < 16U; ++i) {
+        tt.try_emplace(cubeOf({{i, true}}), outputOf(1U));
+    }
+    tt.try_emplace(cubeOf({{16U, true}, {29U, false}}), outputOf(2U));
+    tt.try_emplace(cubeOf({}), outputOf(3U));
+
+    const auto statistics = std::make_shared<Properties>();
+    const auto decomposed = synthesizeDecomposed(tt, FunctionalDecompositionSettings{}, statistics);
+    ASSERT_TRUE(decomposed.has_value());
+    EXPECT_GT(statistics->get<std::uint64_t>("components"), 0U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("sub_tables"), 3U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("max_sub_table_inputs"), 8U);
+
+    // 64 random assignments of all inputs at once
+    const auto gates = compileBitParallel(*decomposed->qc);
+    ASSERT_TRUE(gates.has_value());
+    std::mt19937_64            rng(42U);
+    std::vector<std::uint64_t> inputs(nInputs);
+    std::vector<std::uint64_t> state(decomposed->qc->getNqubits(), 0U);
+    for (std::size_t i = 0U; i < nInputs; ++i) {
+        inputs[i]                         = rng();
+        state[decomposed->inputQubits[i]] = inputs[i];
+    }
+    simulateBitParallel(*gates, state);
+    std::uint64_t conjunction = ~0ULL;
+    std::uint64_t disjunction = 0U;
+    for (std::size_t i = 0U; i < 8U; ++i) {
+        conjunction &= inputs[i];
+        disjunction |= inputs[8U + i];
+    }
+    EXPECT_EQ(state[decomposed->outputQubits[0U]], conjunction);
+    EXPECT_EQ(state[decomposed->outputQubits[1U]], disjunction);
+    EXPECT_EQ(state[decomposed->outputQubits[2U]], inputs[16U] & ~inputs[29U]);
+    EXPECT_EQ(state[decomposed->outputQubits[3U]], ~0ULL);
+}
+
+TEST_F(TestFunctionalDecomposition, TooManyInputs) {
+    // the single cube sets the output for one assignment of all 21 inputs, thus it depends on all of them
+    TruthTable tt;
+    tt.try_emplace(TruthTable::Cube::fromInteger(0U, 21U), TruthTable::Cube::fromInteger(1U, 1U));
+    EXPECT_FALSE(synthesizeDecomposed(tt).has_value());
+}
+
+TEST_F(TestFunctionalDecomposition, TooManyInputsOfSubTable) {
+    // the conjunction of 17 inputs cannot be decomposed without bound sets of at least two inputs
+    TruthTable tt;
+    tt.try_emplace(TruthTable::Cube::fromInteger((1ULL << 17U) - 1U, 17U), TruthTable::Cube::fromInteger(1U, 1U));
+    FunctionalDecompositionSettings settings;
+    settings.maxBoundSetSize = 1U;
+    EXPECT_FALSE(synthesizeDecomposed(tt, settings).has_value());
+}
+
+TEST_F(TestFunctionalDecomposition, BoundSetCandidatesAreLimitedByFunctionSize) {
+    // a single bound set is evaluated per function, which suffices to split off two inputs of the conjunction at a time
+    TruthTable tt;
+    tt.try_emplace(TruthTable::Cube::fromInteger((1ULL << 17U) - 1U, 17U), TruthTable::Cube::fromInteger(1U, 1U));
+    FunctionalDecompositionSettings settings;
+    settings.maxBoundSetEvaluations = 1U;
+    const auto statistics           = std::make_shared<Properties>();
+    const auto decomposed           = synthesizeDecomposed(tt, settings, statistics);
+    ASSERT_TRUE(decomposed.has_value());
+    checkRealizes(tt, *decomposed);
+    EXPECT_GT(statistics->get<std::uint64_t>("curtis_decompositions"), 0U);
+    EXPECT_LE(statistics->get<std::uint64_t>("max_sub_table_inputs"), settings.maxLeafInputs);
+}
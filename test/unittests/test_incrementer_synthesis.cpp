@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <tuple>
+
+using namespace syrec;
+
+namespace {
+    // Qubit indices of the parameters of the main module in ./circuits/increment_4.src
+    constexpr std::size_t OPERAND_BITWIDTH = 4;
+    constexpr std::size_t X_OFFSET         = 0;
+    constexpr std::size_t Y_OFFSET         = 4;
+    constexpr std::size_t C_OFFSET         = 8;
+
+    std::uint64_t readValue(const NBitValuesContainer& state, const std::size_t offset, const std::size_t bitwidth) {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < bitwidth; ++i) {
+            value |= static_cast<std::uint64_t>(state[offset + i]) << i;
+        }
+        return value;
+    }
+} // namespace
+
+class SyrecIncrementerSynthesisTest: public testing::TestWithParam<std::tuple<std::string, bool>> {
+protected:
+    Program         prog;
+    Properties::ptr settings = std::make_shared<Properties>();
+
+    void SetUp() override {
+        settings->set("incrementer_implementation", std::get<0>(GetParam()));
+
+        const ReadProgramSettings readProgramSettings;
+        const std::string         errorString = prog.read("./circuits/increment_4.src", readProgramSettings);
+        ASSERT_TRUE(errorString.empty()) << errorString;
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(SyrecIncrementerSynthesisTest, SyrecIncrementerSynthesisTest,
+                         testing::Combine(
+                                 testing::Values("cascade", "carry_chain", "borrowed_qubits", "cost_based"),
+                                 testing::Bool()),
+                         [](const testing::TestParamInfo<SyrecIncrementerSynthesisTest::ParamType>& info) {
+                             return std::get<0>(info.param) + (std::get<1>(info.param) ? "_line_aware" : "_cost_aware"); });
+
+TEST_P(SyrecIncrementerSynthesisTest, ExhaustiveSimulation) {
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    if (std::get<1>(GetParam())) {
+        ASSERT_TRUE(LineAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+    } else {
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+    }
+
+    constexpr std::uint64_t mask = (1U << OPERAND_BITWIDTH) - 1U;
+    for (std::uint64_t x = 0; x <= mask; ++x) {
+        for (std::uint64_t y = 0; y <= mask; ++y) {
+            for (std::uint64_t c = 0; c < 2; ++c) {
+                const NBitValuesContainer inputState(annotatableQuantumComputation.getNqubits(), (x << X_OFFSET) | (y << Y_OFFSET) | (c << C_OFFSET));
+                NBitValuesContainer       outputState;
+                ASSERT_NO_FATAL_FAILURE(simpleSimulation(outputState, annotatableQuantumComputation, inputState));
+
+                ASSERT_EQ((x + 1U) & mask, readValue(outputState, X_OFFSET, OPERAND_BITWIDTH)) << "x=" << x << ", y=" << y << ", c=" << c;
+                ASSERT_EQ((y - c) & mask, readValue(outputState, Y_OFFSET, OPERAND_BITWIDTH)) << "x=" << x << ", y=" << y << ", c=" << c;
+                ASSERT_EQ(c, readValue(outputState, C_OFFSET, 1U));
+                // ancillary qubits are restored
+                for (std::size_t i = C_OFFSET + 1U; i < annotatableQuantumComputation.getNqubits(); ++i) {
+                    ASSERT_EQ(inputState[i], outputState[i]) << "Ancillary qubit " << i << " was not restored for x=" << x << ", y=" << y << ", c=" << c;
+                }
+            }
+        }
+    }
+}
+
+TEST(SyrecIncrementerSynthesisCostTest, CostBasedIncrementerIsCheaperThanCascade) {
+    Program                   prog;
+    const ReadProgramSettings readProgramSettings;
+    ASSERT_TRUE(prog.read("./circuits/increment_16.src", readProgramSettings).empty());
+
+    const auto cascadeSettings = std::make_shared<Properties>();
+    cascadeSettings->set("incrementer_implementation", std::string("cascade"));
+    AnnotatableQuantumComputation cascade;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(cascade, prog, cascadeSettings));
+
+    AnnotatableQuantumComputation costBased;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(costBased, prog));
+    ASSERT_EQ(costBased.getNqubits(), cascade.getNqubits());
+    ASSERT_LT(costBased.getQuantumCostForSynthesis(), cascade.getQuantumCostForSynthesis());
+
+    constexpr std::size_t   bitwidth = 16;
+    constexpr std::uint64_t mask     = (1U << bitwidth) - 1U;
+    for (const std::uint64_t value: {std::uint64_t{0}, std::uint64_t{1}, std::uint64_t{0x7FFF}, std::uint64_t{0xFFFF}, std::uint64_t{0x1234}}) {
+        const NBitValuesContainer inputState(costBased.getNqubits(), value | ((value ^ 0x5A5AU) << bitwidth));
+        NBitValuesContainer       outputState;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(outputState, costBased, inputState));
+        ASSERT_EQ((value + 1U) & mask, readValue(outputState, 0, bitwidth));
+        ASSERT_EQ(((value ^ 0x5A5AU) - 1U) & mask, readValue(outputState, bitwidth, bitwidth));
+    }
+}
+
+TEST(SyrecIncrementerSynthesisCostTest, UnknownIncrementerImplementationIsRejected) {
+    Program                   prog;
+    const ReadProgramSettings readProgramSettings;
+    ASSERT_TRUE(prog.read("./circuits/increment_4.src", readProgramSettings).empty());
+
+    const auto settings = std::make_shared<Properties>();
+    settings->set("incrementer_implementation", std::string("ripple"));
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_FALSE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, prog, settings));
+}
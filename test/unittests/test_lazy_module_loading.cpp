@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/binary_program.hpp"
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    void collectCalledModules(const Statement::vec& statements, std::set<const Module*>& reachable) {
+        for (const auto& statement: statements) {
+            const Module* target = nullptr;
+            if (const auto* callStatement = dynamic_cast<const CallStatement*>(statement.get()); callStatement != nullptr) {
+                target = callStatement->target.get();
+            } else if (const auto* uncallStatement = dynamic_cast<const UncallStatement*>(statement.get()); uncallStatement != nullptr) {
+                target = uncallStatement->target.get();
+            } else if (const auto* forStatement = dynamic_cast<const ForStatement*>(statement.get()); forStatement != nullptr) {
+                collectCalledModules(forStatement->statements, reachable);
+            } else if (const auto* ifStatement = dynamic_cast<const IfStatement*>(statement.get()); ifStatement != nullptr) {
+                collectCalledModules(ifStatement->thenStatements, reachable);
+                collectCalledModules(ifStatement->elseStatements, reachable);
+            }
+            if (target != nullptr && reachable.insert(target).second) {
+                collectCalledModules(target->statements, reachable);
+            }
+        }
+    }
+
+    void describeStatements(std::ostream& os, const Statement::vec& statements, const std::size_t depth) {
+        for (const auto& statement: statements) {
+            os << std::string(depth, ' ') << statement->lineNumber << ' ' << typeid(*statement).name();
+            if (const auto* callStatement = dynamic_cast<const CallStatement*>(statement.get()); callStatement != nullptr) {
+                os << " call " << callStatement->target->name;
+            } else if (const auto* uncallStatement = dynamic_cast<const UncallStatement*>(statement.get()); uncallStatement != nullptr) {
+                os << " uncall " << uncallStatement->target->name;
+            }
+            os << '\n';
+
+            if (const auto* forStatement = dynamic_cast<const ForStatement*>(statement.get()); forStatement != nullptr) {
+                describeStatements(os, forStatement->statements, depth + 1U);
+            } else if (const auto* ifStatement = dynamic_cast<const IfStatement*>(statement.get()); ifStatement != nullptr) {
+                describeStatements(os, ifStatement->thenStatements, depth + 1U);
+                describeStatements(os, ifStatement->elseStatements, depth + 1U);
+            }
+        }
+    }
+
+    std::string describeModules(const Program& program, const std::set<const Module*>& modules) {
+        std::ostringstream os;
+        for (const auto& module: program.modules()) {
+            if (modules.count(module.get()) != 0U) {
+                os << "module " << module->name << ' ' << module->parameters.size() << '\n';
+                describeStatements(os, module->statements, 1U);
+            }
+        }
+        return os.str();
+    }
+
+    std::string describeModules(const Program& program) {
+        std::set<const Module*> modules;
+        for (const auto& module: program.modules()) {
+            modules.emplace(module.get());
+        }
+        return describeModules(program, modules);
+    }
+
+    // Describes the modules of the program reachable from the main module in the order of the program
+    std::string describeReachableModules(const Program& program, const std::string& mainModuleName) {
+        auto main = program.findModule(mainModuleName.empty() ? "main" : mainModuleName);
+        if (!main && mainModuleName.empty() && !program.modules().empty()) {
+            main = program.modules().front();
+        }
+        std::set<const Module*> reachable;
+        if (main) {
+            reachable.emplace(main.get());
+            collectCalledModules(main->statements, reachable);
+        }
+        return describeModules(program, reachable);
+    }
+
+    ReadProgramSettings lazyLoading(const std::string& mainModule = std::string()) {
+        ReadProgramSettings settings;
+        settings.lazyLoading = true;
+        settings.mainModule  = mainModule;
+        return settings;
+    }
+
+    // The reachable modules of the lazily loaded program and of the completely parsed program have the same statements, line numbers and called modules
+    void expectReachableModulesOfSequentialParser(const std::function<std::string(Program&, const ReadProgramSettings&)>& read, const std::string& mainModule = std::string()) {
+        Program           sequential;
+        const std::string sequentialError = read(sequential, ReadProgramSettings{});
+        ASSERT_TRUE(sequentialError.empty()) << sequentialError;
+
+        Program           lazy;
+        const std::string lazyError = read(lazy, lazyLoading(mainModule));
+        ASSERT_TRUE(lazyError.empty()) << lazyError;
+        EXPECT_EQ(describeReachableModules(lazy, mainModule), describeReachableModules(sequential, mainModule));
+        // the lazily loaded program only consists of reachable modules
+        EXPECT_EQ(describeReachableModules(lazy, mainModule), describeModules(lazy));
+    }
+
+    std::vector<std::string> moduleNames(const Program& program) {
+        std::vector<std::string> names;
+        for (const auto& module: program.modules()) {
+            names.emplace_back(module->name);
+        }
+        return names;
+    }
+
+    const std::string LIBRARY = "module unused_broken(inout a(2))\n"
+                                "  ++= b\n"
+                                "module inc(inout a(2))\n"
+                                "  ++= a\n"
+                                "module unused_syntax(inout a(2))\n"
+                                "  ++= a +\n"
+                                "module dec(inout a(2))\n"
+                                "  --= a\n"
+                                "module twice(inout a(2))\n"
+                                "  for 2 do\n"
+                                "    if (a = 0) then call inc(a) else uncall dec(a) fi (a = 0)\n"
+                                "  rof\n"
+                                "module main(inout x(2))\n"
+                                "  call twice(x)\n"
+                                "module other(inout y(2))\n"
+                                "  call dec(y)\n";
+} // namespace
+
+class SyrecLazyModuleLoadingTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(SyrecLazyModuleLoadingTest, SyrecLazyModuleLoadingTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "call_8",
+                                 "for_32",
+                                 "gray_binary_conversion_16",
+                                 "negate_8",
+                                 "parity_check_16",
+                                 "simple_add_2"),
+                         [](const testing::TestParamInfo<SyrecLazyModuleLoadingTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecLazyModuleLoadingTest, SameReachableModulesAsSequentialParser) {
+    expectReachableModulesOfSequentialParser([this](Program& program, const ReadProgramSettings& settings) { return program.read("./circuits/" + GetParam() + ".src", settings); });
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, OnlyReachableModulesAreParsed) {
+    Program           program;
+    const std::string error = program.readFromString(LIBRARY, lazyLoading());
+    ASSERT_TRUE(error.empty()) << error;
+    EXPECT_EQ(moduleNames(program), (std::vector<std::string>{"inc", "dec", "twice", "main"}));
+
+    // the line numbers refer to the whole source
+    const auto twice = program.findModule("twice");
+    ASSERT_NE(twice, nullptr);
+    ASSERT_EQ(twice->statements.size(), 1U);
+    EXPECT_EQ(twice->statements.front()->lineNumber, 10U);
+    EXPECT_EQ(program.findModule("main")->statements.front()->lineNumber, 14U);
+
+    // the unreachable modules with errors prevent the complete parsing
+    Program sequential;
+    EXPECT_FALSE(sequential.readFromString(LIBRARY).empty());
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, MainModuleCanBeSelected) {
+    Program           program;
+    const std::string error = program.readFromString(LIBRARY, lazyLoading("other"));
+    ASSERT_TRUE(error.empty()) << error;
+    EXPECT_EQ(moduleNames(program), (std::vector<std::string>{"dec", "other"}));
+
+    Program unknown;
+    EXPECT_EQ(unknown.readFromString(LIBRARY, lazyLoading("missing")), "Unknown module missing");
+
+    // modules with underscores in their names can be selected as main module
+    Program    broken;
+    const auto brokenError = broken.readFromString(LIBRARY, lazyLoading("unused_broken"));
+    EXPECT_EQ(brokenError.rfind("In line 0: Unknown variable ", 0), 0U) << brokenError;
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, SelectedMainModuleIsSynthesized) {
+    Program program;
+    ASSERT_TRUE(program.readFromString(LIBRARY, lazyLoading("other")).empty());
+    EXPECT_EQ(program.mainModule(), "other");
+
+    // the synthesis starts at the module the program was loaded for instead of its first module 'dec'
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+    const auto qubitLabels = annotatableQuantumComputation.getQubitLabels();
+    ASSERT_GE(qubitLabels.size(), 2U);
+    EXPECT_EQ(qubitLabels[0], "y.0");
+    EXPECT_EQ(qubitLabels[1], "y.1");
+
+    // the main module is also recorded if the program is read from the binary cache of its source file
+    const std::string sourceFilename = "./lazy_module_loading_test.src";
+    const std::string cacheFilename  = "./lazy_module_loading_test.bin";
+    std::ofstream(sourceFilename) << LIBRARY;
+    Program uncached;
+    ASSERT_TRUE(readProgramWithCache(uncached, sourceFilename, cacheFilename, lazyLoading("other")).empty());
+    Program cached;
+    ASSERT_TRUE(readProgramWithCache(cached, sourceFilename, cacheFilename, lazyLoading("other")).empty());
+    std::remove(sourceFilename.c_str());
+    std::remove(cacheFilename.c_str());
+    EXPECT_EQ(cached.mainModule(), "other");
+
+    // the main module of the synthesis settings takes precedence
+    const auto settings = std::make_shared<Properties>();
+    settings->set("main_module", std::string("dec"));
+    AnnotatableQuantumComputation decComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(decComputation, program, settings));
+    ASSERT_FALSE(decComputation.getQubitLabels().empty());
+    EXPECT_EQ(decComputation.getQubitLabels().front(), "a.0");
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, FirstModuleIsMainModuleWithoutModuleNamedMain) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module a(inout x(2))\n++= x\nmodule b(inout y(2))\ncall a(y)\nmodule c(inout z(2))\ncall b(z)\n", lazyLoading()).empty());
+    EXPECT_EQ(moduleNames(program), (std::vector<std::string>{"a"}));
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, CallsAreLinkedToFirstPrecedingModule) {
+    const std::string source = "// module in a comment\n"
+                               "/* module x(inout y(2)) */\n"
+                               "module a(inout x(2))\n"
+                               "  ++= x // module\n"
+                               "module a(inout x(3))\n"
+                               "  --= x\n"
+                               "module b(inout y(2))\n"
+                               "  call a(y)\n"
+                               "  uncall a(y)\n"
+                               "module /* name */ c(inout z(2)) call b(z)\n";
+    expectReachableModulesOfSequentialParser([&](Program& program, const ReadProgramSettings& settings) { return program.readFromString(source, settings); }, "c");
+
+    Program program;
+    ASSERT_TRUE(program.readFromString(source, lazyLoading("c")).empty());
+    EXPECT_EQ(moduleNames(program), (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(program.modules().front()->parameters.front()->bitwidth, 2U);
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, ErrorsOfReachableModules) {
+    {
+        // calls of succeeding modules are rejected like by the sequential parser
+        Program program;
+        EXPECT_EQ(program.readFromString("module main(inout x(2))\ncall a(x)\nmodule a(inout y(2))\n++= y\n", lazyLoading()), "In line 0: Unknown module a");
+    }
+    {
+        // the line number of an error is the one of the last parsed statement of the reachable modules
+        const std::string source = "module a(inout x(2))\n++= x\nmodule unused(inout w(2))\n++= w\nmodule main(inout y(2))\ncall a(y)\n++= z\n";
+        Program           sequential;
+        Program           lazy;
+        const auto        error = lazy.readFromString(source, lazyLoading());
+        EXPECT_EQ(error.rfind("In line 6: Unknown variable ", 0), 0U) << error;
+        EXPECT_EQ(error, sequential.readFromString(source));
+    }
+    {
+        Program program;
+        EXPECT_EQ(program.readFromString("module a(inout x(2))\n++= x\nmodule main(inout y(2))\ncall a(y, y)\n", lazyLoading()), "In line 2: Wrong number of arguments in (un)call of a. Expected 1, got 2");
+    }
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, SequentialParserIsUsedIfSourceCannotBeIndexed) {
+    // a syntax error in a reachable module and an identifier starting with the module keyword
+    for (const auto* const content: {"module main(inout x(2))\n++= x +\n", "module main(inout x(2))\ncall modulex(x)\n"}) {
+        Program sequential;
+        Program lazy;
+        EXPECT_EQ(lazy.readFromString(content, lazyLoading()), sequential.readFromString(content));
+    }
+}
+
+TEST(SyrecLazyModuleLoadingErrorTest, LazyLoadingIsPartOfSourceHash) {
+    EXPECT_NE(sourceHash(LIBRARY), sourceHash(LIBRARY, lazyLoading()));
+    EXPECT_NE(sourceHash(LIBRARY, lazyLoading()), sourceHash(LIBRARY, lazyLoading("other")));
+    ReadProgramSettings parallel;
+    parallel.parallelParsing = true;
+    EXPECT_EQ(sourceHash(LIBRARY), sourceHash(LIBRARY, parallel));
+}
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/loop_invariant_code_motion.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/expression.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    // Number of qubits of the parameters of the main module in ./circuits/for_invariant_4.src
+    constexpr std::size_t N_PARAMETER_QUBITS = 16;
+
+    template<typename T>
+    const T* statementAs(const Statement::ptr& statement) {
+        return dynamic_cast<const T*>(statement.get());
+    }
+
+    // Whether the statement computes the expression of the statement into the wire by an XOR assignment
+    bool isComputationIntoWire(const Statement::ptr& statement, const Variable::ptr& wire) {
+        const auto* assignStatement = statementAs<AssignStatement>(statement);
+        return assignStatement != nullptr && assignStatement->op == AssignStatement::Exor && assignStatement->lhs->getVar() == wire && dynamic_cast<const BinaryExpression*>(assignStatement->rhs.get()) != nullptr;
+    }
+
+    bool readsWire(const Expression::ptr& expression, const Variable::ptr& wire) {
+        const auto* variableExpression = dynamic_cast<const VariableExpression*>(expression.get());
+        return variableExpression != nullptr && variableExpression->var->getVar() == wire;
+    }
+} // namespace
+
+TEST(SyrecLoopInvariantCodeMotionTest, InvariantExpressionsAreMovedOutOfLoop) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/for_invariant_4.src").empty());
+    const auto statistics = std::make_shared<Properties>();
+    EXPECT_EQ(hoistLoopInvariantExpressions(program, LoopInvariantCodeMotionSettings{}, statistics), 2U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("invariant_expressions"), 2U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("removed_evaluations"), 4U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("wire_qubits"), 8U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("quantum_cost", std::uint64_t{0}), 0U);
+
+    const auto& module = *program.modules().front();
+    ASSERT_EQ(module.variables.size(), 2U);
+    for (const auto& wire: module.variables) {
+        EXPECT_EQ(wire->type, Variable::Wire);
+        EXPECT_EQ(wire->bitwidth, 4U);
+    }
+
+    // the wires are computed in front of the loop and uncomputed in reverse order behind it
+    const auto& statements = module.statements;
+    ASSERT_EQ(statements.size(), 5U);
+    EXPECT_TRUE(isComputationIntoWire(statements[0], module.variables[0]));
+    EXPECT_TRUE(isComputationIntoWire(statements[1], module.variables[1]));
+    EXPECT_TRUE(isComputationIntoWire(statements[3], module.variables[1]));
+    EXPECT_TRUE(isComputationIntoWire(statements[4], module.variables[0]));
+    EXPECT_EQ(statements[0]->lineNumber, statements[2]->lineNumber);
+
+    const auto* forStatement = statementAs<ForStatement>(statements[2]);
+    ASSERT_NE(forStatement, nullptr);
+    ASSERT_EQ(forStatement->statements.size(), 2U);
+    EXPECT_TRUE(readsWire(statementAs<AssignStatement>(forStatement->statements[0])->rhs, module.variables[0]));
+    const auto* sum = dynamic_cast<const BinaryExpression*>(statementAs<AssignStatement>(forStatement->statements[1])->rhs.get());
+    ASSERT_NE(sum, nullptr);
+    EXPECT_TRUE(readsWire(sum->lhs, module.variables[1]));
+}
+
+TEST(SyrecLoopInvariantCodeMotionTest, VariantExpressionsAreKept) {
+    Program program;
+    // the expressions reference the loop variable, a loop variable of a nested loop or a variable written in the loop or are evaluated only twice
+    ASSERT_TRUE(program.readFromString("module main(in a(4), in b(4), inout x(4), inout y(4))\n"
+                                       "for $i = 0 to 3 do\n"
+                                       "  x += (a + $i);\n"
+                                       "  y += (x + a);\n"
+                                       "  for $j = 0 to 2 do\n"
+                                       "    x ^= (a - $j)\n"
+                                       "  rof\n"
+                                       "rof\n"
+                                       "for $i = 0 to 1 do\n"
+                                       "  x += (a + b)\n"
+                                       "rof\n")
+                        .empty());
+    const auto statistics = std::make_shared<Properties>();
+    EXPECT_EQ(hoistLoopInvariantExpressions(program, LoopInvariantCodeMotionSettings{}, statistics), 0U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("removed_evaluations"), 0U);
+    EXPECT_EQ(program.modules().front()->statements.size(), 2U);
+    EXPECT_TRUE(program.modules().front()->variables.empty());
+}
+
+TEST(SyrecLoopInvariantCodeMotionTest, ExpressionsAreMovedOutOfNestedLoopsAndConditions) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module main(in a(4), in b(4), inout x(4), inout y(4))\n"
+                                       "for $i = 0 to 2 do\n"
+                                       "  if ((a + b) = 0) then\n"
+                                       "    ++= y\n"
+                                       "  else\n"
+                                       "    x += (a + b)\n"
+                                       "  fi ((a + b) = 0);\n"
+                                       "  for $j = 0 to 2 do\n"
+                                       "    y ^= (a - $i)\n"
+                                       "  rof\n"
+                                       "rof\n")
+                        .empty());
+    // the (fi) condition and the right-hand side of the assignment are moved out of the outer loop, the assignment referencing $i out of the inner loop only
+    EXPECT_EQ(hoistLoopInvariantExpressions(program), 3U);
+
+    const auto& module = *program.modules().front();
+    ASSERT_EQ(module.variables.size(), 3U);
+    EXPECT_EQ(module.variables[0]->bitwidth, 1U);
+    EXPECT_EQ(module.variables[1]->bitwidth, 4U);
+    EXPECT_EQ(module.variables[2]->bitwidth, 4U);
+    ASSERT_EQ(module.statements.size(), 5U);
+
+    const auto* outerLoop = statementAs<ForStatement>(module.statements[2]);
+    ASSERT_NE(outerLoop, nullptr);
+    ASSERT_EQ(outerLoop->statements.size(), 4U);
+    const auto* ifStatement = statementAs<IfStatement>(outerLoop->statements[0]);
+    ASSERT_NE(ifStatement, nullptr);
+    EXPECT_TRUE(readsWire(ifStatement->condition, module.variables[0]));
+    EXPECT_TRUE(readsWire(ifStatement->fiCondition, module.variables[0]));
+    EXPECT_TRUE(readsWire(statementAs<AssignStatement>(ifStatement->elseStatements.front())->rhs, module.variables[1]));
+
+    EXPECT_TRUE(isComputationIntoWire(outerLoop->statements[1], module.variables[2]));
+    const auto* innerLoop = statementAs<ForStatement>(outerLoop->statements[2]);
+    ASSERT_NE(innerLoop, nullptr);
+    EXPECT_TRUE(readsWire(statementAs<AssignStatement>(innerLoop->statements.front())->rhs, module.variables[2]));
+    EXPECT_TRUE(isComputationIntoWire(outerLoop->statements[3], module.variables[2]));
+}
+
+TEST(SyrecLoopInvariantCodeMotionTest, WireNamesDoNotClashAndSharedStatementsAreNotModified) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module main(in licm0(4), in b(4), inout x(4))\n"
+                                       "for $i = 0 to 3 do\n"
+                                       "  x += (licm0 | b)\n"
+                                       "rof\n")
+                        .empty());
+    const auto original = program.modules().front()->statements.front();
+    ASSERT_EQ(hoistLoopInvariantExpressions(program), 1U);
+    ASSERT_EQ(program.modules().front()->variables.size(), 1U);
+    EXPECT_EQ(program.modules().front()->variables.front()->name, "licm1");
+
+    const auto* forStatement = statementAs<ForStatement>(original);
+    ASSERT_NE(forStatement, nullptr);
+    EXPECT_NE(dynamic_cast<const BinaryExpression*>(statementAs<AssignStatement>(forStatement->statements.front())->rhs.get()), nullptr);
+}
+
+TEST(SyrecLoopInvariantCodeMotionTest, WireNamesAreUniqueInProgramWithCalledModule) {
+    const std::string source = "module add(in a(2), in b(2), inout x(2))\n"
+                               "for $i = 0 to 3 do\n"
+                               "  x += (a + b)\n"
+                               "rof\n"
+                               "module main(in a(2), in b(2), inout x(2))\n"
+                               "for $i = 0 to 3 do\n"
+                               "  x ^= (a | b)\n"
+                               "rof;\n"
+                               "call add(a, b, x)\n";
+    Program original;
+    ASSERT_TRUE(original.readFromString(source).empty());
+    Program moved;
+    ASSERT_TRUE(moved.readFromString(source).empty());
+    ASSERT_EQ(hoistLoopInvariantExpressions(moved), 2U);
+    ASSERT_EQ(moved.findModule("add")->variables.size(), 1U);
+    ASSERT_EQ(moved.findModule("main")->variables.size(), 1U);
+    EXPECT_EQ(moved.findModule("add")->variables.front()->name, "licm0");
+    EXPECT_EQ(moved.findModule("main")->variables.front()->name, "licm1");
+
+    // the qubits of the wires of the called module and of the main module have distinct labels
+    AnnotatableQuantumComputation originalCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(originalCircuit, original));
+    AnnotatableQuantumComputation movedCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(movedCircuit, moved));
+
+    constexpr std::size_t nParameterQubits = 6;
+    for (std::uint64_t input = 0; input < (std::uint64_t{1} << nParameterQubits); ++input) {
+        NBitValuesContainer originalOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(originalOutput, originalCircuit, NBitValuesContainer(originalCircuit.getNqubits(), input)));
+        NBitValuesContainer movedOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(movedOutput, movedCircuit, NBitValuesContainer(movedCircuit.getNqubits(), input)));
+        for (std::size_t i = 0; i < nParameterQubits; ++i) {
+            ASSERT_EQ(originalOutput[i], movedOutput[i]) << "Qubit " << i << " differs for input " << input;
+        }
+    }
+}
+
+TEST(SyrecLoopInvariantCodeMotionTest, CodeMotionKeepsFunctionalityAndReducesQuantumCost) {
+    Program original;
+    ASSERT_TRUE(original.read("./circuits/for_invariant_4.src").empty());
+    Program moved;
+    ASSERT_TRUE(moved.read("./circuits/for_invariant_4.src").empty());
+
+    LoopInvariantCodeMotionSettings settings;
+    settings.measureSavings = true;
+    const auto statistics   = std::make_shared<Properties>();
+    ASSERT_EQ(hoistLoopInvariantExpressions(moved, settings, statistics), 2U);
+    EXPECT_LT(statistics->get<std::uint64_t>("quantum_cost"), statistics->get<std::uint64_t>("initial_quantum_cost"));
+    // the qubits of the wires are ancillary qubits as well, thus the saved ancillary qubits are net of them
+    EXPECT_LT(statistics->get<std::uint64_t>("ancillary_qubits"), statistics->get<std::uint64_t>("initial_ancillary_qubits"));
+
+    AnnotatableQuantumComputation originalCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(originalCircuit, original));
+    AnnotatableQuantumComputation movedCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(movedCircuit, moved));
+    EXPECT_EQ(movedCircuit.getQuantumCostForSynthesis(), statistics->get<std::uint64_t>("quantum_cost"));
+    for (std::size_t qubit = N_PARAMETER_QUBITS; qubit < N_PARAMETER_QUBITS + statistics->get<std::uint64_t>("wire_qubits"); ++qubit) {
+        EXPECT_TRUE(movedCircuit.getAncillary()[qubit]) << "Qubit " << qubit << " of a wire is no ancillary qubit";
+    }
+
+    // the qubits of the wires follow the ones of the parameters and are zero-initialized like the ancillary qubits
+    for (std::uint64_t input = 0; input < (std::uint64_t{1} << N_PARAMETER_QUBITS); ++input) {
+        NBitValuesContainer originalOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(originalOutput, originalCircuit, NBitValuesContainer(originalCircuit.getNqubits(), input)));
+        NBitValuesContainer movedOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(movedOutput, movedCircuit, NBitValuesContainer(movedCircuit.getNqubits(), input)));
+        for (std::size_t i = 0; i < N_PARAMETER_QUBITS; ++i) {
+            ASSERT_EQ(originalOutput[i], movedOutput[i]) << "Qubit " << i << " differs for input " << input;
+        }
+    }
+}
@@ -0,0 +1,183 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "algorithms/synthesis/syrec_line_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/memory_report.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/bdd_truth_table.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "dd/Package.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <utility>
+
+using namespace syrec;
+
+TEST(MemoryReportTest, AccumulatesCategoriesAndPeaks) {
+    MemoryReport report;
+    report.add("ir.statements", 100U, 2U);
+    report.add("ir.statements", 50U);
+    report.add("qc.operations", 10U, 0U);
+    report.recordPhase("parse", 20U);
+    report.recordPhase("synthesis", 40U);
+    report.recordPhase("parse", 10U);
+
+    ASSERT_EQ(report.getCategories().size(), 2U);
+    EXPECT_EQ(report.getCategories().at("ir.statements").bytes, 150U);
+    EXPECT_EQ(report.getCategories().at("ir.statements").objects, 3U);
+    EXPECT_EQ(report.totalBytes(), 160U);
+    EXPECT_EQ(report.totalObjects(), 3U);
+
+    ASSERT_EQ(report.getPeakBytesPerPhase().size(), 2U);
+    EXPECT_EQ(report.getPeakBytesPerPhase()[0].first, "parse");
+    EXPECT_EQ(report.getPeakBytesPerPhase()[0].second, 20U);
+    EXPECT_EQ(report.getPeakBytesPerPhase()[1].second, 40U);
+
+    MemoryReport other;
+    other.add("qc.operations", 5U, 1U);
+    other.recordPhase("synthesis", 80U);
+    report.merge(other);
+    EXPECT_EQ(report.getCategories().at("qc.operations").bytes, 15U);
+    EXPECT_EQ(report.getPeakBytesPerPhase()[1].second, 80U);
+    EXPECT_NE(report.toString().find("qc.operations"), std::string::npos);
+}
+
+TEST(MemoryReportTest, DynamicBytesOfStrings) {
+    EXPECT_EQ(MemoryReport::dynamicBytes(std::string()), 0U);
+    EXPECT_GT(MemoryReport::dynamicBytes(std::string(1000U, 'a')), 1000U);
+}
+
+TEST(MemoryReportTest, ProgramAndSynthesis) {
+    Program           program;
+    const std::string errorMessage = program.read("./circuits/alu_2.src");
+    ASSERT_TRUE(errorMessage.empty()) << errorMessage;
+
+    const auto irReport = program.memoryReport();
+    EXPECT_EQ(irReport.getCategories().at("ir.modules").objects, program.modules().size());
+    EXPECT_GT(irReport.getCategories().at("ir.statements").objects, 0U);
+    EXPECT_GT(irReport.getCategories().at("ir.variables").objects, 0U);
+
+    const auto settings   = std::make_shared<Properties>();
+    const auto statistics = std::make_shared<Properties>();
+    settings->set("memory_report", true);
+
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, statistics));
+
+    const auto report = statistics->get<MemoryReport>("memory_report");
+    EXPECT_EQ(report.getCategories().at("qc.operations").objects, annotatableQuantumComputation.getNops());
+    EXPECT_GE(report.getCategories().at("qc.qubit_registers").objects, annotatableQuantumComputation.getNqubits());
+    EXPECT_EQ(report.getCategories().at("ir.statements").objects, irReport.getCategories().at("ir.statements").objects);
+
+    // every phase is reported and the peak of the statements includes the footprint at their end
+    ASSERT_EQ(report.getPeakBytesPerPhase().size(), 2U);
+    EXPECT_EQ(report.getPeakBytesPerPhase()[0].first, "variables");
+    EXPECT_EQ(report.getPeakBytesPerPhase()[1].first, "statements");
+    EXPECT_LE(report.getPeakBytesPerPhase()[0].second, report.getPeakBytesPerPhase()[1].second);
+    EXPECT_GE(report.getPeakBytesPerPhase()[1].second, report.totalBytes());
+}
+
+TEST(MemoryReportTest, PeakIsSampledDuringThePhase) {
+    // the mapping of the loop variable with a name not fitting into the small string buffer only exists during the synthesis of the loop which adds the last gates of the program
+    const std::string loopVariable(256U, 'i');
+    Program           program;
+    const std::string errorMessage = program.readFromString("module main(inout a(4), in b(4))\n\tfor $" + loopVariable + " = 0 to 1 do\n\t\ta += b\n\trof\n");
+    ASSERT_TRUE(errorMessage.empty()) << errorMessage;
+
+    const auto peakOfStatements = [&program](const unsigned samplingInterval) {
+        const auto settings   = std::make_shared<Properties>();
+        const auto statistics = std::make_shared<Properties>();
+        settings->set("memory_report", true);
+        settings->set("memory_report_sampling_interval", samplingInterval);
+
+        AnnotatableQuantumComputation annotatableQuantumComputation;
+        EXPECT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, settings, statistics));
+        const auto report = statistics->get<MemoryReport>("memory_report");
+        return std::make_pair(report.getPeakBytesPerPhase().back().second, report.totalBytes());
+    };
+
+    // without sampling during the phase, only the footprint at its end is recorded
+    const auto [peakAtEnd, totalBytesAtEnd] = peakOfStatements(0U);
+    EXPECT_EQ(peakAtEnd, totalBytesAtEnd);
+
+    // sampling after every statement adding gates records the footprint during the loop
+    const auto [sampledPeak, totalBytes] = peakOfStatements(1U);
+    EXPECT_EQ(totalBytes, totalBytesAtEnd);
+    EXPECT_GT(sampledPeak, peakAtEnd);
+    EXPECT_GE(sampledPeak - peakAtEnd, loopVariable.size());
+}
+
+TEST(MemoryReportTest, SampledBytesOfQuantumComputation) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/alu_2.src").empty());
+
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program, std::make_shared<Properties>(), std::make_shared<Properties>()));
+
+    AnnotatableQuantumComputation::MemorySampler sampler;
+    EXPECT_EQ(annotatableQuantumComputation.sampleMemoryBytes(sampler), annotatableQuantumComputation.memoryReport().totalBytes());
+    EXPECT_EQ(sampler.nAccountedQuantumOperations, annotatableQuantumComputation.getNops());
+
+    // only the quantum operations added since the last sample are accounted
+    AnnotatableQuantumComputation incrementalComputation;
+    const auto                    firstQubit  = incrementalComputation.addNonAncillaryQubit("a", false);
+    const auto                    secondQubit = incrementalComputation.addNonAncillaryQubit("b", false);
+    ASSERT_TRUE(firstQubit.has_value() && secondQubit.has_value());
+
+    AnnotatableQuantumComputation::MemorySampler incrementalSampler;
+    for (std::size_t i = 0; i < 4U; ++i) {
+        ASSERT_TRUE(incrementalComputation.addOperationsImplementingCnotGate(*firstQubit, *secondQubit));
+        EXPECT_EQ(incrementalComputation.sampleMemoryBytes(incrementalSampler), incrementalComputation.memoryReport().totalBytes());
+    }
+
+    // the data of the control qubit propagation is freed again when its scope is deactivated
+    incrementalComputation.activateControlQubitPropagationScope();
+    ASSERT_TRUE(incrementalComputation.registerControlQubitForPropagationInCurrentAndNestedScopes(*firstQubit));
+    const auto bytesInScope = incrementalComputation.sampleMemoryBytes(incrementalSampler);
+    EXPECT_EQ(bytesInScope, incrementalComputation.memoryReport().totalBytes());
+    incrementalComputation.deactivateControlQubitPropagationScope();
+    EXPECT_LT(incrementalComputation.sampleMemoryBytes(incrementalSampler), bytesInScope);
+}
+
+TEST(MemoryReportTest, NoReportUnlessRequested) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/alu_2.src").empty());
+
+    const auto                    statistics = std::make_shared<Properties>();
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(LineAwareSynthesis::synthesize(annotatableQuantumComputation, program, std::make_shared<Properties>(), statistics));
+    EXPECT_EQ(statistics->get<double>("memory_report", -1.), -1.);
+}
+
+TEST(MemoryReportTest, TruthTables) {
+    TruthTable    tt{};
+    BddTruthTable bddTT{};
+    ASSERT_TRUE(readPla(tt, "./circuits/hwb4_12.pla"));
+    ASSERT_TRUE(readPla(bddTT, "./circuits/hwb4_12.pla"));
+
+    const auto ttReport = tt.memoryReport();
+    EXPECT_EQ(ttReport.getCategories().at("truth_table.cubes").objects, 16U);
+
+    const auto bddReport = bddTT.memoryReport();
+    EXPECT_EQ(bddReport.getCategories().at("bdd.nodes").objects, bddTT.getPackage()->size());
+    EXPECT_EQ(bddReport.getCategories().at("truth_table.bdd_roots").objects, 8U);
+
+    auto       dd       = std::make_unique<dd::Package>(4U);
+    const auto ddReport = memoryReportOfDD(buildDD(tt, dd));
+    EXPECT_GT(ddReport.getCategories().at("dd.nodes").objects, 0U);
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/syrec/module.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <gtest/gtest.h>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    // Describes the statements with their line numbers and the index of the module called by a (un)call statement
+    void describeStatements(std::ostream& os, const Statement::vec& statements, const std::map<const Module*, std::size_t>& indexOfModule, const std::size_t depth) {
+        for (const auto& statement: statements) {
+            os << std::string(depth, ' ') << statement->lineNumber << ' ' << typeid(*statement).name();
+            if (const auto* callStatement = dynamic_cast<const CallStatement*>(statement.get()); callStatement != nullptr) {
+                os << " call " << indexOfModule.at(callStatement->target.get());
+            } else if (const auto* uncallStatement = dynamic_cast<const UncallStatement*>(statement.get()); uncallStatement != nullptr) {
+                os << " uncall " << indexOfModule.at(uncallStatement->target.get());
+            }
+            os << '\n';
+
+            if (const auto* forStatement = dynamic_cast<const ForStatement*>(statement.get()); forStatement != nullptr) {
+                describeStatements(os, forStatement->statements, indexOfModule, depth + 1U);
+            } else if (const auto* ifStatement = dynamic_cast<const IfStatement*>(statement.get()); ifStatement != nullptr) {
+                describeStatements(os, ifStatement->thenStatements, indexOfModule, depth + 1U);
+                describeStatements(os, ifStatement->elseStatements, indexOfModule, depth + 1U);
+            }
+        }
+    }
+
+    std::string describe(const Program& program) {
+        std::map<const Module*, std::size_t> indexOfModule;
+        for (const auto& module: program.modules()) {
+            indexOfModule.emplace(module.get(), indexOfModule.size());
+        }
+
+        std::ostringstream os;
+        for (const auto& module: program.modules()) {
+            os << "module " << module->name << ' ' << module->parameters.size() << '\n';
+            describeStatements(os, module->statements, indexOfModule, 1U);
+        }
+        return os.str();
+    }
+
+    ReadProgramSettings parallelParsing() {
+        ReadProgramSettings settings;
+        settings.parallelParsing = true;
+        settings.nThreads        = 4U;
+        return settings;
+    }
+
+    void expectSameResultAsSequentialParser(const std::function<std::string(Program&, const ReadProgramSettings&)>& read) {
+        Program           sequential;
+        const std::string sequentialError = read(sequential, ReadProgramSettings{});
+        Program           parallel;
+        const std::string parallelError = read(parallel, parallelParsing());
+        EXPECT_EQ(parallelError, sequentialError);
+        EXPECT_EQ(describe(parallel), describe(sequential));
+    }
+
+    void expectSameResultAsSequentialParserForSource(const std::string& source) {
+        expectSameResultAsSequentialParser([&](Program& program, const ReadProgramSettings& settings) { return program.readFromString(source, settings); });
+    }
+} // namespace
+
+class SyrecParallelParserTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(SyrecParallelParserTest, SyrecParallelParserTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "call_8",
+                                 "dynamic_index_2",
+                                 "for_32",
+                                 "gray_binary_conversion_16",
+                                 "negate_8",
+                                 "parity_check_16",
+                                 "simple_add_2",
+                                 "skip"),
+                         [](const testing::TestParamInfo<SyrecParallelParserTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(SyrecParallelParserTest, SameProgramAsSequentialParser) {
+    expectSameResultAsSequentialParser([this](Program& program, const ReadProgramSettings& settings) { return program.read("./circuits/" + GetParam() + ".src", settings); });
+}
+
+TEST(SyrecParallelParserErrorTest, LinksCallsToFirstPrecedingModule) {
+    expectSameResultAsSequentialParserForSource("// module in a comment\n"
+                                                "/* module x(inout y(2)) */\n"
+                                                "module a(inout x(2))\n"
+                                                "  ++= x // module\n"
+                                                "module a(inout x(3))\n"
+                                                "  --= x\n"
+                                                "module b(inout y(2))\n"
+                                                "  call a(y)\n"
+                                                "  uncall a(y)\n"
+                                                "module c(inout z(2)) call b(z)\n");
+}
+
+TEST(SyrecParallelParserErrorTest, SameErrorsAsSequentialParser) {
+    // calls of succeeding modules and of the calling module itself
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\n\nmodule b(inout y(2))\ncall c(y)\nmodule c(inout z(2))\n++= z\n");
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\nmodule b(inout y(2))\ncall b(y)\n");
+    // invalid arguments
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\nmodule b(inout y(3))\ncall a(y)\n");
+    // the line number of an error is the one of the last parsed statement, which can be part of a nested statement or of a preceding module
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\nmodule b(inout y(2))\nfor $i = 0 to 1 do\n ++= y\n ++= z\nrof\n");
+    expectSameResultAsSequentialParserForSource("\n\nmodule a(inout x(2))\n++= x\nmodule b(inout y(2))\n++= q\n");
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\nmodule b(inout y(2), in y(1))\n++= y\nmodule c(inout z(2))\n++= w\n");
+    expectSameResultAsSequentialParserForSource("module a(inout x(2), inout x(2))\n++= x\n");
+    // syntax errors and identifiers starting with the module keyword are handled by the sequential parser
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\n++= x\nmodule b(inout y(2))\n++= y +\n");
+    expectSameResultAsSequentialParserForSource("module a(inout x(2))\ncall modulex(x)\n");
+}
@@ -26,6 +26,7 @@ protected:
 
 INSTANTIATE_TEST_SUITE_P(SyrecParserTest, SyrecParserTest,
                          testing::Values(
+                                 "accumulator_4",
                                  "alu_2",
                                  "binary_numeric",
                                  "bitwise_and_2",
@@ -64,3 +65,12 @@ TEST_P(SyrecParserTest, GenericParserTest) {
     errorString = prog.read(fileName, settings);
     EXPECT_TRUE(errorString.empty());
 }
+
+TEST(SyrecParserIdentifierTest, IdentifiersKeepUnderscores) {
+    Program           prog;
+    const std::string errorString = prog.read("./circuits/call_8.src", ReadProgramSettings{});
+    ASSERT_TRUE(errorString.empty()) << errorString;
+    const auto module = prog.findModule("call_func");
+    ASSERT_NE(module, nullptr);
+    EXPECT_EQ(module->name, "call_func");
+}
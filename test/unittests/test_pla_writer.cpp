@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "core/io/pla_parser.hpp"
+#include "core/io/pla_writer.hpp"
+#include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <memory>
+#include <sstream>
+#include <string>
+
+using namespace syrec;
+
+class PlaWriterTest: public testing::Test {
+protected:
+    std::string testCircuitsDir = "./circuits/";
+
+    static std::string written(const TruthTable& tt, const PlaWriterSettings& settings = PlaWriterSettings{}) {
+        std::ostringstream os;
+        writePla(tt, os, settings);
+        return os.str();
+    }
+
+    static TruthTable readBack(const std::string& content) {
+        TruthTable         tt;
+        std::istringstream is(content);
+        parsePla(tt, is);
+        extend(tt);
+        return tt;
+    }
+};
+
+TEST_F(PlaWriterTest, AdjacentMintermsWithTheSameOutputAreMerged) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, testCircuitsDir + "and.pla"));
+
+    // 00 and 10 differ in the first input only, 01 is left since its neighbor 11 has another output
+    EXPECT_EQ(written(tt), ".i 2\n.o 1\n.p 3\n-0 0\n01 0\n11 1\n.e\n");
+
+    PlaWriterSettings settings;
+    settings.mergeCubes = false;
+    EXPECT_EQ(written(tt, settings), ".i 2\n.o 1\n.p 4\n00 0\n01 0\n10 0\n11 1\n.e\n");
+
+    // the zero outputs are restored when extending the truth table
+    settings.mergeCubes      = true;
+    settings.omitZeroOutputs = true;
+    const auto withoutZeros  = written(tt, settings);
+    EXPECT_EQ(withoutZeros, ".i 2\n.o 1\n.p 1\n11 1\n.e\n");
+    EXPECT_EQ(readBack(withoutZeros), tt);
+}
+
+TEST_F(PlaWriterTest, FunctionOfFewInputsIsWrittenAsFewCubes) {
+    constexpr std::size_t nInputs = 12;
+    TruthTable            tt;
+    for (std::uint64_t input = 0; input < (1ULL << nInputs); ++input) {
+        // the output only depends on the first and the last input
+        const bool first = (input >> (nInputs - 1U)) & 1U;
+        const bool last  = input & 1U;
+        tt.try_emplace(TruthTable::Cube::fromInteger(input, nInputs), TruthTable::Cube::fromInteger(((first ? 1U : 0U) << 1U) | ((first && last) ? 1U : 0U), 2U));
+    }
+
+    const auto statistics = std::make_shared<Properties>();
+    std::ostringstream os;
+    writePla(tt, os, PlaWriterSettings{}, statistics);
+    EXPECT_EQ(os.str(), ".i 12\n.o 2\n.p 3\n0----------- 00\n1----------0 10\n1----------1 11\n.e\n");
+    EXPECT_EQ(statistics->get<std::uint64_t>("input_cubes"), 1ULL << nInputs);
+    EXPECT_EQ(statistics->get<std::uint64_t>("cubes"), 3U);
+    EXPECT_EQ(readBack(os.str()), tt);
+}
+
+TEST_F(PlaWriterTest, TableWithoutInputsHasOneRow) {
+    TruthTable tt;
+    tt.try_emplace(TruthTable::Cube{}, TruthTable::Cube::fromInteger(1U, 2U));
+
+    const auto content = written(tt);
+    EXPECT_EQ(content, ".i 0\n.o 2\n.p 1\n01\n.e\n");
+    EXPECT_EQ(readBack(content), tt);
+
+    PlaWriterSettings settings;
+    settings.mergeCubes = false;
+    EXPECT_EQ(written(tt, settings), content);
+}
+
+TEST_F(PlaWriterTest, WrittenTruthTablesAreReadBackUnchanged) {
+    for (const std::string name: {"3_17_6", "4mod5", "aludc", "dc3bit", "decode24", "graycode", "hwb4_12", "or"}) {
+        TruthTable tt;
+        ASSERT_TRUE(readPla(tt, testCircuitsDir + name + ".pla"));
+
+        const auto content = written(tt);
+        EXPECT_EQ(readBack(content), tt) << name;
+
+        PlaWriterSettings settings;
+        settings.omitZeroOutputs = true;
+        EXPECT_EQ(readBack(written(tt, settings)), tt) << name;
+    }
+}
+
+TEST_F(PlaWriterTest, OutputDoesNotDependOnThreadsOrChunks) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, testCircuitsDir + "hwb4_12.pla"));
+    const auto expected = written(tt);
+
+    PlaWriterSettings settings;
+    settings.nThreads  = 1U;
+    settings.chunkSize = 1U;
+    EXPECT_EQ(written(tt, settings), expected);
+    settings.nThreads  = 4U;
+    settings.chunkSize = 64U;
+    EXPECT_EQ(written(tt, settings), expected);
+}
+
+TEST_F(PlaWriterTest, WriteAndReadFile) {
+    TruthTable tt;
+    ASSERT_TRUE(readPla(tt, testCircuitsDir + "4gt10.pla"));
+
+    const std::string fileName = "./pla_writer_test.pla";
+    ASSERT_TRUE(writePla(tt, fileName));
+    TruthTable readTt;
+    EXPECT_TRUE(readPla(readTt, fileName));
+    std::remove(fileName.c_str());
+    EXPECT_EQ(readTt, tt);
+
+    EXPECT_FALSE(writePla(tt, "./nonexistent_directory/pla_writer_test.pla"));
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/quantum_cost_kernel.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+TEST(QuantumCostKernelTest, CostOfGatesWithDifferentNumberOfControls) {
+    qc::QuantumComputation quantumComputation(8U);
+    quantumComputation.x(0U);
+    quantumComputation.cx(qc::Control{0U}, 1U);
+    quantumComputation.mcx({qc::Control{0U}, qc::Control{1U, qc::Control::Type::Neg}}, 2U);
+    quantumComputation.swap(3U, 4U);
+    quantumComputation.cswap(qc::Control{0U}, 3U, 4U);
+    quantumComputation.mcx({qc::Control{0U}, qc::Control{1U}, qc::Control{2U}, qc::Control{3U}, qc::Control{4U}, qc::Control{5U}}, 6U);
+    quantumComputation.mcx({qc::Control{0U}, qc::Control{1U}, qc::Control{2U}, qc::Control{3U}, qc::Control{4U}, qc::Control{5U}, qc::Control{6U}}, 7U);
+
+    const QuantumCostKernel kernel(quantumComputation);
+    ASSERT_EQ(kernel.getNgates(), quantumComputation.getNops());
+    EXPECT_EQ(kernel.histogram(0U, kernel.getNgates()), (std::vector<std::uint64_t>{1U, 2U, 2U, 0U, 0U, 0U, 1U, 1U}));
+
+    QuantumCostKernel::Cost expectedCost = 0U;
+    for (std::size_t i = 0U; i < quantumComputation.getNops(); ++i) {
+        const auto& op = quantumComputation.at(i);
+        expectedCost += AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(op->getNcontrols(), op->getType(), quantumComputation.getNqubits());
+        EXPECT_EQ(kernel.cost(i, i + 1U), AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(op->getNcontrols(), op->getType(), quantumComputation.getNqubits()));
+        EXPECT_EQ(kernel.cost(0U, i + 1U), expectedCost);
+    }
+    EXPECT_EQ(kernel.cost(), expectedCost);
+    EXPECT_EQ(kernel.cost(3U, 3U), 0U);
+}
+
+TEST(QuantumCostKernelTest, HistogramWithManyBins) {
+    // more numbers of effective controls than are counted by comparisons, thus the partial histograms are filled
+    constexpr std::size_t  numQubits    = 24U;
+    constexpr std::size_t  nRepetitions = 10U;
+    qc::QuantumComputation quantumComputation(numQubits);
+    for (std::size_t repetition = 0U; repetition < nRepetitions; ++repetition) {
+        qc::Controls controls;
+        for (qc::Qubit control = 0U; control < numQubits - 1U; ++control) {
+            quantumComputation.mcx(controls, static_cast<qc::Qubit>(numQubits - 1U));
+            controls.emplace(control);
+        }
+    }
+
+    const QuantumCostKernel kernel(quantumComputation);
+    ASSERT_EQ(kernel.getCostTable().size(), numQubits - 1U);
+    EXPECT_EQ(kernel.histogram(0U, kernel.getNgates()), std::vector<std::uint64_t>(numQubits - 1U, nRepetitions));
+
+    QuantumCostKernel::Cost expectedCost = 0U;
+    for (const auto& op: quantumComputation) {
+        expectedCost += AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(op->getNcontrols(), op->getType(), numQubits);
+    }
+    EXPECT_EQ(kernel.cost(), expectedCost);
+}
+
+TEST(QuantumCostKernelTest, CostOfEmptyCircuits) {
+    const QuantumCostKernel kernel(qc::QuantumComputation(0U));
+    EXPECT_EQ(kernel.getNgates(), 0U);
+    EXPECT_EQ(kernel.cost(), 0U);
+    EXPECT_EQ(kernel.costPerGroup({}, 0U), std::vector<QuantumCostKernel::Cost>{});
+}
+
+TEST(QuantumCostKernelTest, InvalidRangesAndGroups) {
+    qc::QuantumComputation quantumComputation(2U);
+    quantumComputation.x(0U);
+    quantumComputation.cx(qc::Control{0U}, 1U);
+    const QuantumCostKernel kernel(quantumComputation);
+
+    EXPECT_THROW(static_cast<void>(kernel.cost(0U, 3U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(kernel.cost(2U, 1U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(kernel.histogram(3U, 3U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(kernel.costPerGroup({0U}, 1U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(kernel.costPerGroup({0U, 1U}, 1U)), std::invalid_argument);
+    EXPECT_THROW(static_cast<void>(kernel.costPerAnnotation(AnnotatableQuantumComputation(), "lno")), std::invalid_argument);
+}
+
+class QuantumCostKernelSynthesisTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(QuantumCostKernel, QuantumCostKernelSynthesisTest,
+                         testing::Values(
+                                 "accumulator_4",
+                                 "alu_2",
+                                 "binary_numeric",
+                                 "bitwise_and_2",
+                                 "bitwise_or_2",
+                                 "bn_2",
+                                 "call_8",
+                                 "comparators_3",
+                                 "divide_2",
+                                 "dynamic_index_2",
+                                 "for_32",
+                                 "for_4",
+                                 "for_invariant_4",
+                                 "gray_binary_conversion_16",
+                                 "if_common_statements_4",
+                                 "increment_16",
+                                 "increment_4",
+                                 "input_repeated_2",
+                                 "input_repeated_4",
+                                 "logical_and_1",
+                                 "logical_or_1",
+                                 "modulo_2",
+                                 "multiple_statement_4",
+                                 "multiply_2",
+                                 "negate_8",
+                                 "numeric_2",
+                                 "operators_repeated_4",
+                                 "parity_4",
+                                 "parity_check_16",
+                                 "shift_4",
+                                 "simple_add_2",
+                                 "single_longstatement_4",
+                                 "skip",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<QuantumCostKernelSynthesisTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(QuantumCostKernelSynthesisTest, CostMatchesCostOfCircuit) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/" + GetParam() + ".src").empty());
+    AnnotatableQuantumComputation synthesized;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesized, program));
+
+    QuantumCostKernel::Cost expectedCost = 0U;
+    for (std::size_t i = 0U; i < synthesized.getNops(); ++i) {
+        const auto* op = synthesized.getQuantumOperation(i);
+        expectedCost += AnnotatableQuantumComputation::getQuantumCostOfOperationForSynthesis(op->getNcontrols(), op->getType(), synthesized.getNqubits());
+    }
+
+    const QuantumCostKernel kernel(synthesized);
+    EXPECT_EQ(kernel.cost(), expectedCost);
+    EXPECT_EQ(synthesized.getQuantumCostForSynthesis(), expectedCost);
+
+    const auto histogram = kernel.histogram(0U, kernel.getNgates());
+    EXPECT_EQ(std::accumulate(histogram.cbegin(), histogram.cend(), std::uint64_t{0U}), kernel.getNgates());
+
+    // the cost of adjacent ranges adds up to the cost of the circuit
+    const auto split = kernel.getNgates() / 3U;
+    EXPECT_EQ(kernel.cost(0U, split) + kernel.cost(split, kernel.getNgates()), expectedCost);
+
+    std::vector<std::uint32_t> groupOfGate(kernel.getNgates());
+    for (std::size_t i = 0U; i < groupOfGate.size(); ++i) {
+        groupOfGate[i] = static_cast<std::uint32_t>(i % 3U);
+    }
+    const auto costPerGroup = kernel.costPerGroup(groupOfGate, 3U);
+    EXPECT_EQ(std::accumulate(costPerGroup.cbegin(), costPerGroup.cend(), QuantumCostKernel::Cost{0U}), expectedCost);
+
+    // the gates are annotated with the line number of the statement they were synthesized for
+    const auto costPerLine = kernel.costPerAnnotation(synthesized, "lno");
+    EXPECT_EQ(costPerLine.empty(), kernel.getNgates() == 0U);
+    EXPECT_EQ(std::accumulate(costPerLine.cbegin(), costPerLine.cend(), QuantumCostKernel::Cost{0U}, [](const QuantumCostKernel::Cost sum, const auto& entry) { return sum + entry.second; }), expectedCost);
+}
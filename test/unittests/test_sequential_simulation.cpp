@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/sequential_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/variable.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class SyrecSequentialSimulationTest: public testing::Test {
+protected:
+    Program                       program;
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+
+    void SetUp() override {
+        // the state variable s accumulates the input a of every cycle, which is copied to the output y
+        ASSERT_TRUE(program.read("./circuits/accumulator_4.src").empty());
+        ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+    }
+
+    [[nodiscard]] const Module& mainModule() const {
+        return *program.modules().front();
+    }
+};
+
+TEST(SyrecStateVariableTest, StateAndWireVariablesAreParsed) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module main(in a(4), out y(4))\n"
+                                       "state s(4), t[2](3)\n"
+                                       "wire w(1)\n"
+                                       "s += a;\n"
+                                       "t[1] ^= a.0:2;\n"
+                                       "w ^= a.1;\n"
+                                       "y ^= s\n")
+                        .empty());
+    const auto& variables = program.modules().front()->variables;
+    ASSERT_EQ(variables.size(), 3U);
+    EXPECT_EQ(variables[0]->type, Variable::State);
+    EXPECT_EQ(variables[0]->bitwidth, 4U);
+    EXPECT_EQ(variables[1]->type, Variable::State);
+    EXPECT_EQ(variables[1]->dimensions, std::vector<unsigned>{2U});
+    EXPECT_EQ(variables[1]->bitwidth, 3U);
+    EXPECT_EQ(variables[2]->type, Variable::Wire);
+    EXPECT_EQ(program.modules().front()->findParameterOrVariable("w"), variables[2]);
+
+    Program redefinition;
+    EXPECT_FALSE(redefinition.readFromString("module main(in a(4))\nstate a(2)\n++= a\n").empty());
+}
+
+TEST_F(SyrecSequentialSimulationTest, StateIsFedBackToTheNextCycle) {
+    SequentialSimulationSettings settings;
+    settings.nCycles         = 1000U;
+    settings.nStreams        = 100U;
+    settings.recordedSignals = {"y", "s"};
+    settings.nThreads        = 2U;
+
+    std::mt19937_64    rng(42U);
+    SequentialStimulus input{"a", {}};
+    for (std::size_t i = 0U; i < settings.nCycles * settings.nStreams; ++i) {
+        input.values.emplace_back(rng() % 16U);
+    }
+    const auto trace = sequentialSimulation(annotatableQuantumComputation, mainModule(), {input}, settings);
+    ASSERT_TRUE(trace.has_value());
+    ASSERT_EQ(trace->signals, settings.recordedSignals);
+
+    for (std::size_t stream = 0U; stream < settings.nStreams; ++stream) {
+        std::uint64_t state = 0U;
+        for (std::size_t cycle = 0U; cycle < settings.nCycles; ++cycle) {
+            state = (state + input.values[(cycle * settings.nStreams) + stream]) % 16U;
+            ASSERT_EQ(trace->value(0U, cycle, stream), state) << "Cycle " << cycle << " of stream " << stream;
+            ASSERT_EQ(trace->value(1U, cycle, stream), state) << "Cycle " << cycle << " of stream " << stream;
+        }
+    }
+}
+
+TEST_F(SyrecSequentialSimulationTest, StimuliDriveTheirFirstCyclesOnly) {
+    SequentialSimulationSettings settings;
+    settings.nCycles         = 4U;
+    settings.nStreams        = 2U;
+    settings.recordedSignals = {"s"};
+
+    // the state is initialized in the first cycle and the input is only driven in the first two cycles
+    const SequentialStimulus initialState{"s", {10U, 3U}};
+    const SequentialStimulus input{"a", {1U, 2U, 4U, 8U}};
+    const auto               trace = sequentialSimulation(annotatableQuantumComputation, mainModule(), {initialState, input}, settings);
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_EQ(trace->values.front(), (std::vector<std::uint64_t>{11U, 5U, 15U, 13U, 15U, 13U, 15U, 13U}));
+}
+
+TEST_F(SyrecSequentialSimulationTest, InvalidSignalsAreRejected) {
+    SequentialSimulationSettings settings;
+    settings.nStreams = 2U;
+
+    // unknown signals, driven outputs and stimuli without a value for every stream of a cycle
+    EXPECT_FALSE(sequentialSimulation(annotatableQuantumComputation, mainModule(), {SequentialStimulus{"b", {0U, 0U}}}, settings).has_value());
+    EXPECT_FALSE(sequentialSimulation(annotatableQuantumComputation, mainModule(), {SequentialStimulus{"y", {0U, 0U}}}, settings).has_value());
+    EXPECT_FALSE(sequentialSimulation(annotatableQuantumComputation, mainModule(), {SequentialStimulus{"a", {0U, 0U, 0U}}}, settings).has_value());
+    settings.recordedSignals = {"x"};
+    EXPECT_FALSE(sequentialSimulation(annotatableQuantumComputation, mainModule(), {}, settings).has_value());
+}
+
+TEST(SyrecModuleInstanceTest, CalledModulesHaveVariablesPerCall) {
+    // the module is called twice and uncalled, its local variables have the names of a variable of the caller
+    Program program;
+    ASSERT_TRUE(program.readFromString("module count(in a(2), inout x(2))\n"
+                                       "state s(2)\n"
+                                       "wire w(2)\n"
+                                       "w ^= a;\n"
+                                       "s += w;\n"
+                                       "x ^= s;\n"
+                                       "w ^= a\n"
+                                       "module main(in a(2), inout y(2), inout z(2))\n"
+                                       "state s(2)\n"
+                                       "wire w(2)\n"
+                                       "call count(a, y);\n"
+                                       "call count(a, z);\n"
+                                       "uncall count(a, z)\n")
+                        .empty());
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+
+    const auto labels   = annotatableQuantumComputation.getQubitLabels();
+    const auto hasLabel = [&](const std::string& label) { return std::find(labels.cbegin(), labels.cend(), label) != labels.cend(); };
+    for (const auto* label: {"s.0", "w.1", "count#0/s.0", "count#0/w.1", "count#1/s.1", "count#2/w.0"}) {
+        EXPECT_TRUE(hasLabel(label)) << "No qubit labelled " << label;
+    }
+    EXPECT_FALSE(hasLabel("count#3/s.0"));
+
+    // the state of every instance is carried to the next cycle, the uncall xors its state to z before subtracting a from it
+    SequentialSimulationSettings settings;
+    settings.nCycles         = 2U;
+    settings.nStreams        = 1U;
+    settings.recordedSignals = {"y", "z"};
+    const auto trace         = sequentialSimulation(annotatableQuantumComputation, *program.findModule("main"), {SequentialStimulus{"a", {1U, 1U}}}, settings);
+    ASSERT_TRUE(trace.has_value());
+    EXPECT_EQ(trace->values[0], (std::vector<std::uint64_t>{1U, 2U}));
+    EXPECT_EQ(trace->values[1], (std::vector<std::uint64_t>{1U, 1U}));
+}
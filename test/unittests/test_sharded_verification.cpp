@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/sharded_verification.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/io/pla_parser.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/syrec/program.hpp"
+#include "core/truthTable/truth_table.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+class ShardedVerificationTest: public testing::Test {
+protected:
+    ShardedVerificationSettings settings;
+
+    void SetUp() override {
+        settings.directory = "./sharded_verification_test";
+        std::filesystem::remove_all(settings.directory);
+    }
+
+    void TearDown() override {
+        std::filesystem::remove_all(settings.directory);
+    }
+
+    static std::vector<qc::Qubit> primaryInputs(const qc::QuantumComputation& qc) {
+        std::vector<qc::Qubit> inputs;
+        for (std::size_t i = 0U; i < qc.getNqubits(); ++i) {
+            if (!qc.getAncillary()[i]) {
+                inputs.emplace_back(static_cast<qc::Qubit>(i));
+            }
+        }
+        return inputs;
+    }
+
+    static std::shared_ptr<qc::QuantumComputation> synthesizePla(const std::string& name) {
+        TruthTable tt{};
+        EXPECT_TRUE(readPla(tt, "./circuits/" + name + ".pla"));
+        return DDSynthesizer::synthesizeOnePass(tt);
+    }
+};
+
+TEST_F(ShardedVerificationTest, SynthesizedProgramIsEquivalentToItself) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/gray_binary_conversion_16.src").empty());
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+
+    settings.nShards  = 4U;
+    settings.nWorkers = 2U;
+    const auto report = verifyExhaustively(annotatableQuantumComputation, annotatableQuantumComputation, settings);
+    EXPECT_TRUE(report.equivalent());
+    EXPECT_EQ(report.totalAssignments, 1ULL << primaryInputs(annotatableQuantumComputation).size());
+    EXPECT_EQ(report.checkedAssignments, report.totalAssignments);
+    EXPECT_DOUBLE_EQ(report.coverage(), 1.);
+    EXPECT_TRUE(report.counterexamples.empty());
+}
+
+TEST_F(ShardedVerificationTest, CounterexamplesMatchSimulation) {
+    const auto circuit = synthesizePla("hwb7_15");
+    ASSERT_NE(circuit, nullptr);
+    const auto inputs = primaryInputs(*circuit);
+
+    // flipping the second primary input whenever the first primary input is set at the end of the circuit
+    qc::QuantumComputation mutated = *circuit;
+    mutated.mcx(qc::Controls{qc::Control{inputs[0]}}, inputs[1]);
+
+    settings.nShards            = 3U;
+    settings.nWorkers           = 3U;
+    settings.isolateWorkers     = true;
+    settings.maxCounterexamples = 5U;
+    const auto report           = verifyExhaustively(mutated, *circuit, settings);
+    ASSERT_EQ(report.totalAssignments, 1ULL << inputs.size());
+    EXPECT_EQ(report.checkedAssignments, report.totalAssignments);
+    EXPECT_TRUE(report.incompleteShards.empty());
+    EXPECT_FALSE(report.equivalent());
+
+    std::uint64_t                    expectedMismatches = 0U;
+    std::vector<NBitValuesContainer> mutatedOutputs;
+    std::vector<std::uint64_t>       mismatchingInputs;
+    for (std::uint64_t assignment = 0U; assignment < report.totalAssignments; ++assignment) {
+        NBitValuesContainer input(circuit->getNqubits());
+        for (std::size_t k = 0U; k < inputs.size(); ++k) {
+            input.set(inputs[k], ((assignment >> k) & 1U) != 0U);
+        }
+        NBitValuesContainer output;
+        simpleSimulation(output, *circuit, input);
+        if (output[inputs[0]]) {
+            ++expectedMismatches;
+            mismatchingInputs.emplace_back(assignment);
+            NBitValuesContainer mutatedOutput;
+            simpleSimulation(mutatedOutput, mutated, input);
+            mutatedOutputs.emplace_back(mutatedOutput);
+        }
+    }
+    EXPECT_EQ(report.mismatches, expectedMismatches);
+
+    // the first counterexamples are reported in the order of the assignments (all qubits of the circuit are primary outputs)
+    ASSERT_EQ(report.counterexamples.size(), settings.maxCounterexamples);
+    for (std::size_t i = 0U; i < report.counterexamples.size(); ++i) {
+        const auto& counterexample = report.counterexamples[i];
+        EXPECT_EQ(counterexample.input, mismatchingInputs[i]);
+        EXPECT_NE(counterexample.output, counterexample.expected);
+        EXPECT_EQ(counterexample.output[inputs[1]] == '1', mutatedOutputs[i][inputs[1]]);
+    }
+}
+
+TEST_F(ShardedVerificationTest, ResumesFromCheckpoints) {
+    const auto circuit = synthesizePla("hwb7_15");
+    ASSERT_NE(circuit, nullptr);
+    qc::QuantumComputation mutated = *circuit;
+    mutated.x(0);
+
+    settings.nShards              = 1U;
+    settings.maxAssignmentsPerRun = 64U;
+    settings.checkpointInterval   = 64U;
+
+    // every run of the worker checks a single block of 64 assignments only
+    auto report = verifyExhaustively(mutated, *circuit, settings);
+    EXPECT_EQ(report.checkedAssignments, 64U);
+    EXPECT_EQ(report.incompleteShards, std::vector<std::size_t>{0U});
+    EXPECT_FALSE(report.equivalent());
+
+    report = verifyExhaustively(mutated, *circuit, settings);
+    EXPECT_EQ(report.checkedAssignments, report.totalAssignments);
+    EXPECT_TRUE(report.incompleteShards.empty());
+    EXPECT_EQ(report.mismatches, report.totalAssignments);
+
+    // the checkpoint of another pair of circuits is not used
+    EXPECT_TRUE(verifyShard(*circuit, *circuit, 0U, settings));
+    EXPECT_TRUE(mergeShardCheckpoints(*circuit, *circuit, settings).incompleteShards.size() == 1U);
+    settings.maxAssignmentsPerRun = 0U;
+    EXPECT_TRUE(verifyExhaustively(*circuit, *circuit, settings).equivalent());
+}
+
+TEST_F(ShardedVerificationTest, RejectsDifferentInterfaces) {
+    const auto circuit   = synthesizePla("hwb4_12");
+    const auto reference = synthesizePla("hwb5_13");
+    ASSERT_NE(circuit, nullptr);
+    ASSERT_NE(reference, nullptr);
+
+    EXPECT_FALSE(verifyShard(*circuit, *reference, 0U, settings));
+    EXPECT_FALSE(verifyShard(*circuit, *circuit, 1U, settings));
+    const auto report = verifyExhaustively(*circuit, *reference, settings);
+    EXPECT_FALSE(report.equivalent());
+    EXPECT_EQ(report.checkedAssignments, 0U);
+}
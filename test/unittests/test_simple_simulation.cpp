@@ -8,11 +8,16 @@
  * Licensed under the MIT License
  */
 
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
 #include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/dd_synthesis.hpp"
 #include "core/annotatable_quantum_computation.hpp"
+#include "core/io/pla_parser.hpp"
 #include "core/n_bit_values_container.hpp"
 #include "core/properties.hpp"
+#include "core/truthTable/truth_table.hpp"
 #include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
 #include "ir/operations/Control.hpp"
 #include "ir/operations/OpType.hpp"
 #include "ir/operations/StandardOperation.hpp"
@@ -22,6 +27,8 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 using namespace syrec;
 
@@ -81,6 +88,22 @@ TEST(SimpleSimulationTests, SimulationOfXOperationWithOnlySomeControlQubitsSet)
     ASSERT_FALSE(inputState[2]);
 }
 
+TEST(SimpleSimulationTests, SimulationOfXOperationWithNegativeControlQubits) {
+    constexpr std::size_t numQubits      = 3;
+    constexpr auto        targetQubit    = static_cast<qc::Qubit>(1);
+    const auto            xGateOperation = qc::StandardOperation(qc::Controls({qc::Control{0}, qc::Control{2, qc::Control::Type::Neg}}), targetQubit, qc::OpType::X);
+
+    NBitValuesContainer blockedState(numQubits, 5); // 101
+    ASSERT_TRUE(coreOperationSimulation(xGateOperation, blockedState));
+    ASSERT_FALSE(blockedState[1]);
+
+    NBitValuesContainer appliedState(numQubits, 1); // 100
+    ASSERT_TRUE(coreOperationSimulation(xGateOperation, appliedState));
+    ASSERT_TRUE(appliedState[0]);
+    ASSERT_TRUE(appliedState[1]);
+    ASSERT_FALSE(appliedState[2]);
+}
+
 TEST(SimpleSimulationTests, SimulationOfSwapOperationWithNoControlQubits) {
     constexpr std::size_t   numQubits         = 4;
     constexpr std::uint64_t initialStateValue = 12; // 0011
@@ -210,3 +233,57 @@ TEST(SimpleSimulationTests, SimulationRuntimePropertySet) {
 
     ASSERT_NO_FATAL_FAILURE(statistics->get<double>("runtime"));
 }
+
+TEST(SimpleSimulationTests, WordPackedSimulationOfGatesWithControlsInSeveralWords) {
+    constexpr std::size_t  numQubits = 70;
+    qc::QuantumComputation quantumComputation(numQubits);
+    quantumComputation.mcx({qc::Control{3}, qc::Control{65, qc::Control::Type::Neg}}, 68);
+    quantumComputation.cswap(qc::Control{66, qc::Control::Type::Neg}, 1, 69);
+
+    const auto compiled = WordPackedGates::compile(quantumComputation);
+    ASSERT_TRUE(compiled.has_value());
+    ASSERT_EQ(compiled->getNwords(), 2);
+
+    std::vector<std::uint64_t> state{(1ULL << 3U) | (1ULL << 1U), 0U};
+    compiled->simulate(state);
+    EXPECT_EQ(state[0], 1ULL << 3U);
+    EXPECT_EQ(state[1], (1ULL << (68U - 64U)) | (1ULL << (69U - 64U)));
+
+    // the controls on qubit 65 and 66 are not satisfied anymore
+    std::vector<std::uint64_t> blockedState{(1ULL << 3U) | (1ULL << 1U), (1ULL << (65U - 64U)) | (1ULL << (66U - 64U))};
+    const auto                 expectedState = blockedState;
+    compiled->simulate(blockedState);
+    EXPECT_EQ(blockedState, expectedState);
+
+    NBitValuesContainer output;
+    EXPECT_FALSE(compiled->simulate(output, NBitValuesContainer(numQubits - 1)));
+}
+
+TEST(SimpleSimulationTests, WordPackedSimulationMatchesSimpleSimulationOfDDSynthesizedCircuits) {
+    for (const std::string name: {"3_17_6", "4mod5", "aludc", "dc3bit", "hwb4_12"}) {
+        TruthTable tt{};
+        ASSERT_TRUE(readPla(tt, "./circuits/" + name + ".pla"));
+        const auto quantumComputation = DDSynthesizer::synthesizeOnePass(tt);
+        ASSERT_NE(quantumComputation, nullptr);
+
+        const auto compiled = WordPackedGates::compile(*quantumComputation);
+        ASSERT_TRUE(compiled.has_value());
+        const auto numQubits = quantumComputation->getNqubits();
+        for (std::uint64_t input = 0; input < (1ULL << numQubits); ++input) {
+            const NBitValuesContainer inputState(numQubits, input);
+            NBitValuesContainer       expectedOutputState;
+            NBitValuesContainer       outputState;
+            simpleSimulation(expectedOutputState, *quantumComputation, inputState);
+            ASSERT_TRUE(compiled->simulate(outputState, inputState));
+            for (std::size_t qubit = 0; qubit < numQubits; ++qubit) {
+                ASSERT_EQ(outputState[qubit], expectedOutputState[qubit]) << name << ": input " << input << ", qubit " << qubit;
+            }
+        }
+    }
+}
+
+TEST(SimpleSimulationTests, WordPackedSimulationRejectsUnsupportedGates) {
+    qc::QuantumComputation quantumComputation(1);
+    quantumComputation.h(0);
+    EXPECT_FALSE(WordPackedGates::compile(quantumComputation).has_value());
+}
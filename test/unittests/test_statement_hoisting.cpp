@@ -0,0 +1,165 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/statement_hoisting.hpp"
+#include "algorithms/simulation/simple_simulation.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/n_bit_values_container.hpp"
+#include "core/syrec/program.hpp"
+#include "core/syrec/statement.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+
+namespace {
+    // Number of qubits of the parameters of the main module in ./circuits/if_common_statements_4.src
+    constexpr std::size_t N_PARAMETER_QUBITS = 13;
+
+    template<typename T>
+    const T* statementAs(const Statement::ptr& statement) {
+        return dynamic_cast<const T*>(statement.get());
+    }
+} // namespace
+
+TEST(SyrecStatementHoistingTest, LeadingAndTrailingStatementsAreHoisted) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/if_common_statements_4.src").empty());
+    EXPECT_EQ(hoistBranchCommonStatements(program), 2U);
+
+    const auto& statements = program.modules().front()->statements;
+    ASSERT_EQ(statements.size(), 3U);
+    ASSERT_NE(statementAs<UnaryStatement>(statements[0]), nullptr);
+    EXPECT_EQ(statements[0]->lineNumber, 3U);
+    const auto* ifStatement = statementAs<IfStatement>(statements[1]);
+    ASSERT_NE(ifStatement, nullptr);
+    EXPECT_EQ(ifStatement->thenStatements.size(), 1U);
+    EXPECT_EQ(ifStatement->elseStatements.size(), 1U);
+    ASSERT_NE(statementAs<AssignStatement>(statements[2]), nullptr);
+    EXPECT_EQ(statements[2]->lineNumber, 5U);
+
+    // nothing is left to hoist
+    EXPECT_EQ(hoistBranchCommonStatements(program), 0U);
+}
+
+TEST(SyrecStatementHoistingTest, IndependentStatementsAreMovedOutOfBranches) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module main(in c(1), inout x(4), inout y(4), inout z(4))\n"
+                                       "if c then\n"
+                                       "  ~= y;\n"
+                                       "  ++= x\n"
+                                       "else\n"
+                                       "  ++= x;\n"
+                                       "  z += y\n"
+                                       "fi c\n")
+                        .empty());
+    // ++= x commutes with ~= y in the then branch and is the first statement of the else branch
+    EXPECT_EQ(hoistBranchCommonStatements(program), 1U);
+
+    const auto& statements = program.modules().front()->statements;
+    ASSERT_EQ(statements.size(), 2U);
+    ASSERT_NE(statementAs<UnaryStatement>(statements[0]), nullptr);
+    EXPECT_EQ(statements[0]->lineNumber, 4U);
+    const auto* ifStatement = statementAs<IfStatement>(statements[1]);
+    ASSERT_NE(ifStatement, nullptr);
+    ASSERT_EQ(ifStatement->thenStatements.size(), 1U);
+    EXPECT_EQ(ifStatement->thenStatements.front()->lineNumber, 3U);
+    ASSERT_EQ(ifStatement->elseStatements.size(), 1U);
+    EXPECT_EQ(ifStatement->elseStatements.front()->lineNumber, 7U);
+}
+
+TEST(SyrecStatementHoistingTest, DependentStatementsAreKept) {
+    Program program;
+    // the common statements write a variable of the condition or of the fi condition, depend on the preceding statement or differ in their operands
+    ASSERT_TRUE(program.readFromString("module main(inout x(4), inout y(4), inout z(4))\n"
+                                       "if (x = 0) then\n"
+                                       "  ++= x;\n"
+                                       "  y += z;\n"
+                                       "  ++= z\n"
+                                       "else\n"
+                                       "  ++= x;\n"
+                                       "  ~= z;\n"
+                                       "  ++= z\n"
+                                       "fi ((x + z) = 1)\n"
+                                       "if (y = 0) then\n"
+                                       "  x += z\n"
+                                       "else\n"
+                                       "  x += y\n"
+                                       "fi (y = 0)\n")
+                        .empty());
+    EXPECT_EQ(hoistBranchCommonStatements(program), 0U);
+    EXPECT_EQ(program.modules().front()->statements.size(), 2U);
+}
+
+TEST(SyrecStatementHoistingTest, NestedStatementsAreHoistedAndEmptyIfStatementsRemoved) {
+    Program program;
+    ASSERT_TRUE(program.readFromString("module main(in c(1), in d(1), inout x(4), inout y(4))\n"
+                                       "for $i = 0 to 1 do\n"
+                                       "  if c then\n"
+                                       "    if d then ++= x; ~= y else ++= x; ~= y fi d\n"
+                                       "  else\n"
+                                       "    ++= x\n"
+                                       "  fi c\n"
+                                       "rof\n")
+                        .empty());
+    // the inner if statement is replaced by its statements, of which ++= x is then hoisted out of the outer if statement
+    EXPECT_EQ(hoistBranchCommonStatements(program), 3U);
+
+    const auto* forStatement = statementAs<ForStatement>(program.modules().front()->statements.front());
+    ASSERT_NE(forStatement, nullptr);
+    ASSERT_EQ(forStatement->statements.size(), 2U);
+    ASSERT_NE(statementAs<UnaryStatement>(forStatement->statements[0]), nullptr);
+    const auto* ifStatement = statementAs<IfStatement>(forStatement->statements[1]);
+    ASSERT_NE(ifStatement, nullptr);
+    ASSERT_EQ(ifStatement->thenStatements.size(), 1U);
+    EXPECT_EQ(statementAs<UnaryStatement>(ifStatement->thenStatements.front())->op, UnaryStatement::Invert);
+    EXPECT_TRUE(ifStatement->elseStatements.empty());
+}
+
+TEST(SyrecStatementHoistingTest, SharedStatementsAreNotModified) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/if_common_statements_4.src").empty());
+    const auto original = program.modules().front()->statements.front();
+    ASSERT_EQ(hoistBranchCommonStatements(program), 2U);
+
+    const auto* ifStatement = statementAs<IfStatement>(original);
+    ASSERT_NE(ifStatement, nullptr);
+    EXPECT_EQ(ifStatement->thenStatements.size(), 3U);
+    EXPECT_EQ(ifStatement->elseStatements.size(), 3U);
+}
+
+TEST(SyrecStatementHoistingTest, HoistingKeepsFunctionalityAndReducesQuantumCost) {
+    Program original;
+    ASSERT_TRUE(original.read("./circuits/if_common_statements_4.src").empty());
+    Program hoisted;
+    ASSERT_TRUE(hoisted.read("./circuits/if_common_statements_4.src").empty());
+    ASSERT_EQ(hoistBranchCommonStatements(hoisted), 2U);
+
+    AnnotatableQuantumComputation originalCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(originalCircuit, original));
+    AnnotatableQuantumComputation hoistedCircuit;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(hoistedCircuit, hoisted));
+    EXPECT_LT(hoistedCircuit.getQuantumCostForSynthesis(), originalCircuit.getQuantumCostForSynthesis());
+
+    for (std::uint64_t input = 0; input < (std::uint64_t{1} << N_PARAMETER_QUBITS); ++input) {
+        NBitValuesContainer originalOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(originalOutput, originalCircuit, NBitValuesContainer(originalCircuit.getNqubits(), input)));
+        NBitValuesContainer hoistedOutput;
+        ASSERT_NO_FATAL_FAILURE(simpleSimulation(hoistedOutput, hoistedCircuit, NBitValuesContainer(hoistedCircuit.getNqubits(), input)));
+        for (std::size_t i = 0; i < N_PARAMETER_QUBITS; ++i) {
+            ASSERT_EQ(originalOutput[i], hoistedOutput[i]) << "Qubit " << i << " differs for input " << input;
+        }
+    }
+}
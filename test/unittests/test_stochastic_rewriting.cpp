@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/stochastic_rewriting.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "optimization_test_utils.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+using namespace qc::literals;
+using optimization_test::quantumCost;
+
+namespace {
+    bool equivalent(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference) {
+        return optimization_test::equivalent(circuit, reference, "./stochastic_rewriting_test");
+    }
+
+    StochasticRewritingSettings testSettings() {
+        StochasticRewritingSettings settings;
+        settings.nChains       = 4U;
+        settings.nThreads      = 2U;
+        settings.stepsPerChain = 5000U;
+        settings.syncInterval  = 500U;
+        return settings;
+    }
+} // namespace
+
+class StochasticRewritingTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(StochasticRewriting, StochasticRewritingTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "call_8",
+                                 "for_4",
+                                 "gray_binary_conversion_16",
+                                 "negate_8",
+                                 "parity_check_16",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<StochasticRewritingTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(StochasticRewritingTest, NeverIncreasesCostAndPreservesFunctionality) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/" + GetParam() + ".src").empty());
+    AnnotatableQuantumComputation synthesized;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesized, program));
+
+    qc::QuantumComputation optimized = synthesized;
+    const auto             statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(stochasticRewriting(optimized, testSettings(), statistics));
+
+    EXPECT_EQ(statistics->get<std::uint64_t>("initial_quantum_cost"), synthesized.getQuantumCostForSynthesis());
+    EXPECT_EQ(statistics->get<std::uint64_t>("quantum_cost"), quantumCost(optimized));
+    EXPECT_EQ(statistics->get<std::uint64_t>("discarded_rewrites"), 0U);
+    EXPECT_LE(quantumCost(optimized), synthesized.getQuantumCostForSynthesis());
+    EXPECT_EQ(optimized.getNqubits(), synthesized.getNqubits());
+    EXPECT_EQ(optimized.getAncillary(), synthesized.getAncillary());
+    EXPECT_EQ(optimized.getGarbage(), synthesized.getGarbage());
+    EXPECT_TRUE(equivalent(optimized, synthesized));
+}
+
+TEST(StochasticRewritingIdentityTest, MergesGatesDifferingInPolarity) {
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.mcx({0_pc, 1_pc}, 2U);
+    quantumComputation.mcx({0_pc, 1_nc}, 2U);
+    const auto original = quantumComputation;
+
+    ASSERT_TRUE(stochasticRewriting(quantumComputation, testSettings()));
+    ASSERT_EQ(quantumComputation.getNops(), 1U);
+    EXPECT_EQ(quantumComputation.at(0)->getType(), qc::OpType::X);
+    EXPECT_EQ(quantumComputation.at(0)->getControls(), qc::Controls{0_pc});
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(StochasticRewritingIdentityTest, MovesToffoliGateAcrossCnotGate) {
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.mcx({0_pc, 1_pc}, 2U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.mcx({0_pc, 1_nc}, 2U);
+    const auto original = quantumComputation;
+
+    // moving the first Toffoli gate across the CNOT gate flips the polarity of its control on qubit 1 (Peres identity), thus the Toffoli gates cancel
+    ASSERT_TRUE(stochasticRewriting(quantumComputation, testSettings()));
+    ASSERT_EQ(quantumComputation.getNops(), 1U);
+    EXPECT_EQ(quantumCost(quantumComputation), 1U);
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(StochasticRewritingIdentityTest, CollapsesFredkinDecomposition) {
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.cx(1_pc, 0U);
+    quantumComputation.mcx({0_pc, 2_pc}, 1U);
+    quantumComputation.cx(1_pc, 0U);
+    const auto original = quantumComputation;
+
+    ASSERT_TRUE(stochasticRewriting(quantumComputation, testSettings()));
+    ASSERT_EQ(quantumComputation.getNops(), 1U);
+    EXPECT_EQ(quantumComputation.at(0)->getType(), qc::OpType::SWAP);
+    EXPECT_EQ(quantumCost(quantumComputation), 5U);
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(StochasticRewritingIdentityTest, VerifiesCircuitWithoutExhaustiveSimulation) {
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.mcx({0_pc, 1_pc}, 2U);
+    quantumComputation.mcx({0_pc, 1_nc}, 2U);
+    const auto original = quantumComputation;
+
+    // the circuit has too many qubits to be simulated for all assignments, thus the optimized circuit is compared by its DD
+    auto settings                = testSettings();
+    settings.maxExhaustiveQubits = 2U;
+    ASSERT_TRUE(stochasticRewriting(quantumComputation, settings));
+    ASSERT_EQ(quantumComputation.getNops(), 1U);
+    EXPECT_EQ(quantumComputation.at(0)->getControls(), qc::Controls{0_pc});
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(StochasticRewritingIdentityTest, RejectsUnsupportedGates) {
+    qc::QuantumComputation quantumComputation(2U);
+    quantumComputation.h(0U);
+    quantumComputation.cx(0_pc, 1U);
+    EXPECT_FALSE(stochasticRewriting(quantumComputation, testSettings()));
+    EXPECT_EQ(quantumComputation.getNops(), 2U);
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/simulation/bit_parallel_simulation.hpp"
+#include "algorithms/simulation/waveform_trace.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/Definitions.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace syrec;
+
+namespace {
+    struct RandomGate {
+        qc::Qubit target;
+        qc::Qubit control;
+        bool      swap;
+        bool      positive;
+    };
+
+    qc::QuantumComputation circuitOfGates(const std::size_t nQubits, const std::vector<RandomGate>& gates, const std::size_t nGates) {
+        qc::QuantumComputation quantumComputation(nQubits);
+        for (std::size_t i = 0; i < nGates; ++i) {
+            const auto& gate = gates[i];
+            if (gate.swap) {
+                quantumComputation.cswap(qc::Control{gate.control, gate.positive ? qc::Control::Type::Pos : qc::Control::Type::Neg}, gate.target, static_cast<qc::Qubit>((gate.target + 1U) % nQubits));
+            } else {
+                quantumComputation.cx(qc::Control{gate.control, gate.positive ? qc::Control::Type::Pos : qc::Control::Type::Neg}, gate.target);
+            }
+        }
+        return quantumComputation;
+    }
+} // namespace
+
+TEST(WaveformTraceTests, TraceReplaysStatesOfWordPackedSimulation) {
+    constexpr std::size_t   numQubits = 70;
+    std::mt19937_64         generator(42);
+    std::vector<RandomGate> gates;
+    for (std::size_t i = 0; i < 2000; ++i) {
+        const auto target  = static_cast<qc::Qubit>(generator() % numQubits);
+        const auto control = static_cast<qc::Qubit>((target + 2U + (generator() % (numQubits - 3U))) % numQubits);
+        gates.emplace_back(RandomGate{target, control, i % 5U == 0U, (generator() & 1U) != 0U});
+    }
+
+    const auto compiled = WordPackedGates::compile(circuitOfGates(numQubits, gates, gates.size()));
+    ASSERT_TRUE(compiled.has_value());
+    const std::vector<std::uint64_t> initialState{generator(), generator() & ((1ULL << (numQubits - 64U)) - 1U)};
+
+    auto untracedState = initialState;
+    compiled->simulate(untracedState);
+    auto          tracedState = initialState;
+    WaveformTrace trace;
+    compiled->simulate(tracedState, trace);
+    EXPECT_EQ(tracedState, untracedState);
+    EXPECT_EQ(trace.getNqubits(), numQubits);
+    EXPECT_EQ(trace.getNgates(), gates.size());
+    EXPECT_EQ(trace.getInitialState(), initialState);
+    EXPECT_EQ(trace.stateAfter(trace.getNgates()), untracedState);
+    // a change takes a byte for the distance to the preceding change and one for the qubit
+    EXPECT_LE(trace.getBufferSize(), 2U * trace.getNchanges() + 16U);
+
+    for (const std::size_t nGates: {0U, 1U, 17U, 500U, 1999U}) {
+        const auto prefix = WordPackedGates::compile(circuitOfGates(numQubits, gates, nGates));
+        ASSERT_TRUE(prefix.has_value());
+        auto state = initialState;
+        prefix->simulate(state);
+        EXPECT_EQ(trace.stateAfter(nGates), state) << "after " << nGates << " gates";
+    }
+}
+
+TEST(WaveformTraceTests, OnlyChangedQubitsAreRecorded) {
+    qc::QuantumComputation quantumComputation(3);
+    quantumComputation.cx(qc::Control{0}, 1);
+    quantumComputation.x(2);
+    quantumComputation.swap(0, 1);
+    quantumComputation.swap(1, 2);
+
+    const auto compiled = WordPackedGates::compile(quantumComputation);
+    ASSERT_TRUE(compiled.has_value());
+    std::vector<std::uint64_t> state{0U};
+    WaveformTrace              trace;
+    compiled->simulate(state, trace);
+    EXPECT_EQ(state.front(), 0b010U);
+
+    // the unsatisfied control and the swap of equal values do not change any qubit
+    std::vector<std::size_t> changedGates;
+    std::vector<qc::Qubit>   changedQubits;
+    trace.forEachChange([&](const std::size_t gate, const qc::Qubit qubit) {
+        changedGates.emplace_back(gate);
+        changedQubits.emplace_back(qubit);
+    });
+    EXPECT_EQ(changedGates, (std::vector<std::size_t>{1U, 3U, 3U}));
+    EXPECT_EQ(changedQubits, (std::vector<qc::Qubit>{2U, 1U, 2U}));
+    EXPECT_EQ(trace.getBufferSize(), 6U);
+
+    // tracing another simulation discards the recorded changes
+    compiled->simulate(state, trace);
+    EXPECT_EQ(trace.getInitialState(), (std::vector<std::uint64_t>{0b010U}));
+    EXPECT_EQ(trace.getNchanges(), 5U);
+}
+
+TEST(WaveformTraceTests, VcdGroupsQubitsByVariableAndGatesByStatement) {
+    qc::QuantumComputation quantumComputation;
+    quantumComputation.addQubitRegister(1, "a.0");
+    quantumComputation.addQubitRegister(1, "a.1");
+    quantumComputation.addQubitRegister(1, "b_c.0");
+    quantumComputation.addQubitRegister(1, "q_3_const_0");
+    quantumComputation.x(0);
+    quantumComputation.cx(qc::Control{0}, 2);
+    quantumComputation.cx(qc::Control{1}, 3);
+    quantumComputation.swap(0, 1);
+
+    const auto compiled = WordPackedGates::compile(quantumComputation);
+    ASSERT_TRUE(compiled.has_value());
+    std::vector<std::uint64_t> state{0U};
+    WaveformTrace              trace;
+    compiled->simulate(state, trace);
+
+    const std::string header = "$timescale 1ns $end\n"
+                               "$scope module circuit $end\n"
+                               "$var wire 2 ! a $end\n"
+                               "$var wire 1 \" b_c $end\n"
+                               "$var wire 1 # q_3_const_0 $end\n"
+                               "$var integer 32 $ lno $end\n"
+                               "$upscope $end\n"
+                               "$enddefinitions $end\n"
+                               "#0\n$dumpvars\nb00 !\n0\"\n0#\nb0 $\n$end\n";
+
+    // the first two gates belong to the statement in line 2, the step of line 3 changes no qubit but the line number
+    std::ostringstream grouped;
+    writeVcd(grouped, trace, quantumComputation, {2U, 2U, 3U, 5U});
+    EXPECT_EQ(grouped.str(), header + "#1\nb10 $\nb01 !\n1\"\n#2\nb11 $\n#3\nb101 $\nb10 !\n");
+
+    VcdSettings settings;
+    settings.groupByStatement = false;
+    std::ostringstream perGate;
+    writeVcd(perGate, trace, quantumComputation, {2U, 2U, 3U, 5U}, settings);
+    EXPECT_EQ(perGate.str(), header + "#1\nb10 $\nb01 !\n#2\n1\"\n#3\nb11 $\n#4\nb101 $\nb10 !\n");
+
+    std::ostringstream unused;
+    EXPECT_THROW(writeVcd(unused, trace, quantumComputation, {2U}), std::invalid_argument);
+    EXPECT_THROW(writeVcd(unused, trace, qc::QuantumComputation(4), {2U, 2U, 3U, 5U}), std::invalid_argument);
+}
+
+TEST(WaveformTraceTests, VcdOfSynthesizedProgramUsesLineNumbersOfStatements) {
+    Program    program;
+    const auto error = program.readFromString("module main(inout a(2), inout b(2))\n"
+                                              "  a += b;\n"
+                                              "  ++= b\n");
+    ASSERT_TRUE(error.empty()) << error;
+
+    AnnotatableQuantumComputation annotatableQuantumComputation;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(annotatableQuantumComputation, program));
+    const auto compiled = WordPackedGates::compile(annotatableQuantumComputation);
+    ASSERT_TRUE(compiled.has_value());
+
+    // b = 1 with the qubits of the parameters a and b preceding all other qubits
+    std::vector<std::uint64_t> state(compiled->getNwords(), 0U);
+    state.front() = 1U << 2U;
+    WaveformTrace trace;
+    compiled->simulate(state, trace);
+    EXPECT_EQ(state.front() & 0b1111U, 0b1001U);
+
+    std::ostringstream vcd;
+    writeVcd(vcd, trace, annotatableQuantumComputation);
+    const auto dump = vcd.str();
+    EXPECT_NE(dump.find(" a $end\n"), std::string::npos);
+    EXPECT_NE(dump.find(" b $end\n"), std::string::npos);
+    // one time step per statement
+    EXPECT_NE(dump.find("#1\nb10 "), std::string::npos);
+    EXPECT_NE(dump.find("#2\nb11 "), std::string::npos);
+    EXPECT_EQ(dump.find("#3\n"), std::string::npos);
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2023 - 2025 Chair for Design Automation, TUM
+ * Copyright (c) 2025 Munich Quantum Software Company GmbH
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Licensed under the MIT License
+ */
+
+#include "algorithms/optimization/windowed_resynthesis.hpp"
+#include "algorithms/synthesis/syrec_cost_aware_synthesis.hpp"
+#include "core/annotatable_quantum_computation.hpp"
+#include "core/properties.hpp"
+#include "core/syrec/program.hpp"
+#include "ir/QuantumComputation.hpp"
+#include "ir/operations/Control.hpp"
+#include "ir/operations/OpType.hpp"
+#include "optimization_test_utils.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+
+using namespace syrec;
+using namespace qc::literals;
+using optimization_test::quantumCost;
+
+namespace {
+    bool equivalent(const qc::QuantumComputation& circuit, const qc::QuantumComputation& reference) {
+        return optimization_test::equivalent(circuit, reference, "./windowed_resynthesis_test");
+    }
+} // namespace
+
+class WindowedResynthesisTest: public testing::TestWithParam<std::string> {};
+
+INSTANTIATE_TEST_SUITE_P(WindowedResynthesis, WindowedResynthesisTest,
+                         testing::Values(
+                                 "alu_2",
+                                 "call_8",
+                                 "for_4",
+                                 "gray_binary_conversion_16",
+                                 "negate_8",
+                                 "parity_check_16",
+                                 "swap_2"),
+                         [](const testing::TestParamInfo<WindowedResynthesisTest::ParamType>& info) {
+                             auto s = info.param;
+                             std::replace( s.begin(), s.end(), '-', '_');
+                             return s; });
+
+TEST_P(WindowedResynthesisTest, NeverIncreasesCostAndPreservesFunctionality) {
+    Program program;
+    ASSERT_TRUE(program.read("./circuits/" + GetParam() + ".src").empty());
+    AnnotatableQuantumComputation synthesized;
+    ASSERT_TRUE(CostAwareSynthesis::synthesize(synthesized, program));
+
+    WindowedResynthesisSettings settings;
+    settings.nThreads = 2U;
+
+    qc::QuantumComputation optimized  = synthesized;
+    const auto             statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(windowedResynthesis(optimized, settings, statistics));
+
+    EXPECT_EQ(statistics->get<std::uint64_t>("initial_quantum_cost"), synthesized.getQuantumCostForSynthesis());
+    EXPECT_EQ(statistics->get<std::uint64_t>("quantum_cost"), quantumCost(optimized));
+    EXPECT_LE(quantumCost(optimized), synthesized.getQuantumCostForSynthesis());
+    EXPECT_LE(statistics->get<std::uint64_t>("replaced_windows"), statistics->get<std::uint64_t>("windows"));
+    EXPECT_EQ(optimized.getNqubits(), synthesized.getNqubits());
+    EXPECT_EQ(optimized.getAncillary(), synthesized.getAncillary());
+    EXPECT_EQ(optimized.getGarbage(), synthesized.getGarbage());
+    EXPECT_TRUE(equivalent(optimized, synthesized));
+}
+
+TEST(WindowedResynthesisWindowTest, RemovesWindowsRealizingTheIdentity) {
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.x(0U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.x(0U);
+    // touches more than two qubits and thus separates the two windows
+    quantumComputation.mcx({0_pc, 1_pc}, 2U);
+    quantumComputation.x(0U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.x(0U);
+    const auto original = quantumComputation;
+
+    WindowedResynthesisSettings settings;
+    settings.maxQubits = 2U;
+
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(windowedResynthesis(quantumComputation, settings, statistics));
+    ASSERT_EQ(quantumComputation.getNops(), 1U);
+    EXPECT_EQ(quantumComputation.at(0)->getType(), qc::OpType::X);
+    EXPECT_EQ(quantumComputation.at(0)->getControls(), (qc::Controls{0_pc, 1_pc}));
+    EXPECT_EQ(statistics->get<std::uint64_t>("windows"), 2U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("replaced_windows"), 2U);
+    // both windows realize the identity, thus the second one is taken from the cache
+    EXPECT_EQ(statistics->get<std::uint64_t>("cache_hits"), 1U);
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(WindowedResynthesisWindowTest, ReplacesWindowByCheaperResynthesizedGates) {
+    // the window on the qubits 1 and 2 realizes a CNOT gate with a negative control on qubit 1, the asymmetry between both qubits
+    // ensures that a resynthesis mixing up the order of the qubits is not equivalent and would thus be rejected
+    qc::QuantumComputation quantumComputation(3U);
+    quantumComputation.x(1U);
+    quantumComputation.cx(1_pc, 2U);
+    quantumComputation.x(1U);
+    const auto original = quantumComputation;
+
+    const auto statistics = std::make_shared<Properties>();
+    ASSERT_TRUE(windowedResynthesis(quantumComputation, WindowedResynthesisSettings{}, statistics));
+    EXPECT_GE(statistics->get<std::uint64_t>("replaced_windows"), 1U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("initial_quantum_cost"), 3U);
+    EXPECT_LT(quantumCost(quantumComputation), 3U);
+    EXPECT_EQ(statistics->get<std::uint64_t>("quantum_cost"), quantumCost(quantumComputation));
+    for (const auto& op: quantumComputation) {
+        EXPECT_FALSE(op->actsOn(0U));
+    }
+    EXPECT_TRUE(equivalent(quantumComputation, original));
+}
+
+TEST(WindowedResynthesisWindowTest, RejectsInvalidSettingsAndUnsupportedGates) {
+    qc::QuantumComputation quantumComputation(2U);
+    quantumComputation.cx(0_pc, 1U);
+    quantumComputation.cx(0_pc, 1U);
+
+    WindowedResynthesisSettings settings;
+    settings.maxQubits = 9U;
+    EXPECT_FALSE(windowedResynthesis(quantumComputation, settings));
+    settings.maxQubits = 0U;
+    EXPECT_FALSE(windowedResynthesis(quantumComputation, settings));
+    EXPECT_EQ(quantumComputation.getNops(), 2U);
+
+    quantumComputation.h(0U);
+    EXPECT_FALSE(windowedResynthesis(quantumComputation));
+    EXPECT_EQ(quantumComputation.getNops(), 3U);
+}